@@ -88,6 +88,7 @@ typedef enum AsymCrypt_Return_e
 {
     ASYM_CRYPT_RETURN_SUCCESS                  = 0xCEF6A572U, /*!< Success/pass return code */
     ASYM_CRYPT_RETURN_FAILURE                  = 0xD20341DDU, /*!< General or unspecified failure/error */
+    ASYM_CRYPT_RETURN_BUSY                     = 0xA19E3B64U, /*!< Asynchronous operation still running */
 }AsymCrypt_Return_t;
 
 /** \brief Handle to the AsymCrypt driver */
@@ -256,6 +257,27 @@ AsymCrypt_Return_t AsymCrypt_close(AsymCrypt_Handle handle);
  */
 AsymCrypt_Return_t AsymCrypt_RSAPrivate(AsymCrypt_Handle handle, const uint32_t m[RSA_MAX_LENGTH], const struct AsymCrypt_RSAPrivkey *k, uint32_t result[RSA_MAX_LENGTH]);
 
+/**
+ * \brief This Function starts a Decryption or Signing operation and returns
+ *        without waiting for the modular exponentiation. The operation is
+ *        completed by #AsymCrypt_poll or #AsymCrypt_wait, and from the PKA
+ *        interrupt when it is enabled for the instance. One operation runs
+ *        at a time; the other AsymCrypt operations fail while it runs.
+ *
+ * \param  handle  #AsymCrypt_Handle returned from #AsymCrypt_open()
+ *
+ * \param m       m value in bigint format.
+ * \param k       RSA private key
+ *
+ * \param result  Result of the operation in bigint format. caller must allocate
+ *                memory size of (2 * sizeof(p)) for the result. It must stay
+ *                valid until the operation is done.
+ *
+ * \return        #ASYM_CRYPT_RETURN_SUCCESS if the operation is started.
+ *                #ASYM_CRYPT_RETURN_FAILURE if the operation could not be started.
+ */
+AsymCrypt_Return_t AsymCrypt_RSAPrivateStart(AsymCrypt_Handle handle, const uint32_t m[RSA_MAX_LENGTH], const struct AsymCrypt_RSAPrivkey *k, uint32_t result[RSA_MAX_LENGTH]);
+
 /**
  * \brief This Function performs Encryption or Verification operations
  *
@@ -310,6 +332,54 @@ AsymCrypt_Return_t AsymCrypt_ECDSAVerify(AsymCrypt_Handle handle,
                         const struct AsymCrypt_ECDSASig *sig, 
                         const uint32_t h[ECDSA_MAX_LENGTH]);
 
+/**
+ * \brief ECDSA verify primitive function which starts the verification and
+ *        returns without waiting for it. The operation is completed as for
+ *        #AsymCrypt_RSAPrivateStart.
+ *
+ * \param  handle  #AsymCrypt_Handle returned from #AsymCrypt_open()
+ *
+ * \param cp      EC curve parameters
+ * \param pub     EC Public key
+ * \param sig     ECDSA Signature - 'r' & 's' value in bigint format
+ * \param h       Hash value of message to verify in bigint format
+ *
+ * \return        #ASYM_CRYPT_RETURN_SUCCESS if the operation is started.
+ *                #ASYM_CRYPT_RETURN_FAILURE if the operation could not be started.
+ */
+AsymCrypt_Return_t AsymCrypt_ECDSAVerifyStart(AsymCrypt_Handle handle,
+                        const struct AsymCrypt_ECPrimeCurveP *cp,
+                        const struct AsymCrypt_ECPoint *pub,
+                        const struct AsymCrypt_ECDSASig *sig,
+                        const uint32_t h[ECDSA_MAX_LENGTH]);
+
+/**
+ * \brief Function to check an asynchronous operation without blocking. The
+ *        result vector is written once the operation is done.
+ *
+ * \param  handle  #AsymCrypt_Handle returned from #AsymCrypt_open()
+ *
+ * \return        #ASYM_CRYPT_RETURN_BUSY if the operation is still running.
+ *                Result of the operation if it is done.
+ *                #ASYM_CRYPT_RETURN_FAILURE if no operation was started.
+ */
+AsymCrypt_Return_t AsymCrypt_poll(AsymCrypt_Handle handle);
+
+/**
+ * \brief Function to wait for an asynchronous operation. With the PKA
+ *        interrupt enabled the caller pends until the interrupt wakes it,
+ *        otherwise the engine is polled.
+ *
+ * \param  handle  #AsymCrypt_Handle returned from #AsymCrypt_open()
+ *
+ * \param timeout Time to wait in system ticks, SystemP_NO_WAIT or SystemP_WAIT_FOREVER
+ *
+ * \return        #ASYM_CRYPT_RETURN_BUSY if the operation is still running after the timeout.
+ *                Result of the operation if it is done.
+ *                #ASYM_CRYPT_RETURN_FAILURE if no operation was started.
+ */
+AsymCrypt_Return_t AsymCrypt_wait(AsymCrypt_Handle handle, uint32_t timeout);
+
 #ifdef __cplusplus
 }
 #endif
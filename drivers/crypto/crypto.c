@@ -102,6 +102,7 @@ Crypto_Handle Crypto_open(Crypto_Context *ctx)
     }
     else
     {
+        SA2UL_Params_init(&prms);
         ctx->drvHandle = SA2UL_open(0,&prms);
 
         if(ctx->drvHandle == NULL)
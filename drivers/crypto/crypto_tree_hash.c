@@ -0,0 +1,530 @@
+/*
+ *  Copyright (C) 2024 Texas Instruments Incorporated
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  \file   crypto_tree_hash.c
+ *
+ *  \brief  This file contains the implementation of the tree hash
+ */
+
+/* ========================================================================== */
+/*                             Include Files                                  */
+/* ========================================================================== */
+
+#include <string.h>
+#include <kernel/dpl/SystemP.h>
+#include <kernel/dpl/CacheP.h>
+#include <security_common/drivers/crypto/crypto_tree_hash.h>
+
+/* ========================================================================== */
+/*                           Macros & Typedefs                                */
+/* ========================================================================== */
+
+/** Engine has no leaf */
+#define CRYPTO_TREE_HASH_LEAF_NONE          (0xFFFFFFFFU)
+
+/** Block size of the SHA-256 and of the SHA-512 family in bytes */
+#define CRYPTO_TREE_HASH_SHA256_BLOCK_BYTES (64U)
+#define CRYPTO_TREE_HASH_SHA512_BLOCK_BYTES (128U)
+
+/* ========================================================================== */
+/*                          Function Declarations                             */
+/* ========================================================================== */
+
+static int32_t Crypto_treeHashCheckParams(const Crypto_TreeHashParams *params, const uint8_t *ptrRoot);
+static int32_t Crypto_treeHashLeaves(const Crypto_TreeHashParams *params, uint32_t firstLeaf, uint32_t lastLeaf);
+static int32_t Crypto_treeHashRoot(const Crypto_TreeHashParams *params, uint8_t *ptrRoot);
+#if defined (SOC_AM263X) || defined (SOC_AM263PX) || defined (SOC_AM273X) || defined (SOC_AWR294X) || defined (SOC_AM261X)
+static int32_t Crypto_treeHashDtheStart(void *engineArgs, const uint8_t *ptrData, uint32_t dataLenBytes, uint8_t *ptrDigest);
+static int32_t Crypto_treeHashDthePoll(void *engineArgs);
+static void Crypto_treeHashDtheDone(DTHE_Handle handle, DTHE_JobToken token, DTHE_SHA_Return_t status, void *args);
+#endif
+#if defined (SOC_AM64X) || defined (SOC_AM243X)
+static int32_t Crypto_treeHashSa2ulStart(void *engineArgs, const uint8_t *ptrData, uint32_t dataLenBytes, uint8_t *ptrDigest);
+static int32_t Crypto_treeHashSa2ulPoll(void *engineArgs);
+#endif
+
+/* ========================================================================== */
+/*                          Function Definitions                              */
+/* ========================================================================== */
+
+uint32_t Crypto_treeHashNumLeaves(uint32_t dataLenBytes, uint32_t leafSizeBytes)
+{
+    uint32_t numLeaves = 0U;
+
+    if (leafSizeBytes != 0U)
+    {
+        numLeaves = (dataLenBytes / leafSizeBytes) + (((dataLenBytes % leafSizeBytes) != 0U) ? 1U : 0U);
+    }
+
+    return (numLeaves);
+}
+
+int32_t Crypto_treeHash(const Crypto_TreeHashParams *params, uint8_t *ptrRoot)
+{
+    int32_t status = Crypto_treeHashCheckParams(params, ptrRoot);
+
+    if (SystemP_SUCCESS == status)
+    {
+        status = Crypto_treeHashLeaves(params, 0U, Crypto_treeHashNumLeaves(params->dataLenBytes, params->leafSizeBytes) - 1U);
+    }
+
+    if (SystemP_SUCCESS == status)
+    {
+        status = Crypto_treeHashRoot(params, ptrRoot);
+    }
+
+    return (status);
+}
+
+int32_t Crypto_treeHashUpdate(const Crypto_TreeHashParams *params, uint32_t offset, uint32_t length, uint8_t *ptrRoot)
+{
+    int32_t  status = Crypto_treeHashCheckParams(params, ptrRoot);
+    uint32_t lastLeaf;
+
+    if ((SystemP_SUCCESS == status) && (length != 0U))
+    {
+        if ((offset >= params->dataLenBytes) || (length > (params->dataLenBytes - offset)))
+        {
+            status = SystemP_FAILURE;
+        }
+        else
+        {
+            /* Hash the leaves which overlap the changed region again */
+            lastLeaf = (offset + length - 1U) / params->leafSizeBytes;
+            status   = Crypto_treeHashLeaves(params, offset / params->leafSizeBytes, lastLeaf);
+        }
+    }
+
+    if (SystemP_SUCCESS == status)
+    {
+        status = Crypto_treeHashRoot(params, ptrRoot);
+    }
+
+    return (status);
+}
+
+#if defined (SOC_AM263X) || defined (SOC_AM263PX) || defined (SOC_AM273X) || defined (SOC_AWR294X) || defined (SOC_AM261X)
+void Crypto_treeHashDtheEngine(Crypto_TreeHashEngine *engine, Crypto_TreeHashDtheEngine *dtheEngine)
+{
+    if ((NULL != engine) && (NULL != dtheEngine))
+    {
+        engine->startFxn    = &Crypto_treeHashDtheStart;
+        engine->pollFxn     = &Crypto_treeHashDthePoll;
+        engine->engineArgs  = (void *)dtheEngine;
+
+        if (dtheEngine->algoType == DTHE_SHA_ALGO_SHA256)
+        {
+            dtheEngine->digestSizeBytes = 32U;
+        }
+        else if (dtheEngine->algoType == DTHE_SHA_ALGO_SHA384)
+        {
+            dtheEngine->digestSizeBytes = 48U;
+        }
+        else
+        {
+            dtheEngine->digestSizeBytes = DTHE_SHA_MAX_DIGEST_SIZE_BYTES;
+        }
+    }
+
+    return;
+}
+#endif
+
+#if defined (SOC_AM64X) || defined (SOC_AM243X)
+void Crypto_treeHashSa2ulEngine(Crypto_TreeHashEngine *engine, Crypto_TreeHashSa2ulEngine *sa2ulEngine)
+{
+    if ((NULL != engine) && (NULL != sa2ulEngine))
+    {
+        engine->startFxn    = &Crypto_treeHashSa2ulStart;
+        engine->pollFxn     = &Crypto_treeHashSa2ulPoll;
+        engine->engineArgs  = (void *)sa2ulEngine;
+
+        if (sa2ulEngine->hashAlg == SA2UL_HASH_ALG_SHA1)
+        {
+            sa2ulEngine->digestSizeBytes = 20U;
+        }
+        else if (sa2ulEngine->hashAlg == SA2UL_HASH_ALG_SHA2_256)
+        {
+            sa2ulEngine->digestSizeBytes = 32U;
+        }
+        else
+        {
+            sa2ulEngine->digestSizeBytes = SA2UL_MAX_HASH_SIZE_BYTES;
+        }
+    }
+
+    return;
+}
+#endif
+
+/* ========================================================================== */
+/*                     Internal Function Definitions                          */
+/* ========================================================================== */
+
+/**
+ * \brief               Function to check the parameters of a tree hash.
+ *
+ * \param params        Parameters of the tree hash.
+ *
+ * \param ptrRoot       Buffer for the root digest.
+ *
+ * \return              SystemP_SUCCESS if the parameters are valid, SystemP_FAILURE otherwise.
+ *                      More than one DTHE engine, a leaf longer than one DTHE job, or an
+ *                      adapter whose digest size is not digestSizeBytes is not valid.
+ */
+static int32_t Crypto_treeHashCheckParams(const Crypto_TreeHashParams *params, const uint8_t *ptrRoot)
+{
+    int32_t  status = SystemP_FAILURE;
+    uint32_t index;
+#if defined (SOC_AM263X) || defined (SOC_AM263PX) || defined (SOC_AM273X) || defined (SOC_AWR294X) || defined (SOC_AM261X)
+    uint32_t numDtheEngines = 0U;
+    const Crypto_TreeHashDtheEngine *dtheEngine;
+    uint32_t blockSizeBytes;
+#endif
+#if defined (SOC_AM64X) || defined (SOC_AM243X)
+    const Crypto_TreeHashSa2ulEngine *sa2ulEngine;
+#endif
+
+    if ((NULL != params) && (NULL != ptrRoot) && (NULL != params->ptrData) && (params->dataLenBytes != 0U) &&
+        (params->leafSizeBytes != 0U) && (params->digestSizeBytes != 0U) &&
+        (params->digestSizeBytes <= CRYPTO_TREE_HASH_MAX_DIGEST_SIZE_BYTES) && (NULL != params->ptrLeafTable) &&
+        (NULL != params->ptrEngines) && (params->numEngines != 0U) && (params->numEngines <= CRYPTO_TREE_HASH_MAX_ENGINES))
+    {
+        status = SystemP_SUCCESS;
+        for (index = 0U; index < params->numEngines; index++)
+        {
+            if ((NULL == params->ptrEngines[index].startFxn) || (NULL == params->ptrEngines[index].pollFxn))
+            {
+                status = SystemP_FAILURE;
+            }
+#if defined (SOC_AM263X) || defined (SOC_AM263PX) || defined (SOC_AM273X) || defined (SOC_AWR294X) || defined (SOC_AM261X)
+            if (params->ptrEngines[index].startFxn == &Crypto_treeHashDtheStart)
+            {
+                numDtheEngines++;
+
+                /* A leaf is one job, whose DMA moves a bounded number of blocks */
+                dtheEngine = (const Crypto_TreeHashDtheEngine *)params->ptrEngines[index].engineArgs;
+                blockSizeBytes = (dtheEngine->algoType == DTHE_SHA_ALGO_SHA256) ?
+                                 CRYPTO_TREE_HASH_SHA256_BLOCK_BYTES : CRYPTO_TREE_HASH_SHA512_BLOCK_BYTES;
+                if ((dtheEngine->digestSizeBytes != params->digestSizeBytes) ||
+                    ((params->leafSizeBytes / blockSizeBytes) > DTHE_JOB_MAX_BLOCKS))
+                {
+                    status = SystemP_FAILURE;
+                }
+            }
+#endif
+#if defined (SOC_AM64X) || defined (SOC_AM243X)
+            if (params->ptrEngines[index].startFxn == &Crypto_treeHashSa2ulStart)
+            {
+                sa2ulEngine = (const Crypto_TreeHashSa2ulEngine *)params->ptrEngines[index].engineArgs;
+                if (sa2ulEngine->digestSizeBytes != params->digestSizeBytes)
+                {
+                    status = SystemP_FAILURE;
+                }
+            }
+#endif
+        }
+#if defined (SOC_AM263X) || defined (SOC_AM263PX) || defined (SOC_AM273X) || defined (SOC_AWR294X) || defined (SOC_AM261X)
+        /* The DTHE SHA runs one asynchronous job at a time */
+        if (numDtheEngines > 1U)
+        {
+            status = SystemP_FAILURE;
+        }
+#endif
+    }
+
+    return (status);
+}
+
+/**
+ * \brief               Function to hash a range of leaves. Every engine which is free is given the
+ *                      next leaf, so asynchronous engines work while the CPU drives the synchronous ones.
+ *
+ * \param params        Parameters of the tree hash.
+ *
+ * \param firstLeaf     Index of the first leaf.
+ *
+ * \param lastLeaf      Index of the last leaf.
+ *
+ * \return              SystemP_SUCCESS if all the leaves are hashed, SystemP_FAILURE otherwise.
+ */
+static int32_t Crypto_treeHashLeaves(const Crypto_TreeHashParams *params, uint32_t firstLeaf, uint32_t lastLeaf)
+{
+    int32_t                     status = SystemP_SUCCESS;
+    int32_t                     engineStatus;
+    uint32_t                    busyLeaf[CRYPTO_TREE_HASH_MAX_ENGINES];
+    uint32_t                    numBusy = 0U;
+    uint32_t                    nextLeaf = firstLeaf;
+    uint32_t                    leafOffset;
+    uint32_t                    leafLen;
+    uint32_t                    index;
+    const Crypto_TreeHashEngine *engine;
+
+    for (index = 0U; index < params->numEngines; index++)
+    {
+        busyLeaf[index] = CRYPTO_TREE_HASH_LEAF_NONE;
+    }
+
+    /* On a failure no new leaves are started, but the running ones are waited for */
+    while (((SystemP_SUCCESS == status) && (nextLeaf <= lastLeaf)) || (numBusy != 0U))
+    {
+        for (index = 0U; index < params->numEngines; index++)
+        {
+            engine = &params->ptrEngines[index];
+
+            if (busyLeaf[index] != CRYPTO_TREE_HASH_LEAF_NONE)
+            {
+                engineStatus = engine->pollFxn(engine->engineArgs);
+                if (engineStatus != SystemP_TIMEOUT)
+                {
+                    busyLeaf[index] = CRYPTO_TREE_HASH_LEAF_NONE;
+                    numBusy--;
+                    if (engineStatus != SystemP_SUCCESS)
+                    {
+                        status = SystemP_FAILURE;
+                    }
+                }
+            }
+
+            if ((SystemP_SUCCESS == status) && (busyLeaf[index] == CRYPTO_TREE_HASH_LEAF_NONE) && (nextLeaf <= lastLeaf))
+            {
+                leafOffset  = nextLeaf * params->leafSizeBytes;
+                leafLen     = params->dataLenBytes - leafOffset;
+                if (leafLen > params->leafSizeBytes)
+                {
+                    leafLen = params->leafSizeBytes;
+                }
+
+                if (engine->startFxn(engine->engineArgs, &params->ptrData[leafOffset], leafLen,
+                                     &params->ptrLeafTable[nextLeaf * params->digestSizeBytes]) == SystemP_SUCCESS)
+                {
+                    busyLeaf[index] = nextLeaf;
+                    numBusy++;
+                    nextLeaf++;
+                }
+                else
+                {
+                    status = SystemP_FAILURE;
+                }
+            }
+        }
+    }
+
+    return (status);
+}
+
+/**
+ * \brief               Function to hash the leaf table into the root on the first engine.
+ *
+ * \param params        Parameters of the tree hash.
+ *
+ * \param ptrRoot       Buffer for the root digest.
+ *
+ * \return              SystemP_SUCCESS on success, SystemP_FAILURE otherwise.
+ */
+static int32_t Crypto_treeHashRoot(const Crypto_TreeHashParams *params, uint8_t *ptrRoot)
+{
+    int32_t                     status;
+    uint32_t                    tableLenBytes;
+    const Crypto_TreeHashEngine *engine = &params->ptrEngines[0U];
+
+    /* The leaf digests were written by the CPU, the engine may read the table by DMA */
+    tableLenBytes = Crypto_treeHashNumLeaves(params->dataLenBytes, params->leafSizeBytes) * params->digestSizeBytes;
+    CacheP_wb((void *)params->ptrLeafTable, tableLenBytes, CacheP_TYPE_ALLD);
+
+    status = engine->startFxn(engine->engineArgs, params->ptrLeafTable, tableLenBytes, ptrRoot);
+    if (SystemP_SUCCESS == status)
+    {
+        do
+        {
+            status = engine->pollFxn(engine->engineArgs);
+        } while (status == SystemP_TIMEOUT);
+    }
+
+    return (status);
+}
+
+#if defined (SOC_AM263X) || defined (SOC_AM263PX) || defined (SOC_AM273X) || defined (SOC_AWR294X) || defined (SOC_AM261X)
+/**
+ * \brief               Function to start a leaf as an asynchronous DTHE SHA job.
+ *
+ * \param engineArgs    Pointer to the #Crypto_TreeHashDtheEngine.
+ *
+ * \param ptrData       Pointer to the leaf data.
+ *
+ * \param dataLenBytes  Length of the leaf in bytes.
+ *
+ * \param ptrDigest     Buffer for the leaf digest.
+ *
+ * \return              SystemP_SUCCESS if the job is started, SystemP_FAILURE otherwise.
+ */
+static int32_t Crypto_treeHashDtheStart(void *engineArgs, const uint8_t *ptrData, uint32_t dataLenBytes, uint8_t *ptrDigest)
+{
+    int32_t                     status = SystemP_FAILURE;
+    Crypto_TreeHashDtheEngine   *dtheEngine = (Crypto_TreeHashDtheEngine *)engineArgs;
+
+    DTHE_SHA_Context_init(&dtheEngine->context);
+    (void)memset((void *)&dtheEngine->shaParams, 0, sizeof(dtheEngine->shaParams));
+    dtheEngine->shaParams.algoType      = dtheEngine->algoType;
+    dtheEngine->shaParams.ptrDataBuffer = (uint32_t *)ptrData;
+    dtheEngine->shaParams.dataLenBytes  = dataLenBytes;
+    dtheEngine->shaParams.ptrContext    = &dtheEngine->context;
+    dtheEngine->ptrDigest               = ptrDigest;
+    dtheEngine->isDone                  = 0U;
+    dtheEngine->jobStatus               = DTHE_SHA_RETURN_SUCCESS;
+
+    /* The leaf is read by the DMA */
+    CacheP_wb((void *)ptrData, dataLenBytes, CacheP_TYPE_ALLD);
+
+    if (DTHE_SHA_submit(dtheEngine->handle, &dtheEngine->shaParams, TRUE, &Crypto_treeHashDtheDone,
+                        (void *)dtheEngine, &dtheEngine->token) == DTHE_SHA_RETURN_SUCCESS)
+    {
+        status = SystemP_SUCCESS;
+    }
+
+    return (status);
+}
+
+/**
+ * \brief               Function to check if the DTHE SHA job of a leaf is done.
+ *
+ * \param engineArgs    Pointer to the #Crypto_TreeHashDtheEngine.
+ *
+ * \return              SystemP_SUCCESS, SystemP_TIMEOUT or SystemP_FAILURE.
+ */
+static int32_t Crypto_treeHashDthePoll(void *engineArgs)
+{
+    int32_t                     status = SystemP_TIMEOUT;
+    Crypto_TreeHashDtheEngine   *dtheEngine = (Crypto_TreeHashDtheEngine *)engineArgs;
+
+    if (dtheEngine->isDone != 0U)
+    {
+        /* The wait finishes the job and returns its result */
+        if ((DTHE_SHA_wait(dtheEngine->handle, dtheEngine->token, SystemP_NO_WAIT) == DTHE_SHA_RETURN_SUCCESS) &&
+            (dtheEngine->jobStatus == DTHE_SHA_RETURN_SUCCESS))
+        {
+            (void)memcpy((void *)dtheEngine->ptrDigest, (const void *)&dtheEngine->shaParams.digest[0U],
+                         dtheEngine->digestSizeBytes);
+            status = SystemP_SUCCESS;
+        }
+        else
+        {
+            status = SystemP_FAILURE;
+        }
+    }
+
+    return (status);
+}
+
+/**
+ * \brief               Completion callback of the DTHE SHA job of a leaf.
+ *
+ * \param handle        DTHE handle.
+ *
+ * \param token         Token of the job.
+ *
+ * \param status        Status of the job, a failure fails the leaf.
+ *
+ * \param args          Pointer to the #Crypto_TreeHashDtheEngine.
+ */
+static void Crypto_treeHashDtheDone(DTHE_Handle handle, DTHE_JobToken token, DTHE_SHA_Return_t status, void *args)
+{
+    Crypto_TreeHashDtheEngine   *dtheEngine = (Crypto_TreeHashDtheEngine *)args;
+
+    (void)handle;
+    (void)token;
+
+    dtheEngine->jobStatus = status;
+    dtheEngine->isDone    = 1U;
+
+    return;
+}
+#endif
+
+#if defined (SOC_AM64X) || defined (SOC_AM243X)
+/**
+ * \brief               Function to hash a leaf on SA2UL. The leaf is done when the function returns.
+ *
+ * \param engineArgs    Pointer to the #Crypto_TreeHashSa2ulEngine.
+ *
+ * \param ptrData       Pointer to the leaf data.
+ *
+ * \param dataLenBytes  Length of the leaf in bytes.
+ *
+ * \param ptrDigest     Buffer for the leaf digest.
+ *
+ * \return              SystemP_SUCCESS if the leaf is hashed, SystemP_FAILURE otherwise.
+ */
+static int32_t Crypto_treeHashSa2ulStart(void *engineArgs, const uint8_t *ptrData, uint32_t dataLenBytes, uint8_t *ptrDigest)
+{
+    Crypto_TreeHashSa2ulEngine  *sa2ulEngine = (Crypto_TreeHashSa2ulEngine *)engineArgs;
+    SA2UL_ContextParams         ctxPrms;
+    SA2UL_Fragment              frag;
+
+    (void)memset((void *)&ctxPrms, 0, sizeof(ctxPrms));
+    ctxPrms.opType      = SA2UL_OP_AUTH;
+    ctxPrms.hashAlg     = sa2ulEngine->hashAlg;
+    ctxPrms.inputLen    = dataLenBytes;
+
+    sa2ulEngine->status = SA2UL_contextAlloc(sa2ulEngine->handle, &sa2ulEngine->ctxObj, &ctxPrms);
+    if (SystemP_SUCCESS == sa2ulEngine->status)
+    {
+        /* The leaf is only read, the data the engine returns goes into its scratch buffer */
+        frag.addr = ptrData;
+        frag.len  = dataLenBytes;
+        sa2ulEngine->status = SA2UL_contextProcessGather(&sa2ulEngine->ctxObj, &frag, 1U);
+        if (SystemP_SUCCESS == sa2ulEngine->status)
+        {
+            (void)memcpy((void *)ptrDigest, (const void *)&sa2ulEngine->ctxObj.computedHash[0U],
+                         sa2ulEngine->digestSizeBytes);
+        }
+        (void)SA2UL_contextFree(&sa2ulEngine->ctxObj);
+    }
+
+    return ((SystemP_SUCCESS == sa2ulEngine->status) ? SystemP_SUCCESS : SystemP_FAILURE);
+}
+
+/**
+ * \brief               Function to get the result of the last leaf hashed on SA2UL.
+ *
+ * \param engineArgs    Pointer to the #Crypto_TreeHashSa2ulEngine.
+ *
+ * \return              SystemP_SUCCESS or SystemP_FAILURE.
+ */
+static int32_t Crypto_treeHashSa2ulPoll(void *engineArgs)
+{
+    const Crypto_TreeHashSa2ulEngine *sa2ulEngine = (const Crypto_TreeHashSa2ulEngine *)engineArgs;
+
+    return ((SystemP_SUCCESS == sa2ulEngine->status) ? SystemP_SUCCESS : SystemP_FAILURE);
+}
+#endif
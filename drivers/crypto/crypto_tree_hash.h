@@ -0,0 +1,269 @@
+/*
+ *  Copyright (C) 2024 Texas Instruments Incorporated
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  \defgroup SECURITY_CRYPTO_TREE_HASH_MODULE APIs for tree hashing
+ *  \ingroup  SECURITY_MODULE
+ *
+ *  This module contains APIs to hash a large image as a two level hash tree.
+ *  The image is split into leaves of a fixed size, the leaves are hashed on all
+ *  the hash engines given by the caller at the same time, and the root is the
+ *  hash of the table of leaf digests. The table is returned to the caller, so a
+ *  later check of a partly changed image only hashes the changed leaves again.
+ *
+ *  The engines are described by #Crypto_TreeHashEngine. Adapters are provided
+ *  for the DTHE SHA (asynchronous, DMA driven) and for SA2UL (synchronous) on
+ *  the SoCs which have them; other engines, for example a software hash on a
+ *  host build, can be plugged in by the caller. All the engines must compute
+ *  the same hash algorithm. No SoC has both the DTHE and SA2UL, and the DTHE
+ *  SHA runs one job at a time, so a tree hash takes at most one DTHE engine:
+ *  its leaves are hashed by DMA while the CPU drives the other engines.
+ *
+ *  @{
+ */
+
+/**
+ *  \file crypto_tree_hash.h
+ *
+ *  \brief This file contains the prototype of the tree hash APIs
+ */
+
+#ifndef CRYPTO_TREE_HASH_H_
+#define CRYPTO_TREE_HASH_H_
+
+/* ========================================================================== */
+/*                             Include Files                                  */
+/* ========================================================================== */
+#include <stdint.h>
+#if defined (SOC_AM263X) || defined (SOC_AM263PX) || defined (SOC_AM273X) || defined (SOC_AWR294X) || defined (SOC_AM261X)
+#include <security_common/drivers/crypto/dthe/dthe_sha.h>
+#endif
+#if defined (SOC_AM64X) || defined (SOC_AM243X)
+#include <security_common/drivers/crypto/sa2ul/sa2ul.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================== */
+/*                           Macros & Typedefs                                */
+/* ========================================================================== */
+
+/** \brief Maximum number of engines a tree hash runs on */
+#define CRYPTO_TREE_HASH_MAX_ENGINES            (4U)
+
+/** \brief Maximum digest size in bytes */
+#define CRYPTO_TREE_HASH_MAX_DIGEST_SIZE_BYTES  (64U)
+
+/**
+ * \brief               Function which starts hashing one leaf on an engine. A synchronous engine
+ *                      hashes the leaf before it returns.
+ *
+ * \param engineArgs    Engine specific argument of #Crypto_TreeHashEngine.
+ *
+ * \param ptrData       Pointer to the leaf data.
+ *
+ * \param dataLenBytes  Length of the leaf in bytes.
+ *
+ * \param ptrDigest     Buffer for the leaf digest. It is written when the engine is done.
+ *
+ * \return              SystemP_SUCCESS if the leaf is started, SystemP_FAILURE otherwise.
+ */
+typedef int32_t (*Crypto_TreeHashStartFxn)(void *engineArgs, const uint8_t *ptrData, uint32_t dataLenBytes, uint8_t *ptrDigest);
+
+/**
+ * \brief               Function which checks if an engine is done with the leaf it was given.
+ *
+ * \param engineArgs    Engine specific argument of #Crypto_TreeHashEngine.
+ *
+ * \return              SystemP_SUCCESS if the leaf digest is written,
+ *                      SystemP_TIMEOUT if the engine is still busy,
+ *                      SystemP_FAILURE if the leaf could not be hashed.
+ */
+typedef int32_t (*Crypto_TreeHashPollFxn)(void *engineArgs);
+
+/* ========================================================================== */
+/*                         Structure Declarations                             */
+/* ========================================================================== */
+
+/** \brief Hash engine used by a tree hash */
+typedef struct
+{
+    Crypto_TreeHashStartFxn startFxn;
+    /**< Starts hashing a leaf */
+    Crypto_TreeHashPollFxn  pollFxn;
+    /**< Checks if the leaf is done */
+    void                    *engineArgs;
+    /**< Engine specific argument passed to the functions */
+} Crypto_TreeHashEngine;
+
+/** \brief Parameters of a tree hash */
+typedef struct
+{
+    const uint8_t               *ptrData;
+    /**< Pointer to the image. Some engines need it to be word aligned */
+    uint32_t                    dataLenBytes;
+    /**< Length of the image in bytes */
+    uint32_t                    leafSizeBytes;
+    /**< Size of a leaf in bytes, the last leaf may be shorter. Some engines need a word multiple */
+    uint32_t                    digestSizeBytes;
+    /**< Digest size of the hash algorithm in bytes */
+    uint8_t                     *ptrLeafTable;
+    /**< Table of leaf digests, #Crypto_treeHashNumLeaves times digestSizeBytes long */
+    const Crypto_TreeHashEngine *ptrEngines;
+    /**< Engines to hash on; the first one also hashes the leaf table */
+    uint32_t                    numEngines;
+    /**< Number of engines, up to #CRYPTO_TREE_HASH_MAX_ENGINES */
+} Crypto_TreeHashParams;
+
+#if defined (SOC_AM263X) || defined (SOC_AM263PX) || defined (SOC_AM273X) || defined (SOC_AWR294X) || defined (SOC_AM261X)
+/**
+ * \brief Engine argument of the DTHE SHA adapter. handle and algoType are set by the
+ *        caller, the rest is internal. DMA must be enabled for the handle.
+ */
+typedef struct
+{
+    DTHE_Handle             handle;
+    /**< DTHE handle returned from #DTHE_open() */
+    uint32_t                algoType;
+    /**< SHA algorithm */
+    DTHE_SHA_Context        context;
+    /**< Context of the leaf hash */
+    DTHE_SHA_Params         shaParams;
+    /**< Parameters of the leaf hash */
+    DTHE_JobToken           token;
+    /**< Token of the running job */
+    uint8_t                 *ptrDigest;
+    /**< Digest buffer of the running leaf */
+    uint32_t                digestSizeBytes;
+    /**< Digest size of the algorithm */
+    volatile uint32_t       isDone;
+    /**< Set by the job callback */
+    volatile DTHE_SHA_Return_t jobStatus;
+    /**< Status given to the job callback */
+} Crypto_TreeHashDtheEngine;
+#endif
+
+#if defined (SOC_AM64X) || defined (SOC_AM243X)
+/**
+ * \brief Engine argument of the SA2UL adapter. handle and hashAlg are set by the caller,
+ *        the rest is internal. A context is allocated for every leaf. The leaf data is
+ *        only read, the data the engine returns goes into the scratch buffer of the instance.
+ */
+typedef struct
+{
+    SA2UL_Handle            handle;
+    /**< SA2UL handle returned from #SA2UL_open() */
+    uint8_t                 hashAlg;
+    /**< Hash algorithm, refer \ref SA2UL_AlgoTypes */
+    SA2UL_ContextObject     ctxObj;
+    /**< Context of the leaf hash */
+    uint32_t                digestSizeBytes;
+    /**< Digest size of the algorithm */
+    int32_t                 status;
+    /**< Result of the last leaf */
+} Crypto_TreeHashSa2ulEngine;
+#endif
+
+/* ========================================================================== */
+/*                          Function Declarations                             */
+/* ========================================================================== */
+
+/**
+ * \brief               Function to get the number of leaves of an image.
+ *
+ * \param dataLenBytes  Length of the image in bytes.
+ *
+ * \param leafSizeBytes Size of a leaf in bytes.
+ *
+ * \return              Number of leaves.
+ */
+uint32_t Crypto_treeHashNumLeaves(uint32_t dataLenBytes, uint32_t leafSizeBytes);
+
+/**
+ * \brief               Function to hash an image as a tree. All the leaves are hashed into the
+ *                      leaf table and the root is computed from the table.
+ *
+ * \param params        Parameters of the tree hash.
+ *
+ * \param ptrRoot       Buffer for the root digest, digestSizeBytes long.
+ *
+ * \return              SystemP_SUCCESS on success, SystemP_FAILURE otherwise.
+ */
+int32_t Crypto_treeHash(const Crypto_TreeHashParams *params, uint8_t *ptrRoot);
+
+/**
+ * \brief               Function to update the tree hash of an image of which a region changed.
+ *                      Only the leaves which overlap the region are hashed again; the rest of the
+ *                      leaf table must hold the digests of an earlier #Crypto_treeHash.
+ *
+ * \param params        Parameters of the tree hash, with the leaf table of the earlier hash.
+ *
+ * \param offset        Offset of the changed region in the image.
+ *
+ * \param length        Length of the changed region in bytes.
+ *
+ * \param ptrRoot       Buffer for the root digest, digestSizeBytes long.
+ *
+ * \return              SystemP_SUCCESS on success, SystemP_FAILURE otherwise.
+ */
+int32_t Crypto_treeHashUpdate(const Crypto_TreeHashParams *params, uint32_t offset, uint32_t length, uint8_t *ptrRoot);
+
+#if defined (SOC_AM263X) || defined (SOC_AM263PX) || defined (SOC_AM273X) || defined (SOC_AWR294X) || defined (SOC_AM261X)
+/**
+ * \brief               Function to set up a tree hash engine on the DTHE SHA.
+ *
+ * \param engine        Engine to set up.
+ *
+ * \param dtheEngine    Engine argument, with handle and algoType set. It must stay valid while the engine is used.
+ */
+void Crypto_treeHashDtheEngine(Crypto_TreeHashEngine *engine, Crypto_TreeHashDtheEngine *dtheEngine);
+#endif
+
+#if defined (SOC_AM64X) || defined (SOC_AM243X)
+/**
+ * \brief               Function to set up a tree hash engine on SA2UL.
+ *
+ * \param engine        Engine to set up.
+ *
+ * \param sa2ulEngine   Engine argument, with handle and hashAlg set. It must stay valid while the engine is used.
+ */
+void Crypto_treeHashSa2ulEngine(Crypto_TreeHashEngine *engine, Crypto_TreeHashSa2ulEngine *sa2ulEngine);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRYPTO_TREE_HASH_H_ */
+/** @} */
@@ -106,7 +106,7 @@ DMA_Return_t DMA_Config_TxChannel(DMA_Handle handle, uint32_t *srcAddress, uint3
     return (dmaStatus);
 }
 
-DMA_Return_t DMA_enableTxTransferRegion(DMA_Handle handle)
+DMA_Return_t DMA_enableTxTransferRegion(DMA_Handle handle, int32_t operationType)
 {
     DMA_Return_t dmaStatus = DMA_RETURN_FAILURE;
     int32_t dmaModuleStatus = SystemP_FAILURE;
@@ -118,7 +118,7 @@ DMA_Return_t DMA_enableTxTransferRegion(DMA_Handle handle)
         if(config && config->dmaFxns && config->dmaFxns->enableTxTransferRegionFxn)
         {
 
-            dmaModuleStatus = config->dmaFxns->enableTxTransferRegionFxn(config->dmaHandle);
+            dmaModuleStatus = config->dmaFxns->enableTxTransferRegionFxn(config->dmaHandle, operationType);
         }
     }
 
@@ -138,7 +138,7 @@ DMA_Return_t DMA_enableTxTransferRegion(DMA_Handle handle)
     return (dmaStatus);
 }
 
-DMA_Return_t DMA_WaitForTxTransfer(DMA_Handle handle)
+DMA_Return_t DMA_WaitForTxTransfer(DMA_Handle handle, int32_t operationType)
 {
     DMA_Return_t dmaStatus = DMA_RETURN_FAILURE;
     int32_t dmaModuleStatus = SystemP_FAILURE;
@@ -149,7 +149,7 @@ DMA_Return_t DMA_WaitForTxTransfer(DMA_Handle handle)
 
         if(config && config->dmaFxns && config->dmaFxns->waitForTxTranferFxn)
         {
-            dmaModuleStatus = config->dmaFxns->waitForTxTranferFxn(config->dmaHandle);
+            dmaModuleStatus = config->dmaFxns->waitForTxTranferFxn(config->dmaHandle, operationType);
         }
     }
 
@@ -169,7 +169,7 @@ DMA_Return_t DMA_WaitForTxTransfer(DMA_Handle handle)
     return (dmaStatus);
 }
 
-DMA_Return_t DMA_disableTxCh(DMA_Handle handle)
+DMA_Return_t DMA_disableTxCh(DMA_Handle handle, int32_t operationType)
 {
     DMA_Return_t dmaStatus = DMA_RETURN_FAILURE;
     int32_t dmaModuleStatus = SystemP_FAILURE;
@@ -181,7 +181,7 @@ DMA_Return_t DMA_disableTxCh(DMA_Handle handle)
         if(config && config->dmaFxns && config->dmaFxns->enableRxTransferRegionFxn)
         {
 
-            dmaModuleStatus = config->dmaFxns->disableTxChFxn(config->dmaHandle);
+            dmaModuleStatus = config->dmaFxns->disableTxChFxn(config->dmaHandle, operationType);
         }
     }
 
@@ -326,6 +326,58 @@ DMA_Return_t DMA_disableRxCh(DMA_Handle handle)
     return (dmaStatus);
 }
 
+DMA_Return_t DMA_Config_TxSgChannel(DMA_Handle handle, const DMA_SgEntry *sgList, uint32_t numEntries, uint32_t *dstAddress, uint16_t blockSize, int32_t operationType)
+{
+    DMA_Return_t dmaStatus = DMA_RETURN_FAILURE;
+    int32_t dmaModuleStatus = SystemP_FAILURE;
+
+    if((handle != NULL) && (sgList != NULL) && (numEntries != 0U) && (numEntries <= DMA_MAX_SG_ENTRIES))
+    {
+        DMA_Config  *config = (DMA_Config *) handle;
+        if(config && config->dmaFxns && config->dmaFxns->cfgDmaTxSgChFxn)
+        {
+            dmaModuleStatus = config->dmaFxns->cfgDmaTxSgChFxn(config->dmaHandle, sgList, numEntries, dstAddress, blockSize, operationType);
+        }
+    }
+
+    if (dmaModuleStatus == SystemP_SUCCESS)
+    {
+        dmaStatus = DMA_RETURN_SUCCESS;
+    }
+    else
+    {
+        dmaStatus = DMA_RETURN_FAILURE;
+    }
+
+    return (dmaStatus);
+}
+
+DMA_Return_t DMA_Config_RxSgChannel(DMA_Handle handle, uint32_t *srcAddress, const DMA_SgEntry *sgList, uint32_t numEntries)
+{
+    DMA_Return_t dmaStatus = DMA_RETURN_FAILURE;
+    int32_t dmaModuleStatus = SystemP_FAILURE;
+
+    if((handle != NULL) && (sgList != NULL) && (numEntries != 0U) && (numEntries <= DMA_MAX_SG_ENTRIES))
+    {
+        DMA_Config  *config = (DMA_Config *) handle;
+        if(config && config->dmaFxns && config->dmaFxns->cfgDmaRxSgChFxn)
+        {
+            dmaModuleStatus = config->dmaFxns->cfgDmaRxSgChFxn(config->dmaHandle, srcAddress, sgList, numEntries);
+        }
+    }
+
+    if (dmaModuleStatus == SystemP_SUCCESS)
+    {
+        dmaStatus = DMA_RETURN_SUCCESS;
+    }
+    else
+    {
+        dmaStatus = DMA_RETURN_FAILURE;
+    }
+
+    return (dmaStatus);
+}
+
 DMA_Return_t DMA_close(DMA_Handle handle)
 {
     DMA_Return_t dmaStatus = DMA_RETURN_FAILURE;
@@ -337,3 +389,107 @@ DMA_Return_t DMA_close(DMA_Handle handle)
     }
     return (dmaStatus);
 }
+
+DMA_Return_t DMA_registerTxCallback(DMA_Handle handle, DMA_TransferCallback callback, void *args, int32_t operationType)
+{
+    DMA_Return_t dmaStatus = DMA_RETURN_FAILURE;
+    int32_t dmaModuleStatus = SystemP_FAILURE;
+
+    if((handle != NULL) && (callback != NULL))
+    {
+        DMA_Config  *config = (DMA_Config *) handle;
+        if(config && config->dmaFxns && config->dmaFxns->registerTxCallbackFxn)
+        {
+            dmaModuleStatus = config->dmaFxns->registerTxCallbackFxn(config->dmaHandle, callback, args, operationType);
+        }
+    }
+
+    if (dmaModuleStatus == SystemP_SUCCESS)
+    {
+        dmaStatus = DMA_RETURN_SUCCESS;
+    }
+    else
+    {
+        dmaStatus = DMA_RETURN_FAILURE;
+    }
+
+    return (dmaStatus);
+}
+
+DMA_Return_t DMA_registerRxCallback(DMA_Handle handle, DMA_TransferCallback callback, void *args)
+{
+    DMA_Return_t dmaStatus = DMA_RETURN_FAILURE;
+    int32_t dmaModuleStatus = SystemP_FAILURE;
+
+    if((handle != NULL) && (callback != NULL))
+    {
+        DMA_Config  *config = (DMA_Config *) handle;
+        if(config && config->dmaFxns && config->dmaFxns->registerRxCallbackFxn)
+        {
+            dmaModuleStatus = config->dmaFxns->registerRxCallbackFxn(config->dmaHandle, callback, args);
+        }
+    }
+
+    if (dmaModuleStatus == SystemP_SUCCESS)
+    {
+        dmaStatus = DMA_RETURN_SUCCESS;
+    }
+    else
+    {
+        dmaStatus = DMA_RETURN_FAILURE;
+    }
+
+    return (dmaStatus);
+}
+
+DMA_Return_t DMA_openChannels(DMA_Handle handle)
+{
+    DMA_Return_t dmaStatus = DMA_RETURN_FAILURE;
+    int32_t dmaModuleStatus = SystemP_FAILURE;
+
+    if(handle != NULL)
+    {
+        DMA_Config  *config = (DMA_Config *) handle;
+        if(config && config->dmaFxns && config->dmaFxns->openChannelsFxn)
+        {
+            dmaModuleStatus = config->dmaFxns->openChannelsFxn(config->dmaHandle);
+        }
+    }
+
+    if (dmaModuleStatus == SystemP_SUCCESS)
+    {
+        dmaStatus = DMA_RETURN_SUCCESS;
+    }
+    else
+    {
+        dmaStatus = DMA_RETURN_FAILURE;
+    }
+
+    return (dmaStatus);
+}
+
+DMA_Return_t DMA_closeChannels(DMA_Handle handle)
+{
+    DMA_Return_t dmaStatus = DMA_RETURN_FAILURE;
+    int32_t dmaModuleStatus = SystemP_FAILURE;
+
+    if(handle != NULL)
+    {
+        DMA_Config  *config = (DMA_Config *) handle;
+        if(config && config->dmaFxns && config->dmaFxns->closeChannelsFxn)
+        {
+            dmaModuleStatus = config->dmaFxns->closeChannelsFxn(config->dmaHandle);
+        }
+    }
+
+    if (dmaModuleStatus == SystemP_SUCCESS)
+    {
+        dmaStatus = DMA_RETURN_SUCCESS;
+    }
+    else
+    {
+        dmaStatus = DMA_RETURN_FAILURE;
+    }
+
+    return (dmaStatus);
+}
@@ -68,6 +68,9 @@ extern "C" {
 /** Dma SHA enable macro*/
 #define DMA_SHA_ENABLE                                (1U)
 
+/** Maximum number of entries in a DMA scatter-gather list */
+#define DMA_MAX_SG_ENTRIES                            (8U)
+
 /** \brief Handle to the DMA driver returned by #DMA_open() */
 typedef void *DMA_Handle;
 /** \brief Forward declaration of \ref DMA_Config_s */
@@ -75,6 +78,22 @@ typedef struct DMA_Config_s DMA_Config;
 /** \brief Forward declaration of \ref DMA_Params_s */
 typedef struct DMA_Params_s DMA_Params;
 
+/** \brief One entry of a DMA scatter-gather list */
+typedef struct DMA_SgEntry_s
+{
+    uint32_t                *address;
+    /**< Address of the first block of the entry */
+    uint16_t                numBlocks;
+    /**< Number of engine blocks at this address */
+} DMA_SgEntry;
+
+/**
+ *  \brief Function called from the DMA completion interrupt once a transfer is done
+ *
+ *  \param args [IN] Argument given when the callback was registered.
+ */
+typedef void (*DMA_TransferCallback)(void *args);
+
 /**
  * \brief
  *  DMA Driver Error code
@@ -135,28 +154,31 @@ typedef int32_t (*config_TxShaChannel)(DMA_Handle handle, uint32_t *srcAddress,
  *  \brief This callback implemented to enable Tx transfer DMA region
  *
  *  \param handle [IN] DMA handle to process DMA operations.
+ *  \param operationType [IN] for selecting Aes Or SHA channel.
  *
  *  \return SystemP_SUCCESS on success or SystemP_FAILURE on Failure.
  */
-typedef int32_t (*enableTxTransferRegion)(DMA_Handle handle);
+typedef int32_t (*enableTxTransferRegion)(DMA_Handle handle, int32_t operationType);
 
 /**
  *  \brief This callback implemented to disable Tx transfer channel
  *
  *  \param handle [IN] DMA handle to process DMA operations.
+ *  \param operationType [IN] for selecting Aes Or SHA channel.
  *
  *  \return SystemP_SUCCESS on success or SystemP_FAILURE on Failure.
  */
-typedef int32_t (*disableTxCh)(DMA_Handle handle);
+typedef int32_t (*disableTxCh)(DMA_Handle handle, int32_t operationType);
 
 /**
  *  \brief This callback implemented to wait for Tx transfer
  *
  *  \param handle [IN] DMA handle to process DMA operations.
+ *  \param operationType [IN] for selecting Aes Or SHA channel.
  *
  *  \return SystemP_SUCCESS on success or SystemP_FAILURE on Failure.
  */
-typedef int32_t (*waitForTxTransfer)(DMA_Handle handle);
+typedef int32_t (*waitForTxTransfer)(DMA_Handle handle, int32_t operationType);
 
 /**
  *  \brief This callback implemented to enable Rx transfer DMA region
@@ -185,6 +207,75 @@ typedef int32_t (*disableRxCh)(DMA_Handle handle);
  */
 typedef int32_t (*waitForRxTransfer)(DMA_Handle handle);
 
+/**
+ *  \brief This callback implemented to configure a Transmit DMA channel from a scatter-gather list.
+ *         All entries are streamed to the destination in one transfer.
+ *
+ *  \param handle [IN] DMA handle to process DMA operations.
+ *  \param sgList [IN] List of source entries.
+ *  \param numEntries [IN] Number of entries in the list, up to #DMA_MAX_SG_ENTRIES.
+ *  \param dstAddress [IN] Destination address for DMA transfer.
+ *  \param blockSize [IN] Block size for sha config.
+ *  \param operationType [IN] for selecting Aes Or SHA cfg.
+ *
+ *  \return SystemP_SUCCESS on success or SystemP_FAILURE on Failure.
+ */
+typedef int32_t (*config_TxSgChannel)(DMA_Handle handle, const DMA_SgEntry *sgList, uint32_t numEntries, uint32_t *dstAddress, uint16_t blockSize, int32_t operationType);
+
+/**
+ *  \brief This callback implemented to configure a Receive DMA channel into a scatter-gather list.
+ *
+ *  \param handle [IN] DMA handle to process DMA operations.
+ *  \param srcAddress [IN] Source address for DMA transfer.
+ *  \param sgList [IN] List of destination entries.
+ *  \param numEntries [IN] Number of entries in the list, up to #DMA_MAX_SG_ENTRIES.
+ *
+ *  \return SystemP_SUCCESS on success or SystemP_FAILURE on Failure.
+ */
+typedef int32_t (*config_RxSgChannel)(DMA_Handle handle, uint32_t *srcAddress, const DMA_SgEntry *sgList, uint32_t numEntries);
+
+/**
+ *  \brief This callback implemented to signal the end of the configured Tx transfer by interrupt
+ *
+ *  \param handle [IN] DMA handle to process DMA operations.
+ *  \param callback [IN] Function called from the completion interrupt.
+ *  \param args [IN] Argument passed to the callback.
+ *  \param operationType [IN] for selecting Aes Or SHA channel.
+ *
+ *  \return SystemP_SUCCESS on success or SystemP_FAILURE on Failure.
+ */
+typedef int32_t (*register_TxCallback)(DMA_Handle handle, DMA_TransferCallback callback, void *args, int32_t operationType);
+
+/**
+ *  \brief This callback implemented to signal the end of the configured Rx transfer by interrupt
+ *
+ *  \param handle [IN] DMA handle to process DMA operations.
+ *  \param callback [IN] Function called from the completion interrupt.
+ *  \param args [IN] Argument passed to the callback.
+ *
+ *  \return SystemP_SUCCESS on success or SystemP_FAILURE on Failure.
+ */
+typedef int32_t (*register_RxCallback)(DMA_Handle handle, DMA_TransferCallback callback, void *args);
+
+/**
+ *  \brief This callback implemented to allocate the channels, TCCs and PaRAM sets of all
+ *         the transfers once, so that a channel configuration only patches the addresses and counts
+ *
+ *  \param handle [IN] DMA handle to process DMA operations.
+ *
+ *  \return SystemP_SUCCESS on success or SystemP_FAILURE on Failure.
+ */
+typedef int32_t (*open_Channels)(DMA_Handle handle);
+
+/**
+ *  \brief This callback implemented to release the resources allocated by the open channels callback
+ *
+ *  \param handle [IN] DMA handle to process DMA operations.
+ *
+ *  \return SystemP_SUCCESS on success or SystemP_FAILURE on Failure.
+ */
+typedef int32_t (*close_Channels)(DMA_Handle handle);
+
 /** @} */
 
 /* ========================================================================== */
@@ -214,6 +305,18 @@ typedef struct DMA_Fxns_s
     /**< DMA callback function for disable tx transfer region */
     disableRxCh             disableRxChFxn;
     /**< DMA callback function for disable Rx transfer region */
+    config_TxSgChannel      cfgDmaTxSgChFxn;
+    /**< DMA callback function for cofigure dma tx channel from a scatter-gather list */
+    config_RxSgChannel      cfgDmaRxSgChFxn;
+    /**< DMA callback function for cofigure dma rx channel into a scatter-gather list */
+    register_TxCallback     registerTxCallbackFxn;
+    /**< DMA callback function to signal tx completion by interrupt */
+    register_RxCallback     registerRxCallbackFxn;
+    /**< DMA callback function to signal rx completion by interrupt */
+    open_Channels           openChannelsFxn;
+    /**< DMA callback function to allocate the channel resources once */
+    close_Channels          closeChannelsFxn;
+    /**< DMA callback function to release the channel resources */
 } DMA_Fxns;
 
 /** \brief DMA instance attributes - used during init time */
@@ -287,28 +390,31 @@ DMA_Return_t DMA_Config_TxChannel(DMA_Handle handle, uint32_t *srcAddress, uint3
  * \brief This DMA wrapper implemented to enable DMA TX transfer region.
  *
  * \param handle    [IN] DMA driver handle from \ref DMA_open
+ * \param operationType [IN] for selecting Aes Or SHA channel.
  *
  * \return DMA_RETURN_SUCCESS on success or DMA_RETURN_FAILURE on Failure.
  */
-DMA_Return_t DMA_enableTxTransferRegion(DMA_Handle handle);
+DMA_Return_t DMA_enableTxTransferRegion(DMA_Handle handle, int32_t operationType);
 
 /**
  * \brief This DMA wrapper implemented to wait TX transfer.
  *
  * \param handle    [IN] DMA driver handle from \ref DMA_open
- * 
+ * \param operationType [IN] for selecting Aes Or SHA channel.
+ *
  * \return DMA_RETURN_SUCCESS on success or DMA_RETURN_FAILURE on Failure.
  */
-DMA_Return_t DMA_WaitForTxTransfer(DMA_Handle handle);
+DMA_Return_t DMA_WaitForTxTransfer(DMA_Handle handle, int32_t operationType);
 
 /**
  * \brief This DMA wrapper implemented to disable DMA TX channel.
  *
  * \param handle    [IN] DMA driver handle from \ref DMA_open
+ * \param operationType [IN] for selecting Aes Or SHA channel.
  *
  * \return DMA_RETURN_SUCCESS on success or DMA_RETURN_FAILURE on Failure.
  */
-DMA_Return_t DMA_disableTxCh(DMA_Handle handle);
+DMA_Return_t DMA_disableTxCh(DMA_Handle handle, int32_t operationType);
 
 /**
  *  \brief This DMA wrapper implemented to configure DMA config RX sha channel.
@@ -349,6 +455,85 @@ DMA_Return_t DMA_WaitForRxTransfer(DMA_Handle handle);
  */
 DMA_Return_t DMA_disableRxCh(DMA_Handle handle);
 
+/**
+ *  \brief This DMA wrapper implemented to configure DMA TX channel from a scatter-gather list.
+ *         The linked PaRAM sets are released with \ref DMA_disableTxCh.
+ *
+ *  \param handle    [IN] DMA driver handle from \ref DMA_open
+ *  \param sgList [IN] List of source entries.
+ *  \param numEntries [IN] Number of entries in the list, up to #DMA_MAX_SG_ENTRIES.
+ *  \param dstAddress [IN] Destination address for DMA transfer.
+ *  \param blockSize [IN] Block size for sha config.
+ *  \param operationType [IN] for selecting Aes Or SHA cfg.
+ *
+ *  \return DMA_RETURN_SUCCESS on success or DMA_RETURN_FAILURE on Failure.
+ */
+DMA_Return_t DMA_Config_TxSgChannel(DMA_Handle handle, const DMA_SgEntry *sgList, uint32_t numEntries, uint32_t *dstAddress, uint16_t blockSize, int32_t operationType);
+
+/**
+ *  \brief This DMA wrapper implemented to configure DMA RX channel into a scatter-gather list.
+ *         The linked PaRAM sets are released with \ref DMA_disableRxCh.
+ *
+ *  \param handle    [IN] DMA driver handle from \ref DMA_open
+ *  \param srcAddress [IN] Source address for DMA transfer.
+ *  \param sgList [IN] List of destination entries.
+ *  \param numEntries [IN] Number of entries in the list, up to #DMA_MAX_SG_ENTRIES.
+ *
+ *  \return DMA_RETURN_SUCCESS on success or DMA_RETURN_FAILURE on Failure.
+ */
+DMA_Return_t DMA_Config_RxSgChannel(DMA_Handle handle, uint32_t *srcAddress, const DMA_SgEntry *sgList, uint32_t numEntries);
+
+/**
+ *  \brief This DMA wrapper implemented to get the end of the configured Tx transfer signalled
+ *         by interrupt instead of polling with \ref DMA_WaitForTxTransfer. It is called after the
+ *         channel is configured and before the transfer is enabled. The callback runs in interrupt
+ *         context once, for the next completed transfer, unless \ref DMA_disableTxCh drops it first.
+ *
+ *  \param handle    [IN] DMA driver handle from \ref DMA_open
+ *  \param callback  [IN] Function called from the completion interrupt.
+ *  \param args      [IN] Argument passed to the callback.
+ *  \param operationType [IN] for selecting Aes Or SHA channel.
+ *
+ *  \return DMA_RETURN_SUCCESS on success or DMA_RETURN_FAILURE on Failure.
+ */
+DMA_Return_t DMA_registerTxCallback(DMA_Handle handle, DMA_TransferCallback callback, void *args, int32_t operationType);
+
+/**
+ *  \brief This DMA wrapper implemented to get the end of the configured Rx transfer signalled
+ *         by interrupt instead of polling with \ref DMA_WaitForRxTransfer. It is called after the
+ *         channel is configured and before the transfer is enabled. The callback runs in interrupt
+ *         context once, for the next completed transfer, unless \ref DMA_disableRxCh drops it first.
+ *
+ *  \param handle    [IN] DMA driver handle from \ref DMA_open
+ *  \param callback  [IN] Function called from the completion interrupt.
+ *  \param args      [IN] Argument passed to the callback.
+ *
+ *  \return DMA_RETURN_SUCCESS on success or DMA_RETURN_FAILURE on Failure.
+ */
+DMA_Return_t DMA_registerRxCallback(DMA_Handle handle, DMA_TransferCallback callback, void *args);
+
+/**
+ *  \brief This DMA wrapper implemented to allocate the DMA channels, TCCs and PaRAM sets used by
+ *         the DTHE once. The channel configuration wrappers then only patch the addresses and
+ *         counts of prebuilt PaRAM sets, and \ref DMA_disableTxCh / \ref DMA_disableRxCh keep
+ *         the resources. Calling it again while the channels are open has no effect.
+ *
+ *  \param handle    [IN] DMA driver handle from \ref DMA_open
+ *
+ *  \return DMA_RETURN_SUCCESS on success or DMA_RETURN_FAILURE on Failure.
+ */
+DMA_Return_t DMA_openChannels(DMA_Handle handle);
+
+/**
+ *  \brief This DMA wrapper implemented to release the resources allocated by \ref DMA_openChannels.
+ *         No transfer may be in progress.
+ *
+ *  \param handle    [IN] DMA driver handle from \ref DMA_open
+ *
+ *  \return DMA_RETURN_SUCCESS on success or DMA_RETURN_FAILURE on Failure.
+ */
+DMA_Return_t DMA_closeChannels(DMA_Handle handle);
+
 /* ========================================================================== */
 /*                       Static Function Definitions                          */
 /* ========================================================================== */
@@ -47,8 +47,8 @@
 /* ========================================================================== */
 
 #define EDMA_TEST_EVT_QUEUE_NO          (0U)
-#define EDMA_NUM_OF_CC_PARAMS           (2U)
-#define EDMA_NUM_OF_EDMA_PARAMS         (2U)
+#define EDMA_NUM_OF_CC_PARAMS           (3U)
+#define EDMA_NUM_OF_EDMA_PARAMS         (3U)
 #define EDMA_A_COUNT_VALUE              (4U)
 #define EDMA_B_COUNT_VALUE              (4U)
 #define EDMA_BINEX_POSITIVE_VALUE       (4U)
@@ -57,6 +57,7 @@
 #define EDMA_LINK_ADDRESS               (0xFFFFU)
 #define EDMA_TX_CH_PARAMS_INDEX         (0U)
 #define EDMA_RX_CH_PARAMS_INDEX         (1U)
+#define EDMA_SHA_TX_CH_PARAMS_INDEX     (2U)
 #define EDMA_AES_TX_CHANNEL_NUMBER      (16U)
 #define EDMA_SHA_TX_CH_NUMBER           (9U)
 #define EDMA_AES_RX_CHANNEL_NUMBER      (17U)
@@ -65,13 +66,39 @@
 /*                         Structure Declarations                             */
 /* ========================================================================== */
 
-/* None */
+/** \brief Completion interrupt registration of one channel */
+typedef struct EDMA_TransferCbObj_s
+{
+    Edma_IntrObject         intrObj;
+    /**< EDMA interrupt object registered on the channel TCC */
+    DMA_TransferCallback    callback;
+    /**< DMA layer callback of the transfer in progress, NULL if none */
+    void                    *args;
+    /**< Argument of the DMA layer callback */
+    uint8_t                 isRegistered;
+    /**< Set while intrObj is registered with the EDMA driver */
+    volatile uint8_t        isDone;
+    /**< Set from the interrupt when the last enabled transfer is done */
+} EDMA_TransferCbObj;
 
 /* ========================================================================== */
 /*                          Function Declarations                             */
 /* ========================================================================== */
 
-/* None */
+static int32_t EDMA_acquireChannels(EDMA_Handle edmaHandler);
+static void EDMA_releaseChannels(EDMA_Handle edmaHandler);
+static int32_t EDMA_getTxIndex(int32_t operationType, uint32_t *ptrChIndex);
+static void EDMA_waitForCompletion(uint32_t chIndex);
+static int32_t EDMA_allocChannel(EDMA_Handle edmaHandler, uint32_t chIndex, uint32_t dmaCh);
+static void EDMA_freeChannel(EDMA_Handle edmaHandler, uint32_t chIndex);
+static void EDMA_setTxParamEntry(EDMACCPaRAMEntry *ptrEntry, uint32_t *srcAddress, uint32_t *dstAddress, uint16_t numBlocks, uint16_t blockSize, int32_t operationType);
+static void EDMA_setRxParamEntry(EDMACCPaRAMEntry *ptrEntry, uint32_t *srcAddress, uint32_t *dstAddress, uint16_t numBlocks);
+static void EDMA_setParamCompletion(EDMACCPaRAMEntry *ptrEntry, uint32_t tcc, uint8_t isLastEntry);
+static int32_t EDMA_programSgList(EDMA_Handle edmaHandler, uint32_t chIndex, EDMACCPaRAMEntry *ptrEntries, uint32_t numEntries);
+static void EDMA_freeLinkParams(EDMA_Handle edmaHandler, uint32_t chIndex);
+static int32_t EDMA_registerCallback(EDMA_Handle edmaHandler, uint32_t chIndex, DMA_TransferCallback callback, void *args);
+static void EDMA_unregisterCallback(EDMA_Handle edmaHandler, uint32_t chIndex);
+static void EDMA_transferIsr(Edma_IntrHandle intrHandle, void *args);
 
 /* ========================================================================== */
 /*                            Global Variables                                */
@@ -88,22 +115,75 @@ DMA_Fxns gEdmaFxns =
     .enableRxTransferRegionFxn = EDMA_enableRxTransferRegion,
     .waitForRxTranferFxn = EDMA_WaitForRxTransfer,
     .disableRxChFxn = EDMA_disableRxChannel,
+    .cfgDmaTxSgChFxn = EDMA_Config_TxSgChannel,
+    .cfgDmaRxSgChFxn = EDMA_Config_RxSgChannel,
+    .registerTxCallbackFxn = EDMA_registerTxCallback,
+    .registerRxCallbackFxn = EDMA_registerRxCallback,
+    .openChannelsFxn = EDMA_openChannels,
+    .closeChannelsFxn = EDMA_closeChannels,
 };
 
-/** Global CC edma params */
-EDMACCPaRAMEntry   gEdmaCCParams[2];
+/** Global CC edma params: PaRAM templates of the AES TX, AES RX and SHA TX channels */
+EDMACCPaRAMEntry   gEdmaCCParams[EDMA_NUM_OF_CC_PARAMS];
 /** Global dma params */
-DMA_Params         globalEdmaParams[2];
+DMA_Params         globalEdmaParams[EDMA_NUM_OF_EDMA_PARAMS];
+/** PaRAM sets linked behind the channel PaRAM set for scatter-gather transfers */
+static uint32_t    gEdmaLinkParams[EDMA_NUM_OF_EDMA_PARAMS][DMA_MAX_SG_ENTRIES];
+/** Number of valid entries in gEdmaLinkParams */
+static uint32_t    gEdmaNumLinkParams[EDMA_NUM_OF_EDMA_PARAMS];
+/** Completion interrupt registrations of the channels */
+static EDMA_TransferCbObj gEdmaTransferCbObj[EDMA_NUM_OF_EDMA_PARAMS];
+/** Set for each channel whose DMA channel, TCC and PaRAM set are allocated */
+static uint8_t     gEdmaChAllocated[EDMA_NUM_OF_EDMA_PARAMS];
+/** Set while the resources of all the channels are held */
+static uint8_t     gEdmaChannelsOpen = 0U;
 
 /* ========================================================================== */
 /*                          Function Definitions                              */
 /* ========================================================================== */
 
-int32_t EDMA_Config_TxChannel(DMA_Handle handle, uint32_t *srcAddress, uint32_t *dstAddress, uint16_t numBlocks, uint16_t blockSize, int32_t operationType)
+int32_t EDMA_openChannels(DMA_Handle handle)
 {
     int32_t         status = SystemP_FAILURE;
     DMA_Config      *dmaCfg;
-    EDMA_Handle     edmaHandler; 
+
+    if(NULL != handle)
+    {
+        dmaCfg = (DMA_Config *)handle;
+        if (gEdmaChannelsOpen == 1U)
+        {
+            status = SystemP_SUCCESS;
+        }
+        else
+        {
+            status = EDMA_acquireChannels(dmaCfg->dmaHandle);
+        }
+    }
+    return (status);
+}
+
+int32_t EDMA_closeChannels(DMA_Handle handle)
+{
+    int32_t         status = SystemP_FAILURE;
+    DMA_Config      *dmaCfg;
+
+    if(NULL != handle)
+    {
+        dmaCfg = (DMA_Config *)handle;
+        EDMA_releaseChannels(dmaCfg->dmaHandle);
+        status = SystemP_SUCCESS;
+    }
+    return (status);
+}
+
+int32_t EDMA_Config_TxChannel(DMA_Handle handle, uint32_t *srcAddress, uint32_t *dstAddress, uint16_t numBlocks, uint16_t blockSize, int32_t operationType)
+{
+    int32_t             status = SystemP_FAILURE;
+    DMA_Config          *dmaCfg;
+    EDMA_Handle         edmaHandler;
+    EDMACCPaRAMEntry    *ptrEntry;
+    uint32_t            chIndex = EDMA_TX_CH_PARAMS_INDEX;
+
     if(NULL == handle)
     {
         status  = SystemP_FAILURE;
@@ -113,104 +193,51 @@ int32_t EDMA_Config_TxChannel(DMA_Handle handle, uint32_t *srcAddress, uint32_t
         dmaCfg = (DMA_Config *)handle;
         edmaHandler = dmaCfg->dmaHandle;
 
-        globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].baseAddr = EDMA_getBaseAddr(edmaHandler);
-
-        globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].regionId = EDMA_getRegionId(edmaHandler);
-
-        if( operationType == DMA_AES_ENABLE )
+        status = EDMA_openChannels(handle);
+        if (status == SystemP_SUCCESS)
         {
-            globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].dmaCh = EDMA_AES_TX_CHANNEL_NUMBER;
-            status = EDMA_allocDmaChannel(edmaHandler, &globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].dmaCh);
+            status = EDMA_getTxIndex(operationType, &chIndex);
         }
-        else if ( operationType == DMA_SHA_ENABLE )
-        {
-            globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].dmaCh = EDMA_SHA_TX_CH_NUMBER;
-            status = EDMA_allocDmaChannel(edmaHandler, &globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].dmaCh);
-        }
-        else
-        {
-            status  = SystemP_FAILURE;
-        }
-
-        globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].tcc = EDMA_RESOURCE_ALLOC_ANY;
-        status = EDMA_allocTcc(edmaHandler, &globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].tcc);
-
-        globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].param = EDMA_RESOURCE_ALLOC_ANY;
-        status = EDMA_allocParam(edmaHandler, &globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].param);
 
-        /* Request channel */
-        EDMA_configureChannelRegion(globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].baseAddr, globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].regionId, EDMA_CHANNEL_TYPE_DMA,
-        globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].dmaCh, globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].tcc, globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].param, EDMA_TEST_EVT_QUEUE_NO);
-        
-        if( operationType == DMA_AES_ENABLE )
+        if (status == SystemP_SUCCESS)
         {
-            /* Program Param Set */
-            EDMA_ccPaRAMEntry_init(&gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX]);
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].srcAddr       = (uint32_t) srcAddress;
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].destAddr      = (uint32_t) dstAddress;
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].aCnt          = (uint16_t) EDMA_A_COUNT_VALUE;
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].bCnt          = (uint16_t) EDMA_B_COUNT_VALUE;
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].cCnt          = (uint16_t) numBlocks;
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].bCntReload    = (uint16_t) EDMA_NULL_INDEX_VALUE;
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].srcBIdx       = (int16_t) EDMA_BINEX_POSITIVE_VALUE;
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].destBIdx      = (int16_t) EDMA_BINEX_NEGATIVE_VALUE;
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].srcCIdx       = (int16_t) (EDMA_A_COUNT_VALUE * EDMA_B_COUNT_VALUE);
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].destCIdx      = (int16_t) EDMA_NULL_INDEX_VALUE;
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].linkAddr      = EDMA_LINK_ADDRESS;
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].srcBIdxExt    = (int8_t) EDMA_PARAM_BIDX_EXT(EDMA_BINEX_POSITIVE_VALUE);
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].destBIdxExt   = (int8_t) EDMA_PARAM_BIDX_EXT(EDMA_BINEX_NEGATIVE_VALUE);
-
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].opt          |=
-                (EDMA_OPT_TCINTEN_MASK |
-                 ((((uint32_t)globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].tcc) << EDMA_OPT_TCC_SHIFT) & EDMA_OPT_TCC_MASK)) | 
-                ((uint32_t)1 << EDMA_OPT_SYNCDIM_SHIFT);
-       }
-       else if( operationType == DMA_SHA_ENABLE )
-       {
-            /* Program Param Set */
-            EDMA_ccPaRAMEntry_init(&gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX]);
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].srcAddr       = (uint32_t) srcAddress;
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].destAddr      = (uint32_t) dstAddress;
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].aCnt          = (uint16_t) EDMA_A_COUNT_VALUE;
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].bCnt          = (uint16_t) blockSize;
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].cCnt          = (uint16_t) numBlocks;
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].bCntReload    = (uint16_t) EDMA_NULL_INDEX_VALUE;
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].srcBIdx       = (int16_t) EDMA_BINEX_POSITIVE_VALUE;
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].destBIdx      = (int16_t) EDMA_NULL_INDEX_VALUE;
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].srcCIdx       = (int16_t) (blockSize * EDMA_A_COUNT_VALUE);
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].destCIdx      = (int16_t) EDMA_NULL_INDEX_VALUE;
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].linkAddr      = EDMA_LINK_ADDRESS;
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].srcBIdxExt    = (int8_t) EDMA_PARAM_BIDX_EXT(EDMA_BINEX_POSITIVE_VALUE);
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].destBIdxExt   = (int8_t) EDMA_PARAM_BIDX_EXT(EDMA_NULL_INDEX_VALUE);
-
-            gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX].opt          |=
-                (EDMA_OPT_TCINTEN_MASK |
-                 ((((uint32_t)globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].tcc) << EDMA_OPT_TCC_SHIFT) & EDMA_OPT_TCC_MASK)) | 
-                ((uint32_t)1 << EDMA_OPT_SYNCDIM_SHIFT);            
-       }
-       else
-       {
-           status  = SystemP_FAILURE;
-       }
-
-       EDMA_setPaRAM(globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].baseAddr, globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].param, &gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX]);
-       status = SystemP_SUCCESS;
-       
+            EDMA_freeLinkParams(edmaHandler, chIndex);
+
+            /* Only the addresses and counts change between transfers. The whole set is still
+             * written back because the EDMA replaces it with the null set once it is done. */
+            ptrEntry = &gEdmaCCParams[chIndex];
+            ptrEntry->srcAddr   = (uint32_t) srcAddress;
+            ptrEntry->destAddr  = (uint32_t) dstAddress;
+            ptrEntry->cCnt      = (uint16_t) numBlocks;
+            if( operationType == DMA_SHA_ENABLE )
+            {
+                ptrEntry->bCnt      = (uint16_t) blockSize;
+                ptrEntry->srcCIdx   = (int16_t) (blockSize * EDMA_A_COUNT_VALUE);
+            }
+
+            EDMA_setPaRAM(globalEdmaParams[chIndex].baseAddr, globalEdmaParams[chIndex].param, ptrEntry);
+        }
     }
     return (status);
 }
 
-int32_t EDMA_enableTxTransferRegion(DMA_Handle handle)
+int32_t EDMA_enableTxTransferRegion(DMA_Handle handle, int32_t operationType)
 {
     int32_t         status = SystemP_FAILURE;
+    uint32_t        chIndex = EDMA_TX_CH_PARAMS_INDEX;
+
     if(NULL == handle)
     {
         status  = SystemP_FAILURE;
     }
+    else if (EDMA_getTxIndex(operationType, &chIndex) != SystemP_SUCCESS)
+    {
+        status  = SystemP_FAILURE;
+    }
     else
     {
-
-        status = EDMA_enableTransferRegion(globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].baseAddr, globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].regionId, globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].dmaCh,
+        gEdmaTransferCbObj[chIndex].isDone = 0U;
+        status = EDMA_enableTransferRegion(globalEdmaParams[chIndex].baseAddr, globalEdmaParams[chIndex].regionId, globalEdmaParams[chIndex].dmaCh,
                                      EDMA_TRIG_MODE_EVENT);
 
         if ( status == FALSE )
@@ -225,21 +252,26 @@ int32_t EDMA_enableTxTransferRegion(DMA_Handle handle)
 
     return (status);
 }
-int32_t EDMA_WaitForTxTransfer(DMA_Handle handle)
+int32_t EDMA_WaitForTxTransfer(DMA_Handle handle, int32_t operationType)
 {
     int32_t         status = SystemP_FAILURE;
+    uint32_t        chIndex = EDMA_TX_CH_PARAMS_INDEX;
 
-    while(EDMA_readIntrStatusRegion(globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].baseAddr, globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].regionId, globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].tcc) != 1);
-    EDMA_clrIntrRegion(globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].baseAddr, globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].regionId, globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].tcc);
-    status = SystemP_SUCCESS;
+    status = EDMA_getTxIndex(operationType, &chIndex);
+    if (status == SystemP_SUCCESS)
+    {
+        EDMA_waitForCompletion(chIndex);
+    }
 
     return (status);
 }
 int32_t EDMA_Config_RxChannel(DMA_Handle handle, uint32_t *srcAddress, uint32_t *dstAddress, uint16_t numBlocks)
 {
-    int32_t         status = SystemP_FAILURE;
-    DMA_Config      *dmaCfg;
-    EDMA_Handle     edmaHandler; 
+    int32_t             status = SystemP_FAILURE;
+    DMA_Config          *dmaCfg;
+    EDMA_Handle         edmaHandler;
+    EDMACCPaRAMEntry    *ptrEntry;
+
     if(NULL == handle)
     {
         status  = SystemP_FAILURE;
@@ -249,44 +281,19 @@ int32_t EDMA_Config_RxChannel(DMA_Handle handle, uint32_t *srcAddress, uint32_t
         dmaCfg = (DMA_Config *)handle;
         edmaHandler = dmaCfg->dmaHandle;
 
-        globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].baseAddr = EDMA_getBaseAddr(edmaHandler);
-
-        globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].regionId = EDMA_getRegionId(edmaHandler);
-
-        globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].dmaCh = EDMA_AES_RX_CHANNEL_NUMBER;
-        status = EDMA_allocDmaChannel(edmaHandler, &globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].dmaCh);
-
-        globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].tcc = EDMA_RESOURCE_ALLOC_ANY;
-        status = EDMA_allocTcc(edmaHandler, &globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].tcc);
+        status = EDMA_openChannels(handle);
+        if (status == SystemP_SUCCESS)
+        {
+            EDMA_freeLinkParams(edmaHandler, EDMA_RX_CH_PARAMS_INDEX);
 
-        globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].param = EDMA_RESOURCE_ALLOC_ANY;
-        status = EDMA_allocParam(edmaHandler, &globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].param);
+            /* Patch the template, see EDMA_Config_TxChannel */
+            ptrEntry = &gEdmaCCParams[EDMA_RX_CH_PARAMS_INDEX];
+            ptrEntry->srcAddr   = (uint32_t) srcAddress;
+            ptrEntry->destAddr  = (uint32_t) dstAddress;
+            ptrEntry->cCnt      = (uint16_t) numBlocks;
 
-        /* Request channel */
-        EDMA_configureChannelRegion(globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].baseAddr, globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].regionId, EDMA_CHANNEL_TYPE_DMA,
-        globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].dmaCh, globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].tcc, globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].param, EDMA_TEST_EVT_QUEUE_NO);
-        /* Program Param Set */
-        EDMA_ccPaRAMEntry_init(&gEdmaCCParams[EDMA_RX_CH_PARAMS_INDEX]);
-        
-        gEdmaCCParams[EDMA_RX_CH_PARAMS_INDEX].srcAddr       = (uint32_t) srcAddress;
-        gEdmaCCParams[EDMA_RX_CH_PARAMS_INDEX].destAddr      = (uint32_t) dstAddress;
-        gEdmaCCParams[EDMA_RX_CH_PARAMS_INDEX].aCnt          = (uint16_t) EDMA_A_COUNT_VALUE;
-        gEdmaCCParams[EDMA_RX_CH_PARAMS_INDEX].bCnt          = (uint16_t) EDMA_B_COUNT_VALUE;
-        gEdmaCCParams[EDMA_RX_CH_PARAMS_INDEX].cCnt          = (uint16_t) numBlocks;
-        gEdmaCCParams[EDMA_RX_CH_PARAMS_INDEX].bCntReload    = (uint16_t) EDMA_NULL_INDEX_VALUE;
-        gEdmaCCParams[EDMA_RX_CH_PARAMS_INDEX].srcBIdx       = (int16_t) EDMA_BINEX_NEGATIVE_VALUE;
-        gEdmaCCParams[EDMA_RX_CH_PARAMS_INDEX].destBIdx      = (int16_t) EDMA_BINEX_POSITIVE_VALUE;
-        gEdmaCCParams[EDMA_RX_CH_PARAMS_INDEX].srcCIdx       = (int16_t) EDMA_NULL_INDEX_VALUE;
-        gEdmaCCParams[EDMA_RX_CH_PARAMS_INDEX].destCIdx      = (int16_t) EDMA_A_COUNT_VALUE * EDMA_B_COUNT_VALUE;
-        gEdmaCCParams[EDMA_RX_CH_PARAMS_INDEX].linkAddr      = EDMA_LINK_ADDRESS;
-        gEdmaCCParams[EDMA_RX_CH_PARAMS_INDEX].srcBIdxExt    = (int8_t) EDMA_PARAM_BIDX_EXT(EDMA_BINEX_NEGATIVE_VALUE);
-        gEdmaCCParams[EDMA_RX_CH_PARAMS_INDEX].destBIdxExt   = (int8_t) EDMA_PARAM_BIDX_EXT(EDMA_BINEX_POSITIVE_VALUE);
-        gEdmaCCParams[EDMA_RX_CH_PARAMS_INDEX].opt          |=
-            (EDMA_OPT_TCINTEN_MASK |
-             ((((uint32_t)globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].tcc) << EDMA_OPT_TCC_SHIFT) & EDMA_OPT_TCC_MASK)) | 
-            ((uint32_t)1 << EDMA_OPT_SYNCDIM_SHIFT);
-        EDMA_setPaRAM(globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].baseAddr, globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].param, &gEdmaCCParams[EDMA_RX_CH_PARAMS_INDEX]);
-        status = SystemP_SUCCESS;
+            EDMA_setPaRAM(globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].baseAddr, globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].param, ptrEntry);
+        }
     }
     return (status);
 }
@@ -299,7 +306,7 @@ int32_t EDMA_enableRxTransferRegion(DMA_Handle handle)
     }
     else
     {
-
+        gEdmaTransferCbObj[EDMA_RX_CH_PARAMS_INDEX].isDone = 0U;
         status = EDMA_enableTransferRegion(globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].baseAddr, globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].regionId, globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].dmaCh,
                                      EDMA_TRIG_MODE_EVENT);
         if ( status == FALSE )
@@ -318,35 +325,35 @@ int32_t EDMA_WaitForRxTransfer(DMA_Handle handle)
 {
     int32_t         status = SystemP_SUCCESS;
 
-    while(EDMA_readIntrStatusRegion(globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].baseAddr, globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].regionId, globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].tcc) != 1);
-    EDMA_clrIntrRegion(globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].baseAddr, globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].regionId, globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].tcc);
+    EDMA_waitForCompletion(EDMA_RX_CH_PARAMS_INDEX);
 
     return (status);
 }
 
-int32_t EDMA_disableTxChannel(DMA_Handle handle)
+int32_t EDMA_disableTxChannel(DMA_Handle handle, int32_t operationType)
 {
     int32_t         status = SystemP_FAILURE;
     DMA_Config      *dmaCfg;
     EDMA_Handle     edmaHandler;
+    uint32_t        chIndex = EDMA_TX_CH_PARAMS_INDEX;
     
     if(NULL == handle)
     {
         status  = SystemP_FAILURE;
     }
+    else if (EDMA_getTxIndex(operationType, &chIndex) != SystemP_SUCCESS)
+    {
+        status  = SystemP_FAILURE;
+    }
     else
     {
         dmaCfg = (DMA_Config *)handle;
         edmaHandler = dmaCfg->dmaHandle;
-        
-        /* Free channel */
-        EDMA_freeChannelRegion(globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].baseAddr, globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].regionId, EDMA_CHANNEL_TYPE_DMA,
-            globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].dmaCh, EDMA_TRIG_MODE_MANUAL, globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].tcc, EDMA_TEST_EVT_QUEUE_NO);
-
-        /* Free the EDMA resources managed by driver. */
-        EDMA_freeDmaChannel(edmaHandler, &globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].dmaCh);
-        EDMA_freeTcc(edmaHandler, &globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].tcc);
-        EDMA_freeParam(edmaHandler, &globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].param);
+
+        /* The channel is kept until EDMA_closeChannels, only the transfer state is dropped */
+        EDMA_freeLinkParams(edmaHandler, chIndex);
+        gEdmaTransferCbObj[chIndex].callback = NULL;
+        gEdmaTransferCbObj[chIndex].args     = NULL;
         status = SystemP_SUCCESS;
     }
 
@@ -367,17 +374,512 @@ int32_t EDMA_disableRxChannel(DMA_Handle handle)
     {
         dmaCfg = (DMA_Config *)handle;
         edmaHandler = dmaCfg->dmaHandle;
-        
-        /* Free channel */
-        EDMA_freeChannelRegion(globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].baseAddr, globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].regionId, EDMA_CHANNEL_TYPE_DMA,
-            globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].dmaCh, EDMA_TRIG_MODE_MANUAL, globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].tcc, EDMA_TEST_EVT_QUEUE_NO);
-
-        /* Free the EDMA resources managed by driver. */
-        EDMA_freeDmaChannel(edmaHandler, &globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].dmaCh);
-        EDMA_freeTcc(edmaHandler, &globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].tcc);
-        EDMA_freeParam(edmaHandler, &globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].param);
+
+        /* The channel is kept until EDMA_closeChannels, only the transfer state is dropped */
+        EDMA_freeLinkParams(edmaHandler, EDMA_RX_CH_PARAMS_INDEX);
+        gEdmaTransferCbObj[EDMA_RX_CH_PARAMS_INDEX].callback = NULL;
+        gEdmaTransferCbObj[EDMA_RX_CH_PARAMS_INDEX].args     = NULL;
+        status = SystemP_SUCCESS;
+    }
+
+    return (status);
+}
+
+int32_t EDMA_Config_TxSgChannel(DMA_Handle handle, const DMA_SgEntry *sgList, uint32_t numEntries, uint32_t *dstAddress, uint16_t blockSize, int32_t operationType)
+{
+    int32_t             status = SystemP_FAILURE;
+    DMA_Config          *dmaCfg;
+    EDMA_Handle         edmaHandler;
+    EDMACCPaRAMEntry    paramEntries[DMA_MAX_SG_ENTRIES];
+    uint32_t            index;
+    uint32_t            chIndex = EDMA_TX_CH_PARAMS_INDEX;
+
+    if((NULL != handle) && (NULL != sgList) && (numEntries != 0U) && (numEntries <= DMA_MAX_SG_ENTRIES))
+    {
+        dmaCfg = (DMA_Config *)handle;
+        edmaHandler = dmaCfg->dmaHandle;
+
+        status = EDMA_openChannels(handle);
+        if (status == SystemP_SUCCESS)
+        {
+            status = EDMA_getTxIndex(operationType, &chIndex);
+        }
+
+        if (status == SystemP_SUCCESS)
+        {
+            EDMA_freeLinkParams(edmaHandler, chIndex);
+            for (index = 0U; index < numEntries; index++)
+            {
+                EDMA_setTxParamEntry(&paramEntries[index], sgList[index].address, dstAddress,
+                                     sgList[index].numBlocks, blockSize, operationType);
+                EDMA_setParamCompletion(&paramEntries[index], globalEdmaParams[chIndex].tcc,
+                                        (uint8_t)((index + 1U) == numEntries));
+            }
+            status = EDMA_programSgList(edmaHandler, chIndex, &paramEntries[0U], numEntries);
+        }
+    }
+    return (status);
+}
+
+int32_t EDMA_Config_RxSgChannel(DMA_Handle handle, uint32_t *srcAddress, const DMA_SgEntry *sgList, uint32_t numEntries)
+{
+    int32_t             status = SystemP_FAILURE;
+    DMA_Config          *dmaCfg;
+    EDMA_Handle         edmaHandler;
+    EDMACCPaRAMEntry    paramEntries[DMA_MAX_SG_ENTRIES];
+    uint32_t            index;
+
+    if((NULL != handle) && (NULL != sgList) && (numEntries != 0U) && (numEntries <= DMA_MAX_SG_ENTRIES))
+    {
+        dmaCfg = (DMA_Config *)handle;
+        edmaHandler = dmaCfg->dmaHandle;
+
+        status = EDMA_openChannels(handle);
+
+        if (status == SystemP_SUCCESS)
+        {
+            EDMA_freeLinkParams(edmaHandler, EDMA_RX_CH_PARAMS_INDEX);
+            for (index = 0U; index < numEntries; index++)
+            {
+                EDMA_setRxParamEntry(&paramEntries[index], srcAddress, sgList[index].address, sgList[index].numBlocks);
+                EDMA_setParamCompletion(&paramEntries[index], globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].tcc,
+                                        (uint8_t)((index + 1U) == numEntries));
+            }
+            status = EDMA_programSgList(edmaHandler, EDMA_RX_CH_PARAMS_INDEX, &paramEntries[0U], numEntries);
+        }
+    }
+    return (status);
+}
+
+int32_t EDMA_registerTxCallback(DMA_Handle handle, DMA_TransferCallback callback, void *args, int32_t operationType)
+{
+    int32_t         status = SystemP_FAILURE;
+    DMA_Config      *dmaCfg;
+    uint32_t        chIndex = EDMA_TX_CH_PARAMS_INDEX;
+
+    if((NULL != handle) && (NULL != callback))
+    {
+        status = EDMA_getTxIndex(operationType, &chIndex);
+    }
+
+    if (status == SystemP_SUCCESS)
+    {
+        dmaCfg = (DMA_Config *)handle;
+        status = EDMA_registerCallback(dmaCfg->dmaHandle, chIndex, callback, args);
+    }
+    return (status);
+}
+
+int32_t EDMA_registerRxCallback(DMA_Handle handle, DMA_TransferCallback callback, void *args)
+{
+    int32_t         status = SystemP_FAILURE;
+    DMA_Config      *dmaCfg;
+
+    if((NULL != handle) && (NULL != callback))
+    {
+        dmaCfg = (DMA_Config *)handle;
+        status = EDMA_registerCallback(dmaCfg->dmaHandle, EDMA_RX_CH_PARAMS_INDEX, callback, args);
+    }
+    return (status);
+}
+
+/* ========================================================================== */
+/*                 Internal Function Definitions                              */
+/* ========================================================================== */
+
+/**
+ * \brief Allocates the AES TX, AES RX and SHA TX channels and builds their PaRAM templates.
+ *        Everything but the addresses and counts is fixed for the lifetime of the channels.
+ */
+static int32_t EDMA_acquireChannels(EDMA_Handle edmaHandler)
+{
+    int32_t status;
+
+    status = EDMA_allocChannel(edmaHandler, EDMA_TX_CH_PARAMS_INDEX, EDMA_AES_TX_CHANNEL_NUMBER);
+    if (status == SystemP_SUCCESS)
+    {
+        status = EDMA_allocChannel(edmaHandler, EDMA_RX_CH_PARAMS_INDEX, EDMA_AES_RX_CHANNEL_NUMBER);
+    }
+    if (status == SystemP_SUCCESS)
+    {
+        status = EDMA_allocChannel(edmaHandler, EDMA_SHA_TX_CH_PARAMS_INDEX, EDMA_SHA_TX_CH_NUMBER);
+    }
+
+    if (status == SystemP_SUCCESS)
+    {
+        EDMA_setTxParamEntry(&gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX], NULL, NULL, 0U, 0U, DMA_AES_ENABLE);
+        EDMA_setParamCompletion(&gEdmaCCParams[EDMA_TX_CH_PARAMS_INDEX], globalEdmaParams[EDMA_TX_CH_PARAMS_INDEX].tcc, 1U);
+
+        EDMA_setRxParamEntry(&gEdmaCCParams[EDMA_RX_CH_PARAMS_INDEX], NULL, NULL, 0U);
+        EDMA_setParamCompletion(&gEdmaCCParams[EDMA_RX_CH_PARAMS_INDEX], globalEdmaParams[EDMA_RX_CH_PARAMS_INDEX].tcc, 1U);
+
+        EDMA_setTxParamEntry(&gEdmaCCParams[EDMA_SHA_TX_CH_PARAMS_INDEX], NULL, NULL, 0U, 0U, DMA_SHA_ENABLE);
+        EDMA_setParamCompletion(&gEdmaCCParams[EDMA_SHA_TX_CH_PARAMS_INDEX], globalEdmaParams[EDMA_SHA_TX_CH_PARAMS_INDEX].tcc, 1U);
+
+        gEdmaChannelsOpen = 1U;
+    }
+    else
+    {
+        EDMA_releaseChannels(edmaHandler);
+    }
+
+    return (status);
+}
+
+/**
+ * \brief Releases the resources of every allocated channel.
+ */
+static void EDMA_releaseChannels(EDMA_Handle edmaHandler)
+{
+    uint32_t chIndex;
+
+    for (chIndex = 0U; chIndex < EDMA_NUM_OF_EDMA_PARAMS; chIndex++)
+    {
+        EDMA_freeLinkParams(edmaHandler, chIndex);
+        EDMA_unregisterCallback(edmaHandler, chIndex);
+        if (gEdmaChAllocated[chIndex] == 1U)
+        {
+            EDMA_freeChannel(edmaHandler, chIndex);
+        }
+    }
+    gEdmaChannelsOpen = 0U;
+
+    return;
+}
+
+/**
+ * \brief Gets the channel index of the TX transfer for the given operation.
+ */
+static int32_t EDMA_getTxIndex(int32_t operationType, uint32_t *ptrChIndex)
+{
+    int32_t status = SystemP_SUCCESS;
+
+    if( operationType == DMA_AES_ENABLE )
+    {
+        *ptrChIndex = EDMA_TX_CH_PARAMS_INDEX;
+    }
+    else if ( operationType == DMA_SHA_ENABLE )
+    {
+        *ptrChIndex = EDMA_SHA_TX_CH_PARAMS_INDEX;
+    }
+    else
+    {
+        status  = SystemP_FAILURE;
+    }
+
+    return (status);
+}
+
+/**
+ * \brief Busy waits for the end of the transfer of a channel. Once an interrupt object is
+ *        registered on the TCC the EDMA driver ISR clears its status, so the interrupt flag is polled.
+ */
+static void EDMA_waitForCompletion(uint32_t chIndex)
+{
+    if (gEdmaTransferCbObj[chIndex].isRegistered == 1U)
+    {
+        while(gEdmaTransferCbObj[chIndex].isDone == 0U)
+        {
+        }
+    }
+    else
+    {
+        while(EDMA_readIntrStatusRegion(globalEdmaParams[chIndex].baseAddr, globalEdmaParams[chIndex].regionId, globalEdmaParams[chIndex].tcc) != 1);
+        EDMA_clrIntrRegion(globalEdmaParams[chIndex].baseAddr, globalEdmaParams[chIndex].regionId, globalEdmaParams[chIndex].tcc);
+    }
+
+    return;
+}
+
+/**
+ * \brief Allocates the DMA channel, TCC and channel PaRAM set and maps them for the given channel index.
+ *        Nothing is left allocated on failure.
+ */
+static int32_t EDMA_allocChannel(EDMA_Handle edmaHandler, uint32_t chIndex, uint32_t dmaCh)
+{
+    int32_t status = SystemP_FAILURE;
+
+    globalEdmaParams[chIndex].baseAddr = EDMA_getBaseAddr(edmaHandler);
+    globalEdmaParams[chIndex].regionId = EDMA_getRegionId(edmaHandler);
+    gEdmaNumLinkParams[chIndex] = 0U;
+
+    globalEdmaParams[chIndex].dmaCh = dmaCh;
+    if (EDMA_allocDmaChannel(edmaHandler, &globalEdmaParams[chIndex].dmaCh) == SystemP_SUCCESS)
+    {
+        globalEdmaParams[chIndex].tcc = EDMA_RESOURCE_ALLOC_ANY;
+        if (EDMA_allocTcc(edmaHandler, &globalEdmaParams[chIndex].tcc) == SystemP_SUCCESS)
+        {
+            globalEdmaParams[chIndex].param = EDMA_RESOURCE_ALLOC_ANY;
+            if (EDMA_allocParam(edmaHandler, &globalEdmaParams[chIndex].param) == SystemP_SUCCESS)
+            {
+                status = SystemP_SUCCESS;
+            }
+            else
+            {
+                EDMA_freeTcc(edmaHandler, &globalEdmaParams[chIndex].tcc);
+                EDMA_freeDmaChannel(edmaHandler, &globalEdmaParams[chIndex].dmaCh);
+            }
+        }
+        else
+        {
+            EDMA_freeDmaChannel(edmaHandler, &globalEdmaParams[chIndex].dmaCh);
+        }
+    }
+
+    if (status == SystemP_SUCCESS)
+    {
+        /* Request channel */
+        EDMA_configureChannelRegion(globalEdmaParams[chIndex].baseAddr, globalEdmaParams[chIndex].regionId, EDMA_CHANNEL_TYPE_DMA,
+            globalEdmaParams[chIndex].dmaCh, globalEdmaParams[chIndex].tcc, globalEdmaParams[chIndex].param, EDMA_TEST_EVT_QUEUE_NO);
+        gEdmaChAllocated[chIndex] = 1U;
+    }
+
+    return (status);
+}
+
+/**
+ * \brief Unmaps and frees the DMA channel, TCC and channel PaRAM set of the given channel index.
+ */
+static void EDMA_freeChannel(EDMA_Handle edmaHandler, uint32_t chIndex)
+{
+    /* Free channel */
+    EDMA_freeChannelRegion(globalEdmaParams[chIndex].baseAddr, globalEdmaParams[chIndex].regionId, EDMA_CHANNEL_TYPE_DMA,
+        globalEdmaParams[chIndex].dmaCh, EDMA_TRIG_MODE_MANUAL, globalEdmaParams[chIndex].tcc, EDMA_TEST_EVT_QUEUE_NO);
+
+    /* Free the EDMA resources managed by driver. */
+    EDMA_freeDmaChannel(edmaHandler, &globalEdmaParams[chIndex].dmaCh);
+    EDMA_freeTcc(edmaHandler, &globalEdmaParams[chIndex].tcc);
+    EDMA_freeParam(edmaHandler, &globalEdmaParams[chIndex].param);
+    gEdmaChAllocated[chIndex] = 0U;
+
+    return;
+}
+
+/**
+ * \brief Fills a TX PaRAM set the same way as EDMA_Config_TxChannel does, without the completion options.
+ */
+static void EDMA_setTxParamEntry(EDMACCPaRAMEntry *ptrEntry, uint32_t *srcAddress, uint32_t *dstAddress, uint16_t numBlocks, uint16_t blockSize, int32_t operationType)
+{
+    uint16_t bCnt;
+    int16_t  destBIdx;
+
+    if( operationType == DMA_SHA_ENABLE )
+    {
+        /* SHA: the whole block goes to the same input window */
+        bCnt     = blockSize;
+        destBIdx = (int16_t) EDMA_NULL_INDEX_VALUE;
+    }
+    else
+    {
+        /* AES: DATA_IN_3 down to DATA_IN_0 */
+        bCnt     = (uint16_t) EDMA_B_COUNT_VALUE;
+        destBIdx = (int16_t) EDMA_BINEX_NEGATIVE_VALUE;
+    }
+
+    EDMA_ccPaRAMEntry_init(ptrEntry);
+    ptrEntry->srcAddr       = (uint32_t) srcAddress;
+    ptrEntry->destAddr      = (uint32_t) dstAddress;
+    ptrEntry->aCnt          = (uint16_t) EDMA_A_COUNT_VALUE;
+    ptrEntry->bCnt          = bCnt;
+    ptrEntry->cCnt          = (uint16_t) numBlocks;
+    ptrEntry->bCntReload    = (uint16_t) EDMA_NULL_INDEX_VALUE;
+    ptrEntry->srcBIdx       = (int16_t) EDMA_BINEX_POSITIVE_VALUE;
+    ptrEntry->destBIdx      = destBIdx;
+    ptrEntry->srcCIdx       = (int16_t) (bCnt * EDMA_A_COUNT_VALUE);
+    ptrEntry->destCIdx      = (int16_t) EDMA_NULL_INDEX_VALUE;
+    ptrEntry->linkAddr      = EDMA_LINK_ADDRESS;
+    ptrEntry->srcBIdxExt    = (int8_t) EDMA_PARAM_BIDX_EXT(EDMA_BINEX_POSITIVE_VALUE);
+    ptrEntry->destBIdxExt   = (int8_t) EDMA_PARAM_BIDX_EXT(destBIdx);
+
+    return;
+}
+
+/**
+ * \brief Fills an RX PaRAM set the same way as EDMA_Config_RxChannel does, without the completion options.
+ */
+static void EDMA_setRxParamEntry(EDMACCPaRAMEntry *ptrEntry, uint32_t *srcAddress, uint32_t *dstAddress, uint16_t numBlocks)
+{
+    EDMA_ccPaRAMEntry_init(ptrEntry);
+    ptrEntry->srcAddr       = (uint32_t) srcAddress;
+    ptrEntry->destAddr      = (uint32_t) dstAddress;
+    ptrEntry->aCnt          = (uint16_t) EDMA_A_COUNT_VALUE;
+    ptrEntry->bCnt          = (uint16_t) EDMA_B_COUNT_VALUE;
+    ptrEntry->cCnt          = (uint16_t) numBlocks;
+    ptrEntry->bCntReload    = (uint16_t) EDMA_NULL_INDEX_VALUE;
+    ptrEntry->srcBIdx       = (int16_t) EDMA_BINEX_NEGATIVE_VALUE;
+    ptrEntry->destBIdx      = (int16_t) EDMA_BINEX_POSITIVE_VALUE;
+    ptrEntry->srcCIdx       = (int16_t) EDMA_NULL_INDEX_VALUE;
+    ptrEntry->destCIdx      = (int16_t) EDMA_A_COUNT_VALUE * EDMA_B_COUNT_VALUE;
+    ptrEntry->linkAddr      = EDMA_LINK_ADDRESS;
+    ptrEntry->srcBIdxExt    = (int8_t) EDMA_PARAM_BIDX_EXT(EDMA_BINEX_NEGATIVE_VALUE);
+    ptrEntry->destBIdxExt   = (int8_t) EDMA_PARAM_BIDX_EXT(EDMA_BINEX_POSITIVE_VALUE);
+
+    return;
+}
+
+/**
+ * \brief Sets the AB-synchronized options of a PaRAM set. Only the last set of a list
+ *        raises the completion interrupt, so the wait functions return once the whole list is done.
+ */
+static void EDMA_setParamCompletion(EDMACCPaRAMEntry *ptrEntry, uint32_t tcc, uint8_t isLastEntry)
+{
+    ptrEntry->opt |= (((tcc << EDMA_OPT_TCC_SHIFT) & EDMA_OPT_TCC_MASK) | ((uint32_t)1 << EDMA_OPT_SYNCDIM_SHIFT));
+
+    if (isLastEntry == 1U)
+    {
+        ptrEntry->opt |= EDMA_OPT_TCINTEN_MASK;
+    }
+
+    return;
+}
+
+/**
+ * \brief Writes the first entry into the channel PaRAM set and the others into newly
+ *        allocated PaRAM sets, each one linked to the next.
+ */
+static int32_t EDMA_programSgList(EDMA_Handle edmaHandler, uint32_t chIndex, EDMACCPaRAMEntry *ptrEntries, uint32_t numEntries)
+{
+    int32_t     status = SystemP_SUCCESS;
+    uint32_t    index;
+    uint32_t    paramId;
+    uint32_t    prevParamId = 0U;
+
+    for (index = 1U; (index < numEntries) && (status == SystemP_SUCCESS); index++)
+    {
+        paramId = EDMA_RESOURCE_ALLOC_ANY;
+        if (EDMA_allocParam(edmaHandler, &paramId) == SystemP_SUCCESS)
+        {
+            gEdmaLinkParams[chIndex][gEdmaNumLinkParams[chIndex]] = paramId;
+            gEdmaNumLinkParams[chIndex]++;
+        }
+        else
+        {
+            status = SystemP_FAILURE;
+        }
+    }
+
+    if (status == SystemP_SUCCESS)
+    {
+        /* Program the sets back to front so that a set is complete before it is linked */
+        for (index = numEntries; index > 0U; index--)
+        {
+            if (index == 1U)
+            {
+                paramId = globalEdmaParams[chIndex].param;
+            }
+            else
+            {
+                paramId = gEdmaLinkParams[chIndex][index - 2U];
+            }
+
+            EDMA_setPaRAM(globalEdmaParams[chIndex].baseAddr, paramId, &ptrEntries[index - 1U]);
+
+            if (index < numEntries)
+            {
+                EDMA_linkChannel(globalEdmaParams[chIndex].baseAddr, paramId, prevParamId);
+            }
+            prevParamId = paramId;
+        }
+    }
+
+    return (status);
+}
+
+/**
+ * \brief Releases the PaRAM sets which were linked for a scatter-gather transfer.
+ */
+static void EDMA_freeLinkParams(EDMA_Handle edmaHandler, uint32_t chIndex)
+{
+    uint32_t index;
+
+    for (index = 0U; index < gEdmaNumLinkParams[chIndex]; index++)
+    {
+        EDMA_freeParam(edmaHandler, &gEdmaLinkParams[chIndex][index]);
+    }
+    gEdmaNumLinkParams[chIndex] = 0U;
+
+    return;
+}
+
+/**
+ * \brief Sets the callback of the next completed transfer of the given channel. The interrupt
+ *        object is registered on the channel TCC the first time and stays registered until
+ *        EDMA_closeChannels, as the TCC does not change while the channels are open.
+ */
+static int32_t EDMA_registerCallback(EDMA_Handle edmaHandler, uint32_t chIndex, DMA_TransferCallback callback, void *args)
+{
+    int32_t             status = SystemP_FAILURE;
+    EDMA_TransferCbObj  *ptrCbObj = &gEdmaTransferCbObj[chIndex];
+
+    if (ptrCbObj->isRegistered == 1U)
+    {
         status = SystemP_SUCCESS;
     }
+    else if ((gEdmaChAllocated[chIndex] == 1U) && (EDMA_isInterruptEnabled(edmaHandler) == TRUE))
+    {
+        ptrCbObj->callback          = NULL;
+        ptrCbObj->intrObj.tccNum    = globalEdmaParams[chIndex].tcc;
+        ptrCbObj->intrObj.cbFxn     = &EDMA_transferIsr;
+        ptrCbObj->intrObj.appData   = (void *)ptrCbObj;
+
+        status = EDMA_registerIntr(edmaHandler, &ptrCbObj->intrObj);
+        if (status == SystemP_SUCCESS)
+        {
+            ptrCbObj->isRegistered = 1U;
+        }
+    }
+    else
+    {
+        status = SystemP_FAILURE;
+    }
+
+    if (status == SystemP_SUCCESS)
+    {
+        ptrCbObj->args      = args;
+        ptrCbObj->callback  = callback;
+    }
 
     return (status);
 }
+
+/**
+ * \brief Removes the interrupt object of the given channel, if one was registered.
+ */
+static void EDMA_unregisterCallback(EDMA_Handle edmaHandler, uint32_t chIndex)
+{
+    EDMA_TransferCbObj  *ptrCbObj = &gEdmaTransferCbObj[chIndex];
+
+    if (ptrCbObj->isRegistered == 1U)
+    {
+        (void)EDMA_unregisterIntr(edmaHandler, &ptrCbObj->intrObj);
+        ptrCbObj->isRegistered  = 0U;
+        ptrCbObj->callback      = NULL;
+        ptrCbObj->args          = NULL;
+    }
+
+    return;
+}
+
+/**
+ * \brief EDMA transfer completion interrupt: flags the transfer as done and forwards to the
+ *        DMA layer callback, which is called once.
+ */
+static void EDMA_transferIsr(Edma_IntrHandle intrHandle, void *args)
+{
+    EDMA_TransferCbObj      *ptrCbObj = (EDMA_TransferCbObj *)args;
+    DMA_TransferCallback    callback;
+
+    (void)intrHandle;
+    if (ptrCbObj != NULL)
+    {
+        callback = ptrCbObj->callback;
+        ptrCbObj->callback = NULL;
+        ptrCbObj->isDone = 1U;
+        if (callback != NULL)
+        {
+            callback(ptrCbObj->args);
+        }
+    }
+
+    return;
+}
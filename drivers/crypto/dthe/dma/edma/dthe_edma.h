@@ -84,28 +84,31 @@ int32_t EDMA_Config_TxChannel(DMA_Handle handle, uint32_t *srcAddress, uint32_t
  * \brief This EDMA api implemented to enable DMA TX transfer region.
  *
  * \param handle    [IN] DMA driver handle from \ref DMA_open
+ * \param operationType [IN] for selecting Aes Or SHA channel.
  *
  * \return SystemP_SUCCESS on success or SystemP_SUCCESS_FAILURE on Failure.
  */
-int32_t EDMA_enableTxTransferRegion(DMA_Handle handle);
+int32_t EDMA_enableTxTransferRegion(DMA_Handle handle, int32_t operationType);
 
 /**
  * \brief This EDMA api implemented to wait TX transfer.
  *
  * \param handle    [IN] DMA driver handle from \ref DMA_open
- * 
+ * \param operationType [IN] for selecting Aes Or SHA channel.
+ *
  * \return SystemP_SUCCESS on success or SystemP_SUCCESS_FAILURE on Failure.
  */
-int32_t EDMA_WaitForTxTransfer(DMA_Handle handle);
+int32_t EDMA_WaitForTxTransfer(DMA_Handle handle, int32_t operationType);
 
 /**
  * \brief This EDMA api implemented to disable DMA TX channel.
  *
  * \param handle    [IN] DMA driver handle from \ref DMA_open
+ * \param operationType [IN] for selecting Aes Or SHA channel.
  *
  * \return SystemP_SUCCESS on success or SystemP_SUCCESS_FAILURE on Failure.
  */
-int32_t EDMA_disableTxChannel(DMA_Handle handle);
+int32_t EDMA_disableTxChannel(DMA_Handle handle, int32_t operationType);
 
 /**
  *  \brief This EDMA api implemented to configure EDMA config TX channel.
@@ -146,6 +149,79 @@ int32_t EDMA_WaitForRxTransfer(DMA_Handle handle);
  */
 int32_t EDMA_disableRxChannel(DMA_Handle handle);
 
+/**
+ *  \brief This EDMA api implemented to configure EDMA TX channel from a scatter-gather list.
+ *         One PaRAM set is programmed per entry and the sets are linked, so the
+ *         whole list is transferred on the same channel without CPU involvement.
+ *         Only the last set raises the transfer completion.
+ *
+ *  \param handle    [IN] DMA driver handle from \ref DMA_open
+ *  \param sgList [IN] List of source entries.
+ *  \param numEntries [IN] Number of entries in the list.
+ *  \param dstAddress [IN] Destination address for EDMA transfer.
+ *  \param blockSize [IN] Block size for sha config.
+ *  \param operationType  [IN] for selecting Aes Or SHA cfg.
+ *
+ *  \return SystemP_SUCCESS on success or SystemP_SUCCESS_FAILURE on Failure.
+ */
+int32_t EDMA_Config_TxSgChannel(DMA_Handle handle, const DMA_SgEntry *sgList, uint32_t numEntries, uint32_t *dstAddress, uint16_t blockSize, int32_t operationType);
+
+/**
+ *  \brief This EDMA api implemented to configure EDMA RX channel into a scatter-gather list.
+ *         One PaRAM set is programmed per entry and the sets are linked.
+ *
+ *  \param handle    [IN] DMA driver handle from \ref DMA_open
+ *  \param srcAddress [IN] Source address for EDMA transfer.
+ *  \param sgList [IN] List of destination entries.
+ *  \param numEntries [IN] Number of entries in the list.
+ *
+ *  \return SystemP_SUCCESS on success or SystemP_SUCCESS_FAILURE on Failure.
+ */
+int32_t EDMA_Config_RxSgChannel(DMA_Handle handle, uint32_t *srcAddress, const DMA_SgEntry *sgList, uint32_t numEntries);
+
+/**
+ *  \brief This EDMA api implemented to register a completion callback on the TCC of the TX channel.
+ *
+ *  \param handle    [IN] DMA driver handle from \ref DMA_open
+ *  \param callback  [IN] Function called from the EDMA completion interrupt.
+ *  \param args      [IN] Argument passed to the callback.
+ *  \param operationType [IN] for selecting Aes Or SHA channel.
+ *
+ *  \return SystemP_SUCCESS on success or SystemP_SUCCESS_FAILURE on Failure.
+ */
+int32_t EDMA_registerTxCallback(DMA_Handle handle, DMA_TransferCallback callback, void *args, int32_t operationType);
+
+/**
+ *  \brief This EDMA api implemented to register a completion callback on the TCC of the RX channel.
+ *
+ *  \param handle    [IN] DMA driver handle from \ref DMA_open
+ *  \param callback  [IN] Function called from the EDMA completion interrupt.
+ *  \param args      [IN] Argument passed to the callback.
+ *
+ *  \return SystemP_SUCCESS on success or SystemP_SUCCESS_FAILURE on Failure.
+ */
+int32_t EDMA_registerRxCallback(DMA_Handle handle, DMA_TransferCallback callback, void *args);
+
+/**
+ *  \brief This EDMA api implemented to allocate the AES TX, AES RX and SHA TX channels with their
+ *         TCCs and PaRAM sets, and to prebuild their PaRAM sets. The channel configuration apis
+ *         call it when the channels are not open yet.
+ *
+ *  \param handle    [IN] DMA driver handle from \ref DMA_open
+ *
+ *  \return SystemP_SUCCESS on success or SystemP_SUCCESS_FAILURE on Failure.
+ */
+int32_t EDMA_openChannels(DMA_Handle handle);
+
+/**
+ *  \brief This EDMA api implemented to free the resources allocated by \ref EDMA_openChannels.
+ *
+ *  \param handle    [IN] DMA driver handle from \ref DMA_open
+ *
+ *  \return SystemP_SUCCESS on success or SystemP_SUCCESS_FAILURE on Failure.
+ */
+int32_t EDMA_closeChannels(DMA_Handle handle);
+
 /* ========================================================================== */
 /*                       Static Function Definitions                          */
 /* ========================================================================== */
@@ -95,6 +95,17 @@ DTHE_Handle DTHE_open(uint32_t index)
         }
     }
 
+    if((DTHE_RETURN_SUCCESS == status) && (config->dmaEnable == DMA_ENABLE))
+    {
+        /* The DMA channels, TCCs and PaRAM sets are held until DTHE_close, so that
+         * each AES or SHA operation only patches addresses and counts */
+        if(DMA_openChannels(DMA_open(0U)) != DMA_RETURN_SUCCESS)
+        {
+            status = DTHE_RETURN_FAILURE;
+            attrs->faultStatus = status;
+        }
+    }
+
     if(DTHE_RETURN_SUCCESS == status)
     {
         attrs->isOpen = TRUE;
@@ -125,6 +136,10 @@ DTHE_Return_t DTHE_close(DTHE_Handle handle)
 			attrs = config->attrs;
 			DebugP_assert(NULL != attrs);
 			attrs->isOpen = FALSE;
+			if(config->dmaEnable == DMA_ENABLE)
+			{
+				(void)DMA_closeChannels(DMA_open(0U));
+			}
 			/* To disable module */
 			handle = NULL;
 			status  = DTHE_RETURN_SUCCESS;
@@ -134,3 +149,204 @@ DTHE_Return_t DTHE_close(DTHE_Handle handle)
     return (status);
 }
 
+uint32_t DTHE_getSegmentsLength(const DTHE_Segment *ptrSegments, uint32_t numSegments)
+{
+    uint32_t index;
+    uint32_t totalLen = 0U;
+
+    for (index = 0U; index < numSegments; index++)
+    {
+        totalLen = totalLen + ptrSegments[index].len;
+    }
+
+    return (totalLen);
+}
+
+void DTHE_gatherSegments(const DTHE_Segment *ptrSegments, uint32_t numSegments, uint32_t offset, uint8_t *ptrDst, uint32_t len)
+{
+    uint32_t index = 0U;
+    uint32_t segOffset = offset;
+    uint32_t copyLen;
+    uint32_t done = 0U;
+
+    /* Find the segment holding the first byte */
+    while ((index < numSegments) && (segOffset >= ptrSegments[index].len))
+    {
+        segOffset = segOffset - ptrSegments[index].len;
+        index++;
+    }
+
+    while ((index < numSegments) && (done < len))
+    {
+        copyLen = ptrSegments[index].len - segOffset;
+        if (copyLen > (len - done))
+        {
+            copyLen = len - done;
+        }
+        (void)memcpy((void *)&ptrDst[done], (const void *)&ptrSegments[index].ptr[segOffset], copyLen);
+        done = done + copyLen;
+        segOffset = 0U;
+        index++;
+    }
+
+    return;
+}
+
+void DTHE_scatterSegments(const DTHE_Segment *ptrSegments, uint32_t numSegments, uint32_t offset, const uint8_t *ptrSrc, uint32_t len)
+{
+    uint32_t index = 0U;
+    uint32_t segOffset = offset;
+    uint32_t copyLen;
+    uint32_t done = 0U;
+
+    /* Find the segment holding the first byte */
+    while ((index < numSegments) && (segOffset >= ptrSegments[index].len))
+    {
+        segOffset = segOffset - ptrSegments[index].len;
+        index++;
+    }
+
+    while ((index < numSegments) && (done < len))
+    {
+        copyLen = ptrSegments[index].len - segOffset;
+        if (copyLen > (len - done))
+        {
+            copyLen = len - done;
+        }
+        (void)memcpy((void *)&ptrSegments[index].ptr[segOffset], (const void *)&ptrSrc[done], copyLen);
+        done = done + copyLen;
+        segOffset = 0U;
+        index++;
+    }
+
+    return;
+}
+
+DTHE_Return_t DTHE_buildDmaList(const DTHE_Segment *ptrSegments, uint32_t numSegments, uint32_t blockSize,
+                                uint32_t numBlocks, uint8_t *ptrBounce, uint32_t isInput, DTHE_DmaList *ptrDmaList)
+{
+    DTHE_Return_t   status = DTHE_RETURN_SUCCESS;
+    uint32_t        segIndex = 0U;
+    uint32_t        segOffset = 0U;
+    uint32_t        streamOffset = 0U;
+    uint32_t        totalLen = numBlocks * blockSize;
+    uint32_t        runBlocks = 0U;
+    uint32_t        skipLen;
+    uint32_t        avail = 0U;
+    uint8_t         *ptrEntry = NULL;
+    DMA_SgEntry     *ptrLast;
+
+    ptrDmaList->numEntries = 0U;
+    ptrDmaList->numBounce  = 0U;
+
+    while ((streamOffset < totalLen) && (status == DTHE_RETURN_SUCCESS))
+    {
+        /* Skip the segments which are used up */
+        while ((segIndex < numSegments) && (segOffset >= ptrSegments[segIndex].len))
+        {
+            segIndex++;
+            segOffset = 0U;
+        }
+        if (segIndex >= numSegments)
+        {
+            /* The segments are shorter than the requested blocks */
+            status = DTHE_RETURN_FAILURE;
+            runBlocks = 0U;
+            ptrEntry = NULL;
+        }
+        else
+        {
+            avail = ptrSegments[segIndex].len - segOffset;
+        }
+
+        if (status != DTHE_RETURN_SUCCESS)
+        {
+            /* Nothing to add */
+        }
+        else if (avail >= blockSize)
+        {
+            /* Whole blocks are transferred in place */
+            runBlocks = avail / blockSize;
+            if (runBlocks > ((totalLen - streamOffset) / blockSize))
+            {
+                runBlocks = (totalLen - streamOffset) / blockSize;
+            }
+            if (runBlocks > 0xFFFFU)
+            {
+                runBlocks = 0xFFFFU;
+            }
+            ptrEntry = &ptrSegments[segIndex].ptr[segOffset];
+            segOffset = segOffset + (runBlocks * blockSize);
+        }
+        else if (ptrDmaList->numBounce >= DMA_MAX_SG_ENTRIES)
+        {
+            /* Out of bounce blocks */
+            status = DTHE_RETURN_FAILURE;
+        }
+        else
+        {
+            /* The block straddles a segment boundary: go through a bounce block */
+            runBlocks = 1U;
+            ptrEntry = &ptrBounce[ptrDmaList->numBounce * blockSize];
+            if (isInput == TRUE)
+            {
+                DTHE_gatherSegments(ptrSegments, numSegments, streamOffset, ptrEntry, blockSize);
+            }
+            ptrDmaList->bounceOffset[ptrDmaList->numBounce] = streamOffset;
+            ptrDmaList->numBounce++;
+
+            /* Move past the block in the segment list */
+            skipLen = blockSize;
+            while ((segIndex < numSegments) && (skipLen > 0U))
+            {
+                avail = ptrSegments[segIndex].len - segOffset;
+                if (avail > skipLen)
+                {
+                    segOffset = segOffset + skipLen;
+                    skipLen = 0U;
+                }
+                else
+                {
+                    skipLen = skipLen - avail;
+                    segIndex++;
+                    segOffset = 0U;
+                }
+            }
+        }
+
+        /* Extend the previous entry when this one follows it in memory */
+        ptrLast = NULL;
+        if ((status == DTHE_RETURN_SUCCESS) && (ptrDmaList->numEntries > 0U))
+        {
+            ptrLast = &ptrDmaList->entries[ptrDmaList->numEntries - 1U];
+            if ((((uint8_t *)ptrLast->address) + ((uint32_t)ptrLast->numBlocks * blockSize) != ptrEntry) ||
+                (((uint32_t)ptrLast->numBlocks + runBlocks) > 0xFFFFU))
+            {
+                ptrLast = NULL;
+            }
+        }
+
+        if (status != DTHE_RETURN_SUCCESS)
+        {
+            /* Nothing to add */
+        }
+        else if (ptrLast != NULL)
+        {
+            ptrLast->numBlocks = (uint16_t)(ptrLast->numBlocks + runBlocks);
+        }
+        else if (ptrDmaList->numEntries < DMA_MAX_SG_ENTRIES)
+        {
+            ptrDmaList->entries[ptrDmaList->numEntries].address   = (uint32_t *)(void *)ptrEntry;
+            ptrDmaList->entries[ptrDmaList->numEntries].numBlocks = (uint16_t)runBlocks;
+            ptrDmaList->numEntries++;
+        }
+        else
+        {
+            status = DTHE_RETURN_FAILURE;
+        }
+
+        streamOffset = streamOffset + (runBlocks * blockSize);
+    }
+
+    return (status);
+}
@@ -57,6 +57,7 @@
 #include <security_common/drivers/crypto/dthe/hw_include/cslr_dthe.h>
 #include <drivers/hw_include/cslr_soc.h>
 #include <security_common/drivers/crypto/dthe/dma/device_includes.h>
+#include <security_common/drivers/crypto/dthe/dma.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -84,6 +85,43 @@ typedef enum DTHE_Return_e
 /** \brief Handle to the DTHE driver */
 typedef void *DTHE_Handle;
 
+/** \brief Token identifying an asynchronous DTHE job */
+typedef uint32_t DTHE_JobToken;
+
+/** \brief Job token value which does not identify any job */
+#define DTHE_JOB_TOKEN_INVALID              (0U)
+
+/** \brief Largest number of blocks one DMA transfer, and so one asynchronous job, can move */
+#define DTHE_JOB_MAX_BLOCKS                 (0xFFFFU)
+
+/**
+ * \brief One segment of a scatter-gather buffer list.
+ *        The segments are processed in order as one continuous stream of bytes.
+ */
+typedef struct DTHE_Segment_t
+{
+    uint8_t                 *ptr;
+    /**< Address of the segment */
+    uint32_t                len;
+    /**< Length of the segment in bytes, zero length segments are skipped */
+} DTHE_Segment;
+
+/**
+ * \brief DMA list built from a segment list by #DTHE_buildDmaList.
+ *        Engine blocks which straddle two segments are moved through bounce blocks.
+ */
+typedef struct DTHE_DmaList_t
+{
+    DMA_SgEntry             entries[DMA_MAX_SG_ENTRIES];
+    /**< DMA entries */
+    uint32_t                numEntries;
+    /**< Number of valid DMA entries */
+    uint32_t                bounceOffset[DMA_MAX_SG_ENTRIES];
+    /**< Stream offset of each bounce block */
+    uint32_t                numBounce;
+    /**< Number of bounce blocks used */
+} DTHE_DmaList;
+
 /** \brief DTHE attributes */
 typedef struct
 {
@@ -100,6 +138,10 @@ typedef struct
     /**< Flag to indicate whether the instance is opened already */
     uint32_t				faultStatus;
     /**< Flag to ascertain whether the handle was opened successfully */
+    void                    *aesActiveCtx;
+    /**< AES context currently loaded in the AES engine, NULL if none */
+    void                    *shaActiveCtx;
+    /**< SHA context currently loaded in the SHA engine, NULL if none */
 } DTHE_Attrs;
 
 /** \brief DTHE driver context */
@@ -153,6 +195,59 @@ DTHE_Handle DTHE_open(uint32_t index);
  */
 DTHE_Return_t DTHE_close(DTHE_Handle handle);
 
+/**
+ *  \brief          Function to get the total length of a segment list.
+ *
+ *  \param  ptrSegments  Pointer to the segment list.
+ *  \param  numSegments  Number of segments in the list.
+ *
+ *  \return         Total length in bytes.
+ */
+uint32_t DTHE_getSegmentsLength(const DTHE_Segment *ptrSegments, uint32_t numSegments);
+
+/**
+ *  \brief          Function to copy bytes out of a segment list into a linear buffer.
+ *
+ *  \param  ptrSegments  Pointer to the segment list.
+ *  \param  numSegments  Number of segments in the list.
+ *  \param  offset       Offset in the stream of the first byte to be copied.
+ *  \param  ptrDst       Destination buffer.
+ *  \param  len          Number of bytes to be copied.
+ */
+void DTHE_gatherSegments(const DTHE_Segment *ptrSegments, uint32_t numSegments, uint32_t offset, uint8_t *ptrDst, uint32_t len);
+
+/**
+ *  \brief          Function to copy bytes from a linear buffer into a segment list.
+ *
+ *  \param  ptrSegments  Pointer to the segment list.
+ *  \param  numSegments  Number of segments in the list.
+ *  \param  offset       Offset in the stream of the first byte to be written.
+ *  \param  ptrSrc       Source buffer.
+ *  \param  len          Number of bytes to be copied.
+ */
+void DTHE_scatterSegments(const DTHE_Segment *ptrSegments, uint32_t numSegments, uint32_t offset, const uint8_t *ptrSrc, uint32_t len);
+
+/**
+ *  \brief          Function to split the first numBlocks engine blocks of a segment list into DMA entries.
+ *                  Runs of whole blocks inside a segment are transferred in place. A block which
+ *                  straddles two segments is assigned a bounce block: for input lists the bounce
+ *                  block is filled here, for output lists the caller copies it out with
+ *                  #DTHE_scatterSegments once the transfer is done.
+ *
+ *  \param  ptrSegments  Pointer to the segment list.
+ *  \param  numSegments  Number of segments in the list.
+ *  \param  blockSize    Size of the engine block in bytes.
+ *  \param  numBlocks    Number of blocks to be covered.
+ *  \param  ptrBounce    Bounce area of #DMA_MAX_SG_ENTRIES blocks.
+ *  \param  isInput      TRUE to fill the bounce blocks from the segments.
+ *  \param  ptrDmaList   DMA list populated by the API.
+ *
+ *  \return         #DTHE_RETURN_SUCCESS if the list fits in #DMA_MAX_SG_ENTRIES entries.
+ *                  #DTHE_RETURN_FAILURE otherwise; the caller then falls back to CPU transfers.
+ */
+DTHE_Return_t DTHE_buildDmaList(const DTHE_Segment *ptrSegments, uint32_t numSegments, uint32_t blockSize,
+                                uint32_t numBlocks, uint8_t *ptrBounce, uint32_t isInput, DTHE_DmaList *ptrDmaList);
+
 #ifdef __cplusplus
 }
 #endif
@@ -42,7 +42,10 @@
 
 #include <string.h>
 #include <security_common/drivers/crypto/dthe/dthe_aes.h>
+#include <security_common/drivers/crypto/dthe/dthe_aes_sw.h>
 #include <security_common/drivers/crypto/dthe/dma.h>
+#include <kernel/dpl/CacheP.h>
+#include <kernel/dpl/SemaphoreP.h>
 /* ========================================================================== */
 /*                           Macros & Typedefs                                */
 /* ========================================================================== */
@@ -55,11 +58,79 @@
 /** This is the state of a stream in progress */
 #define     AES_STATE_IN_PROGRESS       (0xA5U)
 
+/** No asynchronous job was submitted since the driver was opened */
+#define     DTHE_AES_JOB_STATE_IDLE     (0x00U)
+
+/** The asynchronous job owns the engine */
+#define     DTHE_AES_JOB_STATE_RUNNING  (0x5AU)
+
+/** The DMA of the asynchronous job is done, the job is finished from task context */
+#define     DTHE_AES_JOB_STATE_DMA_DONE (0x96U)
+
+/** The asynchronous job is complete */
+#define     DTHE_AES_JOB_STATE_DONE     (0xC3U)
+
+/** Shortest batched CMAC message, in blocks, which is moved by DMA rather than written by the CPU */
+#define     DTHE_AES_CMAC_BATCH_DMA_MIN_BLOCKS  (8U)
+
 /* ========================================================================== */
 /*                         Structure Declarations                             */
 /* ========================================================================== */
 
-static uint8_t gStreamState = AES_STATE_NEW;
+/**
+ * \brief 4-bit multiplication table of the GHASH key H, used to derive the
+ *        GCM pre-counter block for IVs which are not 96 bits long.
+ */
+typedef struct DTHE_AES_GhashTable_t
+{
+    uint64_t    hl[16U];    /**< Low 64 bits of the multiples of H */
+    uint64_t    hh[16U];    /**< High 64 bits of the multiples of H */
+}DTHE_AES_GhashTable;
+
+/**
+ * \brief State of an asynchronous AES job. The engine runs one job at a time, the job
+ *        is started by #DTHE_AES_submit, its DMA completes in the DMA interrupt and the
+ *        partial last block and the tag are handled by #DTHE_AES_wait.
+ */
+typedef struct DTHE_AES_Job_t
+{
+    DTHE_Handle             handle;             /**< Driver handle the job was submitted on */
+    DTHE_AES_Params         params;             /**< Parameters used to finish the stream */
+    DTHE_AES_Context        oneShotContext;     /**< Context of a one-shot without a context of its own */
+    DTHE_AES_Context        *ptrContext;        /**< Context of the job */
+    uint32_t                streamState;        /**< Stream state as submitted */
+    uint32_t                numBlocks;          /**< Number of full blocks moved by the DMA */
+    uint32_t                *ptrTailIn;         /**< Input of the partial last block */
+    uint32_t                *ptrTailOut;        /**< Output of the partial last block */
+    uint32_t                tailLen;            /**< Length of the partial last block */
+    uint8_t                 isOutputRequired;   /**< Flag which indicates if output blocks are read */
+    DMA_Handle              dmaHandle;          /**< DMA handle while the channels are held */
+    DTHE_AES_JobCallback    callback;           /**< Completion callback, can be NULL */
+    void                    *args;              /**< Argument of the completion callback */
+    DTHE_JobToken           token;              /**< Token of the job */
+    volatile uint32_t       state;              /**< State of the job */
+    volatile DTHE_AES_Return_t status;          /**< Result of the job once done */
+    SemaphoreP_Object       doneSem;            /**< Posted when the job is done */
+}DTHE_AES_Job;
+
+/** Context used by streaming operations which do not provide their own context */
+static DTHE_AES_Context gDtheAesDefaultContext;
+
+/** Asynchronous AES job */
+static DTHE_AES_Job gDtheAesJob;
+
+/** Bounce blocks for input blocks which straddle two segments of a scatter-gather list */
+static uint32_t gDtheAesSgInBounce[DMA_MAX_SG_ENTRIES * DTHE_AES_BLOCK_SIZE_WORDS];
+
+/** Bounce blocks for output blocks which straddle two segments of a scatter-gather list */
+static uint32_t gDtheAesSgOutBounce[DMA_MAX_SG_ENTRIES * DTHE_AES_BLOCK_SIZE_WORDS];
+
+/** Reduction constants for the 4-bit table GHASH multiplication */
+static const uint64_t gDtheAesGhashLast4[16U] =
+{
+    0x0000U, 0x1C20U, 0x3840U, 0x2460U, 0x7080U, 0x6CA0U, 0x48C0U, 0x54E0U,
+    0xE100U, 0xFD20U, 0xD940U, 0xC560U, 0x9180U, 0x8DA0U, 0xA9C0U, 0xB5E0U
+};
 
 /* ========================================================================== */
 /*                 Internal Function Declarations                             */
@@ -88,6 +159,47 @@ static void DTHE_AES_readTag(CSL_AesRegs *ptrAesRegs, uint32_t* ptrTag);
 static void DTHE_AES_clearAllInterrupts(CSL_AesRegs *ptrAesRegs);
 static void DTHE_AES_setCCM_L(CSL_AesRegs *ptrAesRegs, uint32_t ccmLenBytes);
 static void DTHE_AES_setCCM_M(CSL_AesRegs *ptrAesRegs, uint32_t ccmMLenBytes);
+static void DTHE_AES_captureContext(DTHE_AES_Context *ptrContext, const DTHE_AES_Params* ptrParams);
+static void DTHE_AES_programContext(CSL_AesRegs *ptrAesRegs, const DTHE_AES_Context *ptrContext, const uint32_t* ptrIV);
+static void DTHE_AES_saveContext(CSL_AesRegs *ptrAesRegs, DTHE_AES_Context *ptrContext);
+static DTHE_AES_Return_t DTHE_AES_switchOutContext(CSL_AesRegs *ptrAesRegs, DTHE_Attrs *attrs, const DTHE_AES_Context *ptrNextContext);
+static DTHE_AES_Return_t DTHE_AES_process(DTHE_Handle handle, const DTHE_AES_Params* ptrParams);
+static DTHE_AES_Return_t DTHE_AES_startStream(DTHE_Handle handle, const DTHE_AES_Params* ptrParams, uint32_t totalLen,
+                                              DTHE_AES_Context *ptrOneShotContext, DTHE_AES_Params* ptrStreamParams,
+                                              DTHE_AES_Context **ptrPtrContext);
+static DTHE_AES_Return_t DTHE_AES_finishStream(DTHE_Handle handle, DTHE_AES_Params* ptrStreamParams,
+                                               uint32_t* ptrTailIn, uint32_t* ptrTailOut, uint32_t tailLen);
+static void DTHE_AES_abortOneShot(DTHE_Attrs *attrs, uint32_t streamState, DTHE_AES_Context *ptrContext);
+static DTHE_AES_Return_t DTHE_AES_reapJob(void);
+static void DTHE_AES_jobDmaComplete(void *args);
+static void DTHE_AES_finishJob(DTHE_AES_Job *ptrJob);
+static DTHE_AES_Return_t DTHE_AES_resumeContext(CSL_AesRegs *ptrAesRegs, DTHE_Attrs *attrs, DTHE_AES_Context *ptrContext);
+static uint8_t DTHE_AES_isOutputRequired(const DTHE_AES_Params* ptrParams);
+static DTHE_AES_Return_t DTHE_AES_checkStreamBuffers(const DTHE_AES_Params* ptrParams, const DTHE_AES_Context *ptrContext);
+static void DTHE_AES_processBlocks(const DTHE_Config *config, CSL_AesRegs *ptrAesRegs, uint8_t isOutputRequired,
+                                   uint32_t* ptrInput, uint32_t* ptrOutput, uint16_t numBlocks);
+static void DTHE_AES_processUnalignedBlocks(CSL_AesRegs *ptrAesRegs, uint8_t isOutputRequired,
+                                            const uint8_t* ptrInput, uint32_t* ptrOutput, uint32_t numBlocks);
+static void DTHE_AES_processBlocksSG(const DTHE_Config *config, CSL_AesRegs *ptrAesRegs, uint8_t isOutputRequired,
+                                     const DTHE_Segment* ptrInSegments, uint32_t numInSegments,
+                                     const DTHE_Segment* ptrOutSegments, uint32_t numOutSegments, uint32_t numBlocks);
+static void DTHE_AES_pollNewContextReady(CSL_AesRegs *ptrAesRegs);
+static void DTHE_AES_loadXtsTweak(CSL_AesRegs *ptrAesRegs, const uint32_t* ptrTweak);
+static void DTHE_AES_processAAD(const DTHE_Config *config, CSL_AesRegs *ptrAesRegs, uint32_t* ptrAAD, uint32_t aadLenBytes);
+static void DTHE_AES_processAADAndBlocks(const DTHE_Config *config, CSL_AesRegs *ptrAesRegs, uint32_t* ptrAAD, uint32_t aadLenBytes,
+                                         uint8_t isOutputRequired, uint32_t* ptrInput, uint32_t* ptrOutput, uint16_t numBlocks);
+static uint8_t DTHE_AES_hasSeparateAAD(const DTHE_AES_Params* ptrParams);
+static void DTHE_AES_computeGcmJ0(CSL_AesRegs *ptrAesRegs, const DTHE_AES_Context *ptrContext, const uint32_t* ptrIV, uint32_t ivLenBytes, uint32_t* ptrJ0);
+static void DTHE_AES_encryptZeroBlock(CSL_AesRegs *ptrAesRegs, const DTHE_AES_Context *ptrContext, uint32_t* ptrOutput);
+static DTHE_AES_Return_t DTHE_AES_finishGcmTag(CSL_AesRegs *ptrAesRegs, const DTHE_AES_Params* ptrParams);
+static DTHE_AES_Return_t DTHE_AES_compareTags(const uint8_t *ptrComputedTag, const uint8_t *ptrReceivedTag, uint32_t tagLenBytes);
+static DTHE_AES_Return_t DTHE_AES_cmacBatchProcess(DTHE_Handle handle, const DTHE_AES_Params* ptrParams,
+                                                   DTHE_AES_CmacMessage* ptrMessages, uint32_t numMessages, uint8_t isVerify);
+static uint64_t DTHE_AES_getBE64(const uint8_t *ptrData);
+static void DTHE_AES_putBE64(uint8_t *ptrData, uint64_t value);
+static void DTHE_AES_ghashInitTable(DTHE_AES_GhashTable *ptrTable, const uint8_t *ptrHashKey);
+static void DTHE_AES_ghashMultiply(const DTHE_AES_GhashTable *ptrTable, uint8_t *ptrBlock);
+static void DTHE_AES_ghashUpdate(const DTHE_AES_GhashTable *ptrTable, uint8_t *ptrState, const uint8_t *ptrData, uint32_t dataLen);
 /* ========================================================================== */
 /*                          Function Definitions                              */
 /* ========================================================================== */
@@ -104,6 +216,10 @@ static void DTHE_AES_resetModule(CSL_AesRegs *ptrAesRegs)
 
 static void DTHE_AES_controlMode(CSL_AesRegs *ptrAesRegs, uint32_t algoType)
 {
+    /* Combined modes are only selected by their own branch below */
+    CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_GCM, CSL_AES_S_CTRL_GCM_NOOP);
+    CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_CCM, CSL_AES_S_CTRL_CCM_RESETVAL);
+
 	if(algoType == DTHE_AES_ECB_MODE)
     {
         CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_MODE, CSL_AES_S_CTRL_MODE_ECB);
@@ -183,7 +299,8 @@ static void DTHE_AES_controlMode(CSL_AesRegs *ptrAesRegs, uint32_t algoType)
     }
     else if(algoType == DTHE_AES_XTS_MODE)
     {
-        CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_XTS, CSL_AES_S_CTRL_XTS_NOOP);
+        /* Key2, i and j=0 are loaded: the engine encrypts i with key2 to get the first tweak */
+        CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_XTS, CSL_AES_S_CTRL_XTS_XTS11);
         CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_MODE, CSL_AES_S_CTRL_MODE_ECB);
         CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_CTR, CSL_AES_S_CTRL_CTR_RESETVAL);
         CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_ICM, CSL_AES_S_CTRL_ICM_RESETVAL);
@@ -215,6 +332,19 @@ static void DTHE_AES_controlMode(CSL_AesRegs *ptrAesRegs, uint32_t algoType)
         CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_F9, CSL_AES_S_CTRL_F9_RESETVAL);
         CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_CBCMAC, CSL_AES_S_CTRL_CBCMAC_RESETVAL);
     }
+    else if(algoType == DTHE_AES_GCM_MODE)
+    {
+        /* GCM with the hash key H and the encrypted pre-counter block computed by the engine */
+        CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_GCM, CSL_AES_S_CTRL_GCM_GCM11);
+        CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_CTR, CSL_AES_S_CTRL_CTR_CTR);
+        CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_XTS, CSL_AES_S_CTRL_XTS_NOOP);
+        CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_MODE, CSL_AES_S_CTRL_MODE_ECB);
+        CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_ICM, CSL_AES_S_CTRL_ICM_RESETVAL);
+        CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_CFB, CSL_AES_S_CTRL_CFB_RESETVAL);
+        CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_F8, CSL_AES_S_CTRL_F8_RESETVAL);
+        CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_F9, CSL_AES_S_CTRL_F9_RESETVAL);
+        CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_CBCMAC, CSL_AES_S_CTRL_CBCMAC_RESETVAL);
+    }
 }
 
 static void DTHE_AES_CTRWidth(CSL_AesRegs *ptrAesRegs, uint32_t ctrWidth)
@@ -310,7 +440,15 @@ DTHE_AES_Return_t DTHE_AES_open(DTHE_Handle handle)
         attrs           = config->attrs;
         ptrAesRegs      = (CSL_AesRegs *)attrs->aesBaseAddr;
 
-        gStreamState = AES_STATE_NEW;
+        DTHE_AES_Context_init(&gDtheAesDefaultContext);
+        attrs->aesActiveCtx = NULL;
+
+        gDtheAesJob.state       = DTHE_AES_JOB_STATE_IDLE;
+        gDtheAesJob.dmaHandle   = NULL;
+        if (SemaphoreP_constructBinary(&gDtheAesJob.doneSem, 0U) != SystemP_SUCCESS)
+        {
+            status = DTHE_AES_RETURN_FAILURE;
+        }
 
         /* Soft-Reset AES Module */
 		DTHE_AES_resetModule(ptrAesRegs);
@@ -328,12 +466,46 @@ DTHE_AES_Return_t DTHE_AES_open(DTHE_Handle handle)
 }
 
 DTHE_AES_Return_t DTHE_AES_execute(DTHE_Handle handle, const DTHE_AES_Params* ptrParams)
+{
+    DTHE_AES_Return_t status;
+    uint32_t          impl = DTHE_AES_SW_IMPL_CONST_TIME;
+
+    if ((NULL != handle) && (NULL != ptrParams) && (DTHE_AES_isSwDispatched(ptrParams, &impl) == 1U))
+    {
+        /* Short operations are cheaper in software than programming the engine */
+        status = DTHE_AES_executeSw(ptrParams, impl);
+    }
+    else
+    {
+        /* The engine is not available while an asynchronous job runs */
+        status = DTHE_AES_reapJob();
+        if (status == DTHE_AES_RETURN_SUCCESS)
+        {
+            status = DTHE_AES_process(handle, ptrParams);
+        }
+    }
+
+    return (status);
+}
+
+/**
+ * \brief                   The function is used to run one AES operation with the specified parameters.
+ *                          It is the body of #DTHE_AES_execute and is also used by the scatter-gather and
+ *                          the asynchronous paths, which check the engine availability themselves.
+ *
+ * \param   handle          #DTHE_Handle returned from #DTHE_open().
+ *
+ * \param   ptrParams       Pointer to the parameters to be used to execute the driver.
+ *
+ * \return                  #DTHE_AES_RETURN_SUCCESS if requested operation completed.
+ *                          #DTHE_AES_RETURN_FAILURE if requested operation not completed.
+ */
+static DTHE_AES_Return_t DTHE_AES_process(DTHE_Handle handle, const DTHE_AES_Params* ptrParams)
 {
     DTHE_AES_Return_t status  = DTHE_AES_RETURN_FAILURE;
     DTHE_Config       *config = NULL;
     DTHE_Attrs        *attrs  = NULL;
     CSL_AesRegs     *ptrAesRegs;
-    DMA_Handle      dmaHandle = NULL;
     uint32_t*       ptrWordInputBuffer;
     uint32_t*       ptrWordOutputBuffer;
     uint32_t        dataLenWords;
@@ -343,8 +515,19 @@ DTHE_AES_Return_t DTHE_AES_execute(DTHE_Handle handle, const DTHE_AES_Params* pt
     uint32_t        numBytes = 0U;
     uint8_t         inPartialBlock[32U];
     uint8_t         outPartialBlock[32U];
-
-    if (NULL != handle)
+    DTHE_AES_Context    localContext;
+    DTHE_AES_Context    *ptrContext = NULL;
+    uint32_t            gcmJ0[DTHE_AES_BLOCK_SIZE_WORDS];
+    uint8_t             isOutputRequired;
+    uint32_t            inLenBytes;
+    uint32_t            carryBytes;
+    uint32_t            alignedTail[DTHE_AES_BLOCK_SIZE_WORDS];
+    const uint8_t       *ptrByteInput;
+    uint32_t            heldBlock[DTHE_AES_BLOCK_SIZE_WORDS];
+    uint32_t            isLastBlockHeld = 0U;
+    uint32_t            isCarryKept = 0U;
+
+    if ((NULL != handle) && (NULL != ptrParams))
     {
         status  = DTHE_AES_RETURN_SUCCESS;
     }
@@ -354,22 +537,36 @@ DTHE_AES_Return_t DTHE_AES_execute(DTHE_Handle handle, const DTHE_AES_Params* pt
         attrs           = config->attrs;
         ptrAesRegs      = (CSL_AesRegs *)attrs->aesBaseAddr;
 
+        /* Select the context which holds the state of this operation */
+        if (ptrParams->ptrContext != NULL)
+        {
+            ptrContext = ptrParams->ptrContext;
+        }
+        else if (ptrParams->streamState == DTHE_AES_ONE_SHOT_SUPPORT)
+        {
+            DTHE_AES_Context_init(&localContext);
+            ptrContext = &localContext;
+        }
+        else
+        {
+            ptrContext = &gDtheAesDefaultContext;
+        }
+
         /* This flow is for One-Shot mode and Stream Mode as INIT only */
         if(((ptrParams->streamState == DTHE_AES_ONE_SHOT_SUPPORT)||(ptrParams->streamState == DTHE_AES_STREAM_INIT))&&\
-            (gStreamState == AES_STATE_NEW))
+            (ptrContext->state == AES_STATE_NEW))
         {
-            DTHE_AES_controlMode(ptrAesRegs, ptrParams->algoType);
-
-            /* Key Size setting */
-            DTHE_AES_setKeySize(ptrAesRegs, ptrParams->keyLen);
-
             if((ptrParams->streamState == DTHE_AES_ONE_SHOT_SUPPORT)&&(ptrParams->dataLenBytes == 0))
             {
-                status = DTHE_AES_RETURN_FAILURE;
+                /* GCM (GMAC) and CCM without payload are valid as long as there is AAD */
+                if(DTHE_AES_hasSeparateAAD(ptrParams) == 0U)
+                {
+                    status = DTHE_AES_RETURN_FAILURE;
+                }
             }
 
             /* Sanity Check: For Decryption data length always needs to be aligned */
-            if (ptrParams->opType == DTHE_AES_DECRYPT)
+            if ((ptrParams->opType == DTHE_AES_DECRYPT)&&(ptrParams->algoType != DTHE_AES_GCM_MODE))
             {
                 if ((ptrParams->dataLenBytes % 4U) != 0U)
                 {
@@ -380,21 +577,10 @@ DTHE_AES_Return_t DTHE_AES_execute(DTHE_Handle handle, const DTHE_AES_Params* pt
             /* Sanity Check: Key Validation */
             if (status == DTHE_AES_RETURN_SUCCESS)
             {
-                /* KEK Mode or Normal Key Mode: */
-                if (ptrParams->useKEKMode == TRUE)
-                {
-                    /* If KEKMode is set, configure Muxes for KEK
-                    * to be passed to AES Engine */
-                    /* KEK Mode: Enable Direct Bus */
-                    CSL_REG32_FINS(&ptrAesRegs->SYSCONFIG,AES_S_SYSCONFIG_DIRECTBUSEN,1U);
-                }
-                else
+                /* Normal Mode: Key should always be specified */
+                if ((ptrParams->useKEKMode != TRUE) && (ptrParams->ptrKey == NULL))
                 {
-                    /* Normal Mode: Key should always be specified */
-                    if (ptrParams->ptrKey == NULL)
-                    {
-                        status = DTHE_AES_RETURN_FAILURE;
-                    }
+                    status = DTHE_AES_RETURN_FAILURE;
                 }
 
                 if((ptrParams->algoType == DTHE_AES_CBC_MODE)\
@@ -409,93 +595,84 @@ DTHE_AES_Return_t DTHE_AES_execute(DTHE_Handle handle, const DTHE_AES_Params* pt
                     }
                 }
 
-                /* Select the key input: */
-                if (ptrParams->useKEKMode == FALSE)
+                if(ptrParams->algoType == DTHE_AES_XTS_MODE)
                 {
-                    /* Normal Key Mode: */
-                    CSL_REG32_FINS(&ptrAesRegs->SYSCONFIG,AES_S_SYSCONFIG_DIRECTBUSEN,0U);
-
-                    /* Normal Mode: Key should always be specified */
-                    if (ptrParams->ptrKey != NULL)
+                    /* XTS needs the tweak key and the tweak i; ciphertext stealing is not supported */
+                    if ((ptrParams->ptrIV == NULL)||(ptrParams->ptrKey2 == NULL)||(ptrParams->useKEKMode == TRUE))
                     {
-                        /* Configure the key which is to be used: */
-                        DTHE_AES_set256BitKey1 (ptrAesRegs, ptrParams->ptrKey);
+                        status = DTHE_AES_RETURN_FAILURE;
                     }
-
-                    if (ptrParams->algoType == DTHE_AES_CMAC_MODE)
+                    if ((ptrParams->dataLenBytes == 0U)||((ptrParams->dataLenBytes % 16U) != 0U))
                     {
-                        DTHE_AES_set128BitKey2Part1(ptrAesRegs, ptrParams->ptrKey1);
-                        DTHE_AES_set128BitKey2Part2(ptrAesRegs, ptrParams->ptrKey2);
+                        status = DTHE_AES_RETURN_FAILURE;
                     }
                 }
 
-                DTHE_AES_setOpType(ptrAesRegs, ptrParams->opType);
-
-                if((ptrParams->algoType == DTHE_AES_CTR_MODE)\
-                    ||(ptrParams->algoType == DTHE_AES_ICM_MODE))
-                {
-                    DTHE_AES_CTRWidth(ptrAesRegs, ptrParams->counterWidth);
-                }
-
-                /* Configure the Initialization Vector */
-                if((ptrParams->algoType == DTHE_AES_CBC_MODE)\
-                    ||(ptrParams->algoType == DTHE_AES_CTR_MODE)\
-                    ||(ptrParams->algoType == DTHE_AES_ICM_MODE)\
-                    ||(ptrParams->algoType == DTHE_AES_CFB_MODE))
+                if(ptrParams->algoType == DTHE_AES_GCM_MODE)
                 {
-                    if (ptrParams->ptrIV != NULL)
+                    if ((ptrParams->ptrIV == NULL)||(ptrParams->ivLenBytes == 0U))
+                    {
+                        status = DTHE_AES_RETURN_FAILURE;
+                    }
+                    if ((ptrParams->aadLenght != 0U)&&(ptrParams->ptrAAD == NULL))
                     {
-                        DTHE_AES_setIV(ptrAesRegs, ptrParams->ptrIV);
+                        status = DTHE_AES_RETURN_FAILURE;
+                    }
+                    if ((ptrParams->dataLenBytes == 0U)&&(ptrParams->aadLenght == 0U))
+                    {
+                        status = DTHE_AES_RETURN_FAILURE;
                     }
                 }
-                else if((ptrParams->algoType == DTHE_AES_CBC_MAC_MODE)||(ptrParams->algoType == DTHE_AES_CMAC_MODE))
+            }
+
+            /* Hand the engine over from the context which is currently loaded */
+            if (status == DTHE_AES_RETURN_SUCCESS)
+            {
+                status = DTHE_AES_switchOutContext(ptrAesRegs, attrs, ptrContext);
+            }
+
+            if (status == DTHE_AES_RETURN_SUCCESS)
+            {
+                DTHE_AES_captureContext(ptrContext, ptrParams);
+
+                if((ptrParams->algoType == DTHE_AES_CBC_MAC_MODE)||(ptrParams->algoType == DTHE_AES_CMAC_MODE))
                 {
-                    /* Clear the IV value */
-                    DTHE_AES_clearIV(ptrAesRegs);
-                    /* Enable Save Context in CTRL register*/
-                    CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_SAVE_CONTEXT, 1U);
+                    /* MAC modes always start with a cleared IV */
+                    DTHE_AES_programContext(ptrAesRegs, ptrContext, NULL);
                 }
-                if (ptrParams->algoType == DTHE_AES_CCM_MODE)
+                else if(ptrParams->algoType == DTHE_AES_GCM_MODE)
                 {
-                    /* Clear the IV value */
-                    DTHE_AES_clearIV(ptrAesRegs);
-                    if (ptrParams->ptrIV != NULL)
-                    {
-                    DTHE_AES_setIV(ptrAesRegs, ptrParams->ptrIV);
-                  }
-                    /* Enable Save Context in CTRL register*/
-                    CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_SAVE_CONTEXT, 1U);
-                    /* Nonce Length */
-                    DTHE_AES_setCCM_L(ptrAesRegs, ptrParams->ccmL);
-                    /* Tag Length */
-                    DTHE_AES_setCCM_M(ptrAesRegs, ptrParams->ccmM);
-                    DTHE_AES_CTRWidth(ptrAesRegs, DTHE_AES_CTR_WIDTH_32);
-                    /* Setup the AAD data length: */
-                    DTHE_AES_setAADLengthBytes(ptrAesRegs, ptrParams->aadLenght);
+                    /* GCM starts the counter from the pre-counter block J0 */
+                    DTHE_AES_computeGcmJ0(ptrAesRegs, ptrContext, ptrParams->ptrIV, ptrParams->ivLenBytes, &gcmJ0[0U]);
+                    DTHE_AES_programContext(ptrAesRegs, ptrContext, &gcmJ0[0U]);
+                    (void)memset((void *)&gcmJ0[0U], 0, sizeof(gcmJ0));
                 }
-                /*
-                - DataLength is sent by user, then set the same here.
-                - DataLength is not sent by user, then set the length as maximum. */
-                if((ptrParams->streamState != DTHE_AES_ONE_SHOT_SUPPORT)&&(ptrParams->dataLenBytes == 0))
+                else
                 {
-                    /* Setup the data length: */
-                    DTHE_AES_setDataLengthBytes(ptrAesRegs, MAX_VALUE);
+                    DTHE_AES_programContext(ptrAesRegs, ptrContext, ptrParams->ptrIV);
                 }
-                else
+
+                ptrContext->state   = AES_STATE_IN_PROGRESS;
+                attrs->aesActiveCtx = (void *)ptrContext;
+
+                /* The AAD is hashed ahead of the payload. One-shot feeds it together with the payload below. */
+                if((DTHE_AES_hasSeparateAAD(ptrParams) == 1U)&&(ptrParams->streamState == DTHE_AES_STREAM_INIT))
                 {
-                    /* Setup the data length: */
-                    DTHE_AES_setDataLengthBytes(ptrAesRegs, ptrParams->dataLenBytes);
+                    DTHE_AES_processAAD(config, ptrAesRegs, ptrParams->ptrAAD, ptrParams->aadLenght);
                 }
-                gStreamState = AES_STATE_IN_PROGRESS;
             }
         }
-        /* Stream Mode Update should support streamSize aligned to 16B only */
-        else if((gStreamState == AES_STATE_IN_PROGRESS)&&\
+        /* Stream Mode Update accepts any streamSize: bytes short of a block are carried in the context */
+        else if((ptrContext->state == AES_STATE_IN_PROGRESS)&&\
                 ((ptrParams->streamState == DTHE_AES_STREAM_UPDATE)||(ptrParams->streamState == DTHE_AES_STREAM_FINISH)))
         {
-            if ((ptrParams->streamState == DTHE_AES_STREAM_UPDATE)&&((ptrParams->streamSize % 16U) != 0U))
+            /* The chunk is copied into the carry first: check its buffers before it is read */
+            status = DTHE_AES_checkStreamBuffers(ptrParams, ptrContext);
+
+            if (status == DTHE_AES_RETURN_SUCCESS)
             {
-                status = DTHE_AES_RETURN_FAILURE;
+                /* Load this context back into the engine if another context used it in between */
+                status = DTHE_AES_resumeContext(ptrAesRegs, attrs, ptrContext);
             }
         }
         else
@@ -504,16 +681,17 @@ DTHE_AES_Return_t DTHE_AES_execute(DTHE_Handle handle, const DTHE_AES_Params* pt
         }
 
         /* Execute the AES Driver: */
-        if ((status == DTHE_AES_RETURN_SUCCESS)&&(gStreamState == AES_STATE_IN_PROGRESS))
+        if ((status == DTHE_AES_RETURN_SUCCESS)&&(ptrContext->state == AES_STATE_IN_PROGRESS))
         {
             /* This flow is for one-shot in continuation to the above flow
                In case of Update and Finish start execution from here */
             if((ptrParams->streamState == DTHE_AES_ONE_SHOT_SUPPORT)||(ptrParams->streamState == DTHE_AES_STREAM_UPDATE)||(ptrParams->streamState == DTHE_AES_STREAM_FINISH))
             {
-                if((ptrParams->streamState == DTHE_AES_STREAM_FINISH)&&(ptrParams->dataLenBytes == 0U))
+                if((ptrParams->streamState == DTHE_AES_STREAM_FINISH)&&(ptrParams->dataLenBytes == 0U)&&\
+                   (ptrParams->algoType != DTHE_AES_GCM_MODE))
                 {
                     /* Setup the data length: */
-                    DTHE_AES_setDataLengthBytes(ptrAesRegs,  ptrParams->streamSize);
+                    DTHE_AES_setDataLengthBytes(ptrAesRegs,  ptrContext->carryLenBytes + ptrParams->streamSize);
                 }
 
                 /* Setup the input & output: */
@@ -532,93 +710,141 @@ DTHE_AES_Return_t DTHE_AES_execute(DTHE_Handle handle, const DTHE_AES_Params* pt
 
                 if(ptrParams->streamState == DTHE_AES_ONE_SHOT_SUPPORT)
                 {
-                    /* Determine the data length in words: */
-                    dataLenWords = ptrParams->dataLenBytes / 4U;
-                    /* Compute the number of bytes which need to be handled seperately */
-                    partialDataSize = ptrParams->dataLenBytes % 16U;
+                    inLenBytes = ptrParams->dataLenBytes;
                 }
                 else
                 {
-                    /* Determine the data length in words: */
-                    dataLenWords = ptrParams->streamSize / 4U;
-                    /* Compute the number of bytes which need to be handled seperately */
-                    partialDataSize = ptrParams->streamSize % 16U;
+                    inLenBytes = ptrParams->streamSize;
                 }
 
-                /* Compute the number of full blocks which can be written: Each block is 4words long*/
-                numBlocks = (dataLenWords / 4U);
+                isOutputRequired = DTHE_AES_isOutputRequired(ptrParams);
 
-                if ( (config->dmaEnable == DMA_ENABLE) && (numBlocks > 0U) )
+                /* CMAC derives the last block with K1 at finish: an update of a MAC mode which ends on a
+                 * block boundary keeps its last full block in the carry, like the SHA streaming does */
+                if ((ptrParams->streamState == DTHE_AES_STREAM_UPDATE) &&
+                    ((ptrParams->algoType == DTHE_AES_CMAC_MODE) || (ptrParams->algoType == DTHE_AES_CBC_MAC_MODE)) &&
+                    ((ptrContext->carryLenBytes + inLenBytes) != 0U) && (((ptrContext->carryLenBytes + inLenBytes) % 16U) == 0U))
                 {
-
-                    dmaHandle = DMA_open(0);
-
-
-                    DMA_Config_TxChannel(dmaHandle, ptrWordInputBuffer, (uint32_t *)&ptrAesRegs->DATA_IN_3, numBlocks, 0U, DMA_AES_ENABLE);
-
-                    if((ptrParams->algoType != DTHE_AES_CBC_MAC_MODE)&&(ptrParams->algoType != DTHE_AES_CMAC_MODE)&&(ptrParams->aadLenght == 0U))
+                    if (inLenBytes >= 16U)
                     {
-                        DMA_Config_RxChannel(dmaHandle, (uint32_t *)&ptrAesRegs->DATA_IN_3, ptrWordOutputBuffer, numBlocks);
+                        /* The last block is all in this chunk */
+                        (void)memcpy ((void *)&heldBlock[0U],
+                                      (const void *)&((const uint8_t *)ptrWordInputBuffer)[inLenBytes - 16U], 16U);
+                        inLenBytes = inLenBytes - 16U;
+                        isLastBlockHeld = 1U;
                     }
-
-                    DTHE_AES_clearAllInterrupts(ptrAesRegs);
-
-                    if((ptrParams->algoType != DTHE_AES_CBC_MAC_MODE)&&(ptrParams->algoType != DTHE_AES_CMAC_MODE)&&(ptrParams->aadLenght == 0U))
+                    else
                     {
-                        DTHE_AES_setDMAOutputRequestStatus(ptrAesRegs, 1);
-                        DMA_enableRxTransferRegion(dmaHandle);
+                        /* The last block is the carry completed by this chunk */
+                        isCarryKept = 1U;
                     }
+                }
 
-                    DMA_enableTxTransferRegion(dmaHandle);
-                    DTHE_AES_setDMAInputRequestStatus(ptrAesRegs, 1);
-
-                    if((ptrParams->algoType != DTHE_AES_CBC_MAC_MODE)&&(ptrParams->algoType != DTHE_AES_CMAC_MODE)&&(ptrParams->aadLenght == 0U))
+                if(ptrContext->carryLenBytes != 0U)
+                {
+                    /* Complete the carried block from the head of this chunk */
+                    carryBytes = 16U - ptrContext->carryLenBytes;
+                    if (carryBytes > inLenBytes)
                     {
-                        DMA_WaitForRxTransfer(dmaHandle);
+                        carryBytes = inLenBytes;
                     }
-
-                    DMA_WaitForTxTransfer(dmaHandle);
-
-                    DTHE_AES_setDMAInputRequestStatus(ptrAesRegs, 0);
-                    if((ptrParams->algoType != DTHE_AES_CBC_MAC_MODE)&&(ptrParams->algoType != DTHE_AES_CMAC_MODE)&&(ptrParams->aadLenght == 0U))
+                    if (carryBytes != 0U)
                     {
-                        DTHE_AES_setDMAOutputRequestStatus(ptrAesRegs, 0);
+                        (void)memcpy ((void *)&((uint8_t *)&ptrContext->carry[0U])[ptrContext->carryLenBytes],
+                                      (const void *)ptrWordInputBuffer, carryBytes);
                     }
+                    ptrContext->carryLenBytes = ptrContext->carryLenBytes + carryBytes;
+                    inLenBytes = inLenBytes - carryBytes;
 
-                    DMA_disableTxCh(dmaHandle);
+                    if ((ptrContext->carryLenBytes == 16U) && (isCarryKept == 0U))
+                    {
+                        DTHE_AES_pollInputReady(ptrAesRegs);
+                        DTHE_AES_writeDataBlock(ptrAesRegs, &ptrContext->carry[0U]);
+                        if (isOutputRequired == 1U)
+                        {
+                            DTHE_AES_pollOutputReady(ptrAesRegs);
+                            DTHE_AES_readDataBlock(ptrAesRegs, ptrWordOutputBuffer);
+                            ptrWordOutputBuffer = &ptrWordOutputBuffer[4U];
+                        }
+                        numBytes = numBytes + 16U;
+                        ptrContext->carryLenBytes = 0U;
+
+                        if ((carryBytes % 4U) == 0U)
+                        {
+                            ptrWordInputBuffer = &ptrWordInputBuffer[carryBytes / 4U];
+                        }
+                        else
+                        {
+                            /* The rest of the chunk is not word aligned: its full blocks go through an
+                             * aligned bounce block and the bytes short of a block into an aligned tail */
+                            ptrByteInput = &((const uint8_t *)ptrWordInputBuffer)[carryBytes];
+                            DTHE_AES_processUnalignedBlocks(ptrAesRegs, isOutputRequired, ptrByteInput,
+                                                            ptrWordOutputBuffer, inLenBytes / 16U);
+                            if (isOutputRequired == 1U)
+                            {
+                                ptrWordOutputBuffer = &ptrWordOutputBuffer[(inLenBytes / 16U) * 4U];
+                            }
+                            numBytes = numBytes + ((inLenBytes / 16U) * 16U);
 
-                    if((ptrParams->algoType != DTHE_AES_CBC_MAC_MODE)&&(ptrParams->algoType != DTHE_AES_CMAC_MODE)&&(ptrParams->aadLenght == 0U))
+                            (void)memset ((void *)&alignedTail[0U], 0, sizeof(alignedTail));
+                            (void)memcpy ((void *)&alignedTail[0U], (const void *)&ptrByteInput[(inLenBytes / 16U) * 16U],
+                                          inLenBytes % 16U);
+                            ptrWordInputBuffer = &alignedTail[0U];
+                            inLenBytes = inLenBytes % 16U;
+                        }
+                    }
+                    else
                     {
-                        DMA_disableRxCh(dmaHandle);
+                        /* The whole chunk went into the carry: at finish the carry is the partial last block */
+                        ptrWordInputBuffer = &ptrContext->carry[0U];
+                        inLenBytes = ptrContext->carryLenBytes;
+                        if (ptrParams->streamState == DTHE_AES_STREAM_FINISH)
+                        {
+                            ptrContext->carryLenBytes = 0U;
+                        }
+                        else
+                        {
+                            inLenBytes = 0U;
+                        }
                     }
+                }
+
+                /* Determine the data length in words: */
+                dataLenWords = inLenBytes / 4U;
+                /* Compute the number of bytes which need to be handled seperately */
+                partialDataSize = inLenBytes % 16U;
+
+                /* Compute the number of full blocks which can be written: Each block is 4words long*/
+                numBlocks = (dataLenWords / 4U);
 
-                    /* Compute the number of bytes which have been processed: */
-                    numBytes = numBytes + (numBlocks * 4 * sizeof(uint32_t));
-                    index = numBlocks;
+                if((DTHE_AES_hasSeparateAAD(ptrParams) == 1U)&&(ptrParams->streamState == DTHE_AES_ONE_SHOT_SUPPORT))
+                {
+                    /* AAD and all the full payload blocks go through the engine in one transfer: */
+                    DTHE_AES_processAADAndBlocks(config, ptrAesRegs, ptrParams->ptrAAD, ptrParams->aadLenght,
+                                                 isOutputRequired, ptrWordInputBuffer, ptrWordOutputBuffer, numBlocks);
                 }
                 else
                 {
-                    /* Cycle through and write all the full blocks: */
-                    for (index = 0U; index < numBlocks; index++)
-                    {
-                        /* Wait for the AES IP to be ready to receive the data: */
-                        DTHE_AES_pollInputReady(ptrAesRegs);
-
-                        /* Write the data: */
-                        DTHE_AES_writeDataBlock(ptrAesRegs, &ptrWordInputBuffer[index << 2U]);
+                    /* Move all the full blocks through the engine: */
+                    DTHE_AES_processBlocks(config, ptrAesRegs, isOutputRequired, ptrWordInputBuffer, ptrWordOutputBuffer, numBlocks);
+                }
 
-                        if((ptrParams->algoType != DTHE_AES_CBC_MAC_MODE)&&(ptrParams->algoType != DTHE_AES_CMAC_MODE)&&(ptrParams->aadLenght == 0U))
-                        {
-                            /* Wait for the AES IP to be ready with the output data */
-                            DTHE_AES_pollOutputReady(ptrAesRegs);
+                /* Compute the number of bytes which have been processed: */
+                numBytes = numBytes + (numBlocks * 4U * sizeof(uint32_t));
+                index = numBlocks;
 
-                            /* Read the decrypted data into the decrypted block: */
-                            DTHE_AES_readDataBlock(ptrAesRegs, &ptrWordOutputBuffer[index << 2U]);
-                        }
+                if((ptrParams->streamState == DTHE_AES_STREAM_UPDATE)&&(partialDataSize != 0U))
+                {
+                    /* Keep the bytes short of a block for the next call */
+                    (void)memcpy ((void *)&ptrContext->carry[0U], (const void *)&ptrWordInputBuffer[index << 2U], partialDataSize);
+                    ptrContext->carryLenBytes = partialDataSize;
+                }
 
-                        /* Compute the number of bytes which have been processed: */
-                        numBytes = numBytes + (4U * sizeof(uint32_t));
-                    }
+                if (isLastBlockHeld == 1U)
+                {
+                    /* The held block is written at the next update or at finish */
+                    (void)memcpy ((void *)&ptrContext->carry[0U], (const void *)&heldBlock[0U], 16U);
+                    ptrContext->carryLenBytes = 16U;
                 }
 
                 /* - This flow is for one-shot in continuation to the above flow
@@ -683,8 +909,18 @@ DTHE_AES_Return_t DTHE_AES_execute(DTHE_Handle handle, const DTHE_AES_Params* pt
                         DTHE_AES_pollContextReady(ptrAesRegs);
                         DTHE_AES_readTag(ptrAesRegs, &ptrParams->ptrTag[0]);
                     }
+                    else if(ptrParams->algoType == DTHE_AES_GCM_MODE)
+                    {
+                        status = DTHE_AES_finishGcmTag(ptrAesRegs, ptrParams);
+                    }
+                    else
+                    {
+                        /* No tag for the other modes */
+                    }
                 }
 
+                ptrContext->processedBytes = ptrContext->processedBytes + numBytes;
+
                 if(ptrParams->streamState == DTHE_AES_ONE_SHOT_SUPPORT)
                 {
                     if(numBytes != ptrParams->dataLenBytes)
@@ -692,11 +928,13 @@ DTHE_AES_Return_t DTHE_AES_execute(DTHE_Handle handle, const DTHE_AES_Params* pt
                         status = DTHE_AES_RETURN_FAILURE;
                     }
 
-                    gStreamState = AES_STATE_NEW;
+                    ptrContext->state   = AES_STATE_NEW;
+                    attrs->aesActiveCtx = NULL;
                 }
                 else if(ptrParams->streamState == DTHE_AES_STREAM_FINISH)
                 {
-                    gStreamState = AES_STATE_NEW;
+                    ptrContext->state   = AES_STATE_NEW;
+                    attrs->aesActiveCtx = NULL;
                 }
             }
         }
@@ -704,324 +942,2310 @@ DTHE_AES_Return_t DTHE_AES_execute(DTHE_Handle handle, const DTHE_AES_Params* pt
     return (status);
 }
 
-DTHE_AES_Return_t DTHE_AES_close(DTHE_Handle handle)
+DTHE_AES_Return_t DTHE_AES_executeSG(DTHE_Handle handle, const DTHE_AES_Params* ptrParams,
+                                     const DTHE_Segment* ptrInSegments, uint32_t numInSegments,
+                                     const DTHE_Segment* ptrOutSegments, uint32_t numOutSegments)
 {
-    DTHE_AES_Return_t  status  = DTHE_AES_RETURN_FAILURE;
-    DTHE_Config        *config = NULL;
-    DTHE_Attrs         *attrs  = NULL;
-    CSL_AesRegs        *ptrAesRegs;
-
-    if(NULL != handle)
+    DTHE_AES_Return_t   status  = DTHE_AES_RETURN_FAILURE;
+    DTHE_Config         *config = NULL;
+    CSL_AesRegs         *ptrAesRegs = NULL;
+    DTHE_AES_Params     sgParams;
+    DTHE_AES_Context    localContext;
+    DTHE_AES_Context    *ptrContext = NULL;
+    uint32_t            totalLen = 0U;
+    uint32_t            numBlocks = 0U;
+    uint32_t            tailLen;
+    uint32_t            tailIn[DTHE_AES_BLOCK_SIZE_WORDS];
+    uint32_t            tailOut[DTHE_AES_BLOCK_SIZE_WORDS];
+    uint8_t             isOutputRequired = 0U;
+
+    if ((NULL != handle) && (NULL != ptrParams))
     {
-        status  = DTHE_AES_RETURN_SUCCESS;
+        status  = DTHE_AES_reapJob();
     }
-    if(status  == DTHE_AES_RETURN_SUCCESS)
+
+    if (status == DTHE_AES_RETURN_SUCCESS)
     {
-        config          = (DTHE_Config *) handle;
-        attrs           = config->attrs;
-        ptrAesRegs      = (CSL_AesRegs *)attrs->aesBaseAddr;
+        config           = (DTHE_Config *) handle;
+        ptrAesRegs       = (CSL_AesRegs *)config->attrs->aesBaseAddr;
+        isOutputRequired = DTHE_AES_isOutputRequired(ptrParams);
 
-        DTHE_AES_resetModule(ptrAesRegs);
+        if (ptrParams->streamState != DTHE_AES_STREAM_INIT)
+        {
+            if ((ptrInSegments == NULL) && (numInSegments != 0U))
+            {
+                status = DTHE_AES_RETURN_FAILURE;
+            }
+            else
+            {
+                totalLen  = DTHE_getSegmentsLength(ptrInSegments, numInSegments);
+                numBlocks = totalLen / 16U;
+            }
 
+            /* The output list must be able to take the whole output */
+            if ((status == DTHE_AES_RETURN_SUCCESS) && (isOutputRequired == 1U))
+            {
+                if ((ptrOutSegments == NULL) ||
+                    (DTHE_getSegmentsLength(ptrOutSegments, numOutSegments) < totalLen))
+                {
+                    status = DTHE_AES_RETURN_FAILURE;
+                }
+            }
+        }
     }
-    return (status);
-}
 
-/* ========================================================================== */
-/*                 Internal Function Definations                              */
-/* ========================================================================== */
-/**
- * \brief                   The function is used to set the DMA context (input and output) status of the AES module.
- *
- * \param   ptrAesRegs      Pointer to the EIP38T AES Registers
- *
- * \param   dmaStatus       Flag which is used to enable(1)/disable(0) the DMA status.
- *
- */
-static void DTHE_AES_setDMAContextStatus(CSL_AesRegs *ptrAesRegs, uint8_t dmaStatus)
-{
-    if (dmaStatus == 1U)
+    if (status == DTHE_AES_RETURN_SUCCESS)
     {
-        CSL_REG32_FINS(&ptrAesRegs->SYSCONFIG, AES_S_SYSCONFIG_DMA_REQ_CONTEXT_OUT_EN, 1U);
-        CSL_REG32_FINS(&ptrAesRegs->SYSCONFIG, AES_S_SYSCONFIG_DMA_REQ_CONTEXT_IN_EN, 1U);
+        if (ptrParams->streamState == DTHE_AES_STREAM_INIT)
+        {
+            /* Nothing to transfer: the stream is only set up */
+            status = DTHE_AES_process(handle, ptrParams);
+        }
+        else
+        {
+            DTHE_AES_Context_init(&localContext);
+            status = DTHE_AES_startStream(handle, ptrParams, totalLen, &localContext, &sgParams, &ptrContext);
+        }
     }
-    else
+
+    /* Stream all the full blocks through the engine */
+    if ((status == DTHE_AES_RETURN_SUCCESS) && (ptrContext != NULL) && (numBlocks > 0U))
     {
-        CSL_REG32_FINS(&ptrAesRegs->SYSCONFIG, AES_S_SYSCONFIG_DMA_REQ_CONTEXT_OUT_EN, 0U);
-        CSL_REG32_FINS(&ptrAesRegs->SYSCONFIG, AES_S_SYSCONFIG_DMA_REQ_CONTEXT_IN_EN, 0U);
+        DTHE_AES_processBlocksSG(config, ptrAesRegs, isOutputRequired, ptrInSegments, numInSegments,
+                                 ptrOutSegments, numOutSegments, numBlocks);
+        ptrContext->processedBytes = ptrContext->processedBytes + (numBlocks * 16U);
     }
 
-    return;
-}
-
-/**
- * \brief                   The function is used to set the DMA Output request status
- *
- * \param   ptrAesRegs      Pointer to the EIP38T AES Registers
- *
- * \param   dmaStatus       Flag which is used to enable(1)/disable(0) the DMA status.
- *
- */
-static void DTHE_AES_setDMAOutputRequestStatus(CSL_AesRegs *ptrAesRegs, uint8_t dmaStatus)
-{
-    if (dmaStatus == 1U)
+    /* The partial last block and the tag are handled by the regular finish path */
+    if ((status == DTHE_AES_RETURN_SUCCESS) && (ptrContext != NULL) &&
+        (ptrParams->streamState != DTHE_AES_STREAM_UPDATE))
     {
-        CSL_REG32_FINS(&ptrAesRegs->SYSCONFIG,AES_S_SYSCONFIG_DMA_REQ_DATA_OUT_EN, 1U);
+        tailLen = totalLen - (numBlocks * 16U);
+        (void)memset((void *)&tailIn[0U], 0, sizeof(tailIn));
+        (void)memset((void *)&tailOut[0U], 0, sizeof(tailOut));
+        DTHE_gatherSegments(ptrInSegments, numInSegments, numBlocks * 16U, (uint8_t *)&tailIn[0U], tailLen);
+
+        status = DTHE_AES_finishStream(handle, &sgParams, &tailIn[0U], &tailOut[0U], tailLen);
+
+        if ((status == DTHE_AES_RETURN_SUCCESS) && (isOutputRequired == 1U))
+        {
+            DTHE_scatterSegments(ptrOutSegments, numOutSegments, numBlocks * 16U, (const uint8_t *)&tailOut[0U], tailLen);
+        }
     }
-    else
+
+    if ((status != DTHE_AES_RETURN_SUCCESS) && (ptrContext != NULL))
     {
-        CSL_REG32_FINS(&ptrAesRegs->SYSCONFIG,AES_S_SYSCONFIG_DMA_REQ_DATA_OUT_EN, 0U);
+        DTHE_AES_abortOneShot(config->attrs, ptrParams->streamState, ptrContext);
     }
 
-    return;
+    return (status);
 }
 
-/**
- * \brief                   The function is used to set the DMA Input request status
- *
- * \param   ptrAesRegs      Pointer to the EIP38T AES Registers
- *
- * \param   dmaStatus       Flag which is used to enable(1)/disable(0) the DMA status.
- *
- */
-static void DTHE_AES_setDMAInputRequestStatus(CSL_AesRegs *ptrAesRegs, uint8_t dmaStatus)
+DTHE_AES_Return_t DTHE_AES_executeXtsSectors(DTHE_Handle handle, const DTHE_AES_Params* ptrParams,
+                                             uint64_t dataUnitNumber, uint32_t sectorSize)
 {
-    if (dmaStatus == 1U)
+    DTHE_AES_Return_t   status  = DTHE_AES_RETURN_FAILURE;
+    DTHE_Config         *config = NULL;
+    DTHE_Attrs          *attrs  = NULL;
+    CSL_AesRegs         *ptrAesRegs = NULL;
+    DTHE_AES_Context    localContext;
+    uint32_t            tweak[DTHE_AES_BLOCK_SIZE_WORDS];
+    uint32_t*           ptrWordInputBuffer;
+    uint32_t*           ptrWordOutputBuffer;
+    uint32_t            numSectors;
+    uint32_t            sectorWords;
+    uint32_t            sector;
+
+    if ((NULL != handle) && (NULL != ptrParams) && (ptrParams->algoType == DTHE_AES_XTS_MODE) &&
+        (ptrParams->useKEKMode != TRUE) && (ptrParams->ptrKey != NULL) && (ptrParams->ptrKey2 != NULL) &&
+        (ptrParams->ptrPlainTextData != NULL) && (ptrParams->ptrEncryptedData != NULL) &&
+        (sectorSize != 0U) && ((sectorSize % 16U) == 0U) && ((sectorSize / 16U) <= 0xFFFFU) &&
+        (ptrParams->dataLenBytes != 0U) && ((ptrParams->dataLenBytes % sectorSize) == 0U))
     {
-        CSL_REG32_FINS(&ptrAesRegs->SYSCONFIG,AES_S_SYSCONFIG_DMA_REQ_DATA_IN_EN, 1U);
+        /* The engine is not available while an asynchronous job runs */
+        status = DTHE_AES_reapJob();
     }
-    else
+
+    if (status == DTHE_AES_RETURN_SUCCESS)
     {
-        CSL_REG32_FINS(&ptrAesRegs->SYSCONFIG,AES_S_SYSCONFIG_DMA_REQ_DATA_IN_EN, 0U);
+        config      = (DTHE_Config *) handle;
+        attrs       = config->attrs;
+        ptrAesRegs  = (CSL_AesRegs *)attrs->aesBaseAddr;
+
+        DTHE_AES_Context_init(&localContext);
+        status = DTHE_AES_switchOutContext(ptrAesRegs, attrs, &localContext);
     }
 
+    if (status == DTHE_AES_RETURN_SUCCESS)
+    {
+        if (ptrParams->opType == DTHE_AES_ENCRYPT)
+        {
+            ptrWordInputBuffer  = &ptrParams->ptrPlainTextData[0];
+            ptrWordOutputBuffer = &ptrParams->ptrEncryptedData[0];
+        }
+        else
+        {
+            ptrWordInputBuffer  = &ptrParams->ptrEncryptedData[0];
+            ptrWordOutputBuffer = &ptrParams->ptrPlainTextData[0];
+        }
+
+        /* Every sector is one data unit of sectorSize bytes */
+        DTHE_AES_captureContext(&localContext, ptrParams);
+        localContext.dataLenBytes   = sectorSize;
+        localContext.state          = AES_STATE_IN_PROGRESS;
+        attrs->aesActiveCtx         = (void *)&localContext;
+
+        numSectors  = ptrParams->dataLenBytes / sectorSize;
+        sectorWords = sectorSize / 4U;
+
+        for (sector = 0U; sector < numSectors; sector++)
+        {
+            /* The tweak value i is the data unit number as a 128-bit little-endian value */
+            tweak[0U] = (uint32_t)dataUnitNumber;
+            tweak[1U] = (uint32_t)(dataUnitNumber >> 32U);
+            tweak[2U] = 0U;
+            tweak[3U] = 0U;
+
+            if (sector == 0U)
+            {
+                /* Mode and both keys are programmed once for all the sectors */
+                DTHE_AES_programContext(ptrAesRegs, &localContext, &tweak[0U]);
+            }
+            else
+            {
+                /* Next data unit: only the tweak and the length are loaded */
+                DTHE_AES_pollNewContextReady(ptrAesRegs);
+                DTHE_AES_loadXtsTweak(ptrAesRegs, &tweak[0U]);
+                DTHE_AES_setDataLengthBytes(ptrAesRegs, sectorSize);
+            }
+
+            DTHE_AES_processBlocks(config, ptrAesRegs, 1U, &ptrWordInputBuffer[sector * sectorWords],
+                                   &ptrWordOutputBuffer[sector * sectorWords], (uint16_t)(sectorSize / 16U));
+
+            dataUnitNumber++;
+        }
+
+        localContext.state  = AES_STATE_NEW;
+        attrs->aesActiveCtx = NULL;
+        (void)memset((void *)&tweak[0U], 0, sizeof(tweak));
+    }
+
+    return (status);
+}
+
+DTHE_AES_Return_t DTHE_AES_cmacBatch(DTHE_Handle handle, const DTHE_AES_Params* ptrParams,
+                                     DTHE_AES_CmacMessage* ptrMessages, uint32_t numMessages)
+{
+    return (DTHE_AES_cmacBatchProcess(handle, ptrParams, ptrMessages, numMessages, 0U));
+}
+
+DTHE_AES_Return_t DTHE_AES_cmacBatchVerify(DTHE_Handle handle, const DTHE_AES_Params* ptrParams,
+                                           DTHE_AES_CmacMessage* ptrMessages, uint32_t numMessages)
+{
+    return (DTHE_AES_cmacBatchProcess(handle, ptrParams, ptrMessages, numMessages, 1U));
+}
+
+/**
+ * \brief                   The function is used to compute or verify the CMAC of a batch of messages under
+ *                          one key. Mode, key and subkeys are programmed for the first message; for the
+ *                          next ones only the MAC state and the length are reloaded.
+ *
+ * \param   handle          #DTHE_Handle returned from #DTHE_open().
+ *
+ * \param   ptrParams       Pointer to the parameters holding the key and the subkeys.
+ *
+ * \param   ptrMessages     Pointer to the messages.
+ *
+ * \param   numMessages     Number of messages.
+ *
+ * \param   isVerify        1 to compare the tags with the ones of the messages, 0 to return them.
+ *
+ * \return                  #DTHE_AES_RETURN_SUCCESS if every message passed.
+ *                          #DTHE_AES_RETURN_FAILURE otherwise.
+ */
+static DTHE_AES_Return_t DTHE_AES_cmacBatchProcess(DTHE_Handle handle, const DTHE_AES_Params* ptrParams,
+                                                   DTHE_AES_CmacMessage* ptrMessages, uint32_t numMessages, uint8_t isVerify)
+{
+    DTHE_AES_Return_t   status  = DTHE_AES_RETURN_FAILURE;
+    DTHE_Config         *config = NULL;
+    DTHE_Attrs          *attrs  = NULL;
+    CSL_AesRegs         *ptrAesRegs = NULL;
+    DTHE_AES_Context    localContext;
+    DTHE_AES_CmacMessage *ptrMessage;
+    uint32_t            tag[DTHE_AES_BLOCK_SIZE_WORDS];
+    uint8_t             partialBlock[16U];
+    uint32_t            tagLenBytes;
+    uint32_t            partialDataSize;
+    uint32_t            numBlocks;
+    uint32_t            message;
+    uint32_t            index;
+
+    if ((NULL != handle) && (NULL != ptrParams) && (NULL != ptrMessages) && (numMessages != 0U) &&
+        (ptrParams->algoType == DTHE_AES_CMAC_MODE) && (ptrParams->ptrKey1 != NULL) && (ptrParams->ptrKey2 != NULL) &&
+        ((ptrParams->useKEKMode == TRUE) || (ptrParams->ptrKey != NULL)))
+    {
+        status = DTHE_AES_RETURN_SUCCESS;
+    }
+
+    /* Sanity Check: every message needs data and a tag buffer */
+    for (message = 0U; (status == DTHE_AES_RETURN_SUCCESS) && (message < numMessages); message++)
+    {
+        ptrMessage = &ptrMessages[message];
+        if ((ptrMessage->ptrData == NULL) || (ptrMessage->dataLenBytes == 0U) || (ptrMessage->ptrTag == NULL) ||
+            (ptrMessage->tagLenBytes > DTHE_AES_TAG_SIZE_BYTES) || ((ptrMessage->dataLenBytes / 16U) > 0xFFFFU))
+        {
+            status = DTHE_AES_RETURN_FAILURE;
+        }
+    }
+
+    if (status == DTHE_AES_RETURN_SUCCESS)
+    {
+        /* The engine is not available while an asynchronous job runs */
+        status = DTHE_AES_reapJob();
+    }
+
+    if (status == DTHE_AES_RETURN_SUCCESS)
+    {
+        config      = (DTHE_Config *) handle;
+        attrs       = config->attrs;
+        ptrAesRegs  = (CSL_AesRegs *)attrs->aesBaseAddr;
+
+        DTHE_AES_Context_init(&localContext);
+        status = DTHE_AES_switchOutContext(ptrAesRegs, attrs, &localContext);
+    }
+
+    if (status == DTHE_AES_RETURN_SUCCESS)
+    {
+        DTHE_AES_captureContext(&localContext, ptrParams);
+        localContext.dataLenBytes   = ptrMessages[0U].dataLenBytes;
+        localContext.state          = AES_STATE_IN_PROGRESS;
+        attrs->aesActiveCtx         = (void *)&localContext;
+
+        for (message = 0U; message < numMessages; message++)
+        {
+            ptrMessage      = &ptrMessages[message];
+            numBlocks       = ptrMessage->dataLenBytes / 16U;
+            partialDataSize = ptrMessage->dataLenBytes % 16U;
+
+            if (message == 0U)
+            {
+                /* Mode, key and subkeys are programmed once for the batch */
+                DTHE_AES_programContext(ptrAesRegs, &localContext, NULL);
+            }
+            else
+            {
+                /* Next message: restart the CBC-MAC chain */
+                DTHE_AES_pollNewContextReady(ptrAesRegs);
+                DTHE_AES_clearIV(ptrAesRegs);
+                DTHE_AES_setDataLengthBytes(ptrAesRegs, ptrMessage->dataLenBytes);
+            }
+
+            if ((config->dmaEnable == DMA_ENABLE) && (numBlocks >= DTHE_AES_CMAC_BATCH_DMA_MIN_BLOCKS))
+            {
+                DTHE_AES_processBlocks(config, ptrAesRegs, 0U, ptrMessage->ptrData, NULL, (uint16_t)numBlocks);
+            }
+            else
+            {
+                /* Short messages are cheaper to write than to set up a DMA transfer for */
+                for (index = 0U; index < numBlocks; index++)
+                {
+                    DTHE_AES_pollInputReady(ptrAesRegs);
+                    DTHE_AES_writeDataBlock(ptrAesRegs, &ptrMessage->ptrData[index << 2U]);
+                }
+            }
+
+            if (partialDataSize != 0U)
+            {
+                (void)memset ((void *)&partialBlock[0U], 0, sizeof(partialBlock));
+                (void)memcpy ((void *)&partialBlock[0U], (const void *)&ptrMessage->ptrData[numBlocks << 2U], partialDataSize);
+                partialBlock[partialDataSize] = 0x80U;
+
+                DTHE_AES_pollInputReady(ptrAesRegs);
+                DTHE_AES_writeDataBlock(ptrAesRegs, (uint32_t *)&partialBlock[0U]);
+            }
+
+            DTHE_AES_pollContextReady(ptrAesRegs);
+            DTHE_AES_readTag(ptrAesRegs, &tag[0U]);
+
+            tagLenBytes = ptrMessage->tagLenBytes;
+            if (tagLenBytes == 0U)
+            {
+                tagLenBytes = DTHE_AES_TAG_SIZE_BYTES;
+            }
+
+            if (isVerify == 1U)
+            {
+                ptrMessage->status = DTHE_AES_compareTags((const uint8_t *)&tag[0U], (const uint8_t *)ptrMessage->ptrTag, tagLenBytes);
+            }
+            else
+            {
+                (void)memcpy ((void *)ptrMessage->ptrTag, (const void *)&tag[0U], tagLenBytes);
+                ptrMessage->status = DTHE_AES_RETURN_SUCCESS;
+            }
+
+            if (ptrMessage->status != DTHE_AES_RETURN_SUCCESS)
+            {
+                status = DTHE_AES_RETURN_FAILURE;
+            }
+        }
+
+        localContext.state  = AES_STATE_NEW;
+        attrs->aesActiveCtx = NULL;
+        (void)memset ((void *)&tag[0U], 0, sizeof(tag));
+        (void)memset ((void *)&partialBlock[0U], 0, sizeof(partialBlock));
+    }
+
+    return (status);
+}
+
+DTHE_AES_Return_t DTHE_AES_submit(DTHE_Handle handle, const DTHE_AES_Params* ptrParams,
+                                  DTHE_AES_JobCallback callback, void *args, DTHE_JobToken *ptrToken)
+{
+    DTHE_AES_Return_t   status  = DTHE_AES_RETURN_FAILURE;
+    DTHE_Config         *config = NULL;
+    CSL_AesRegs         *ptrAesRegs = NULL;
+    DTHE_AES_Job        *ptrJob = &gDtheAesJob;
+    uint32_t            *ptrWordInputBuffer;
+    uint32_t            *ptrWordOutputBuffer;
+    uint32_t            totalLen = 0U;
+    DMA_Return_t        dmaStatus;
+
+    if ((NULL != handle) && (NULL != ptrParams) && (NULL != ptrToken))
+    {
+        status  = DTHE_AES_reapJob();
+    }
+
+    if (status == DTHE_AES_RETURN_SUCCESS)
+    {
+        config      = (DTHE_Config *) handle;
+        ptrAesRegs  = (CSL_AesRegs *)config->attrs->aesBaseAddr;
+
+        if (ptrParams->streamState == DTHE_AES_ONE_SHOT_SUPPORT)
+        {
+            totalLen = ptrParams->dataLenBytes;
+        }
+        else if ((ptrParams->streamState == DTHE_AES_STREAM_UPDATE) || (ptrParams->streamState == DTHE_AES_STREAM_FINISH))
+        {
+            totalLen = ptrParams->streamSize;
+        }
+        else
+        {
+            /* Stream setup has nothing to wait for: use DTHE_AES_execute */
+            status = DTHE_AES_RETURN_FAILURE;
+        }
+
+        /* Jobs are completed from the DMA interrupt, which moves a bounded number of blocks */
+        if ((config->dmaEnable != DMA_ENABLE) || ((totalLen / 16U) > DTHE_JOB_MAX_BLOCKS) ||
+            ((ptrParams->streamState == DTHE_AES_STREAM_UPDATE) && ((totalLen % 16U) != 0U)))
+        {
+            status = DTHE_AES_RETURN_FAILURE;
+        }
+    }
+
+    if (status == DTHE_AES_RETURN_SUCCESS)
+    {
+        /* Setup the input & output: */
+        if (ptrParams->opType == DTHE_AES_ENCRYPT)
+        {
+            ptrWordInputBuffer  = ptrParams->ptrPlainTextData;
+            ptrWordOutputBuffer = ptrParams->ptrEncryptedData;
+        }
+        else
+        {
+            ptrWordInputBuffer  = ptrParams->ptrEncryptedData;
+            ptrWordOutputBuffer = ptrParams->ptrPlainTextData;
+        }
+
+        /* Drop a completion which was never waited for */
+        (void)SemaphoreP_pend(&ptrJob->doneSem, SystemP_NO_WAIT);
+
+        ptrJob->handle           = handle;
+        ptrJob->streamState      = ptrParams->streamState;
+        ptrJob->isOutputRequired = DTHE_AES_isOutputRequired(ptrParams);
+        ptrJob->numBlocks        = totalLen / 16U;
+        ptrJob->tailLen          = totalLen % 16U;
+        ptrJob->ptrTailIn        = &ptrWordInputBuffer[ptrJob->numBlocks * DTHE_AES_BLOCK_SIZE_WORDS];
+        ptrJob->ptrTailOut       = &ptrWordOutputBuffer[ptrJob->numBlocks * DTHE_AES_BLOCK_SIZE_WORDS];
+        ptrJob->callback         = callback;
+        ptrJob->args             = args;
+        ptrJob->dmaHandle        = NULL;
+        ptrJob->status           = DTHE_AES_RETURN_FAILURE;
+
+        /* Token zero is never handed out */
+        ptrJob->token = ptrJob->token + 1U;
+        if (ptrJob->token == DTHE_JOB_TOKEN_INVALID)
+        {
+            ptrJob->token = 1U;
+        }
+        *ptrToken = ptrJob->token;
+
+        DTHE_AES_Context_init(&ptrJob->oneShotContext);
+        status = DTHE_AES_startStream(handle, ptrParams, totalLen, &ptrJob->oneShotContext,
+                                      &ptrJob->params, &ptrJob->ptrContext);
+    }
+
+    if ((status == DTHE_AES_RETURN_SUCCESS) && (ptrJob->numBlocks > 0U))
+    {
+        dmaStatus         = DMA_RETURN_FAILURE;
+        ptrJob->dmaHandle = DMA_open(0);
+
+        if (ptrJob->dmaHandle != NULL)
+        {
+            dmaStatus = DMA_Config_TxChannel(ptrJob->dmaHandle, ptrWordInputBuffer, (uint32_t *)&ptrAesRegs->DATA_IN_3,
+                                             (uint16_t)ptrJob->numBlocks, 0U, DMA_AES_ENABLE);
+        }
+
+        /* The job is complete once the last channel of the transfer is done */
+        if ((dmaStatus == DMA_RETURN_SUCCESS) && (ptrJob->isOutputRequired == 1U))
+        {
+            dmaStatus = DMA_Config_RxChannel(ptrJob->dmaHandle, (uint32_t *)&ptrAesRegs->DATA_IN_3, ptrWordOutputBuffer,
+                                             (uint16_t)ptrJob->numBlocks);
+            if (dmaStatus == DMA_RETURN_SUCCESS)
+            {
+                dmaStatus = DMA_registerRxCallback(ptrJob->dmaHandle, &DTHE_AES_jobDmaComplete, (void *)ptrJob);
+            }
+        }
+        else if (dmaStatus == DMA_RETURN_SUCCESS)
+        {
+            dmaStatus = DMA_registerTxCallback(ptrJob->dmaHandle, &DTHE_AES_jobDmaComplete, (void *)ptrJob, DMA_AES_ENABLE);
+        }
+        else
+        {
+            /* No DMA channel */
+        }
+
+        if (dmaStatus == DMA_RETURN_SUCCESS)
+        {
+            ptrJob->state = DTHE_AES_JOB_STATE_RUNNING;
+
+            DTHE_AES_clearAllInterrupts(ptrAesRegs);
+
+            if (ptrJob->isOutputRequired == 1U)
+            {
+                DTHE_AES_setDMAOutputRequestStatus(ptrAesRegs, 1);
+                DMA_enableRxTransferRegion(ptrJob->dmaHandle);
+            }
+
+            DMA_enableTxTransferRegion(ptrJob->dmaHandle, DMA_AES_ENABLE);
+            DTHE_AES_setDMAInputRequestStatus(ptrAesRegs, 1);
+        }
+        else
+        {
+            /* No DMA transfer or completion interrupt available: release the channels and give up */
+            ptrJob->state = DTHE_AES_JOB_STATE_DONE;
+            (void)DTHE_AES_reapJob();
+            DTHE_AES_abortOneShot(config->attrs, ptrParams->streamState, ptrJob->ptrContext);
+            status = DTHE_AES_RETURN_FAILURE;
+        }
+    }
+    else if (status == DTHE_AES_RETURN_SUCCESS)
+    {
+        /* Less than a block of data: complete the job right away */
+        ptrJob->state = DTHE_AES_JOB_STATE_DMA_DONE;
+        DTHE_AES_finishJob(ptrJob);
+
+        if (ptrJob->callback != NULL)
+        {
+            ptrJob->callback(ptrJob->handle, ptrJob->token, ptrJob->status, ptrJob->args);
+        }
+    }
+    else
+    {
+        /* Nothing was started */
+    }
+
+    return (status);
+}
+
+DTHE_AES_Return_t DTHE_AES_wait(DTHE_Handle handle, DTHE_JobToken token, uint32_t timeout)
+{
+    DTHE_AES_Return_t   status  = DTHE_AES_RETURN_FAILURE;
+    DTHE_AES_Job        *ptrJob = &gDtheAesJob;
+
+    if ((NULL != handle) && (token != DTHE_JOB_TOKEN_INVALID) && (token == ptrJob->token) &&
+        (ptrJob->state != DTHE_AES_JOB_STATE_IDLE))
+    {
+        status = DTHE_AES_RETURN_SUCCESS;
+    }
+
+    if ((status == DTHE_AES_RETURN_SUCCESS) && (ptrJob->state == DTHE_AES_JOB_STATE_RUNNING))
+    {
+        if (SemaphoreP_pend(&ptrJob->doneSem, timeout) != SystemP_SUCCESS)
+        {
+            /* Still running */
+            status = DTHE_AES_RETURN_TIMEOUT;
+        }
+    }
+
+    if (status == DTHE_AES_RETURN_SUCCESS)
+    {
+        /* Finishes the job if only its DMA is done */
+        (void)DTHE_AES_reapJob();
+        status = ptrJob->status;
+    }
+
+    return (status);
+}
+
+DTHE_AES_Return_t DTHE_AES_close(DTHE_Handle handle)
+{
+    DTHE_AES_Return_t  status  = DTHE_AES_RETURN_FAILURE;
+    DTHE_Config        *config = NULL;
+    DTHE_Attrs         *attrs  = NULL;
+    CSL_AesRegs        *ptrAesRegs;
+
+    if(NULL != handle)
+    {
+        status  = DTHE_AES_RETURN_SUCCESS;
+    }
+    if(status  == DTHE_AES_RETURN_SUCCESS)
+    {
+        config          = (DTHE_Config *) handle;
+        attrs           = config->attrs;
+        ptrAesRegs      = (CSL_AesRegs *)attrs->aesBaseAddr;
+
+        /* A running job still owns the engine */
+        status = DTHE_AES_reapJob();
+    }
+    if(status  == DTHE_AES_RETURN_SUCCESS)
+    {
+        DTHE_AES_resetModule(ptrAesRegs);
+        attrs->aesActiveCtx = NULL;
+
+        gDtheAesJob.state = DTHE_AES_JOB_STATE_IDLE;
+        SemaphoreP_destruct(&gDtheAesJob.doneSem);
+    }
+    return (status);
+}
+
+/* ========================================================================== */
+/*                 Internal Function Definations                              */
+/* ========================================================================== */
+/**
+ * \brief                   The function is used to set the DMA context (input and output) status of the AES module.
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers
+ *
+ * \param   dmaStatus       Flag which is used to enable(1)/disable(0) the DMA status.
+ *
+ */
+static void DTHE_AES_setDMAContextStatus(CSL_AesRegs *ptrAesRegs, uint8_t dmaStatus)
+{
+    if (dmaStatus == 1U)
+    {
+        CSL_REG32_FINS(&ptrAesRegs->SYSCONFIG, AES_S_SYSCONFIG_DMA_REQ_CONTEXT_OUT_EN, 1U);
+        CSL_REG32_FINS(&ptrAesRegs->SYSCONFIG, AES_S_SYSCONFIG_DMA_REQ_CONTEXT_IN_EN, 1U);
+    }
+    else
+    {
+        CSL_REG32_FINS(&ptrAesRegs->SYSCONFIG, AES_S_SYSCONFIG_DMA_REQ_CONTEXT_OUT_EN, 0U);
+        CSL_REG32_FINS(&ptrAesRegs->SYSCONFIG, AES_S_SYSCONFIG_DMA_REQ_CONTEXT_IN_EN, 0U);
+    }
+
+    return;
+}
+
+/**
+ * \brief                   The function is used to set the DMA Output request status
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers
+ *
+ * \param   dmaStatus       Flag which is used to enable(1)/disable(0) the DMA status.
+ *
+ */
+static void DTHE_AES_setDMAOutputRequestStatus(CSL_AesRegs *ptrAesRegs, uint8_t dmaStatus)
+{
+    if (dmaStatus == 1U)
+    {
+        CSL_REG32_FINS(&ptrAesRegs->SYSCONFIG,AES_S_SYSCONFIG_DMA_REQ_DATA_OUT_EN, 1U);
+    }
+    else
+    {
+        CSL_REG32_FINS(&ptrAesRegs->SYSCONFIG,AES_S_SYSCONFIG_DMA_REQ_DATA_OUT_EN, 0U);
+    }
+
+    return;
+}
+
+/**
+ * \brief                   The function is used to set the DMA Input request status
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers
+ *
+ * \param   dmaStatus       Flag which is used to enable(1)/disable(0) the DMA status.
+ *
+ */
+static void DTHE_AES_setDMAInputRequestStatus(CSL_AesRegs *ptrAesRegs, uint8_t dmaStatus)
+{
+    if (dmaStatus == 1U)
+    {
+        CSL_REG32_FINS(&ptrAesRegs->SYSCONFIG,AES_S_SYSCONFIG_DMA_REQ_DATA_IN_EN, 1U);
+    }
+    else
+    {
+        CSL_REG32_FINS(&ptrAesRegs->SYSCONFIG,AES_S_SYSCONFIG_DMA_REQ_DATA_IN_EN, 0U);
+    }
+
+    return;
+}
+
+/**
+ * \brief                   The function is used to set the key size
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers
+ *
+ * \param   size            Size of the key to be configured.
+ *
+ */
+static void DTHE_AES_setKeySize(CSL_AesRegs *ptrAesRegs, uint8_t size)
+{
+    uint8_t keySize;
+
+    if (size == CSL_AES_S_CTRL_KEY_SIZE_KEY128)
+    {
+        keySize = 1U;
+    }
+    else if (size == CSL_AES_S_CTRL_KEY_SIZE_KEY192)
+    {
+        keySize = 2U;
+    }
+    else if (size == CSL_AES_S_CTRL_KEY_SIZE_KEY256)
+    {
+        keySize = 3U;
+    }
+    else
+    {
+        keySize = 0U;
+    }
+    CSL_REG32_FINS(&ptrAesRegs->CTRL,AES_S_CTRL_KEY_SIZE, keySize);
+
+    return;
+}
+
+/**
+ * \brief                   The function is used to configure the key in the AES module This will only configure the 256bit keys.
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers
+ *
+ * \param   ptrKey          Pointer to the 256bit key to be used.
+ *
+ */
+static void DTHE_AES_set256BitKey1(CSL_AesRegs *ptrAesRegs, const uint32_t* ptrKey)
+{
+    ptrAesRegs->KEY1_0 = ptrKey[0U];
+    ptrAesRegs->KEY1_1 = ptrKey[1U];
+    ptrAesRegs->KEY1_2 = ptrKey[2U];
+    ptrAesRegs->KEY1_3 = ptrKey[3U];
+    ptrAesRegs->KEY1_4 = ptrKey[4U];
+    ptrAesRegs->KEY1_5 = ptrKey[5U];
+    ptrAesRegs->KEY1_6 = ptrKey[6U];
+    ptrAesRegs->KEY1_7 = ptrKey[7U];
+
+    return;
+}
+
+/**
+ * \brief                   The function is used to configure the key in the AES module This will only configure the 128bit keys.
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers
+ *
+ * \param   ptrKey          Pointer to the 128bit key to be used.
+ *
+ */
+static void DTHE_AES_set128BitKey2Part1(CSL_AesRegs *ptrAesRegs, const uint32_t* ptrKey)
+{
+    ptrAesRegs->KEY2_0 = ptrKey[0U];
+    ptrAesRegs->KEY2_1 = ptrKey[1U];
+    ptrAesRegs->KEY2_2 = ptrKey[2U];
+    ptrAesRegs->KEY2_3 = ptrKey[3U];
+
+    return;
+}
+
+/**
+ * \brief                   The function is used to configure the key in the AES module This will only configure the 128bit keys.
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers
+ *
+ * \param   ptrKey          Pointer to the 128bit key to be used.
+ *
+ */
+static void DTHE_AES_set128BitKey2Part2(CSL_AesRegs *ptrAesRegs, const uint32_t* ptrKey)
+{
+    ptrAesRegs->KEY2_4 = ptrKey[0U];
+    ptrAesRegs->KEY2_5 = ptrKey[1U];
+    ptrAesRegs->KEY2_6 = ptrKey[2U];
+    ptrAesRegs->KEY2_7 = ptrKey[3U];
+
+    return;
+}
+
+/**
+ * \brief                   The function is used to set the Initialization Vector (IV) in the AES module.
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers.
+ *
+ * \param   ptrIV           Pointer to the IV data to be used.
+ *
+ */
+static void DTHE_AES_clearIV(CSL_AesRegs *ptrAesRegs)
+{
+    ptrAesRegs->IV_IN_0 = 0U;
+    ptrAesRegs->IV_IN_1 = 0U;
+    ptrAesRegs->IV_IN_2 = 0U;
+    ptrAesRegs->IV_IN_3 = 0U;
+
+    return;
+}
+
+/**
+ * \brief                   The function is used to clear the Initialization Vector (IV) in the AES module.
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers.
+ *
+ */
+static void DTHE_AES_setIV(CSL_AesRegs *ptrAesRegs, const uint32_t* ptrIV)
+{
+    /* Clear the IV value in registers */
+    DTHE_AES_clearIV(ptrAesRegs);
+
+    ptrAesRegs->IV_IN_0 = ptrIV[0U];
+    ptrAesRegs->IV_IN_1 = ptrIV[1U];
+    ptrAesRegs->IV_IN_2 = ptrIV[2U];
+    ptrAesRegs->IV_IN_3 = ptrIV[3U];
+
+    return;
+}
+
+/**
+ * \brief                   The function is used to poll until the AES IP block is ready to receive data.
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers
+ *
+ */
+static void DTHE_AES_pollInputReady(CSL_AesRegs *ptrAesRegs)
+{
+    uint8_t     done = 0U;
+
+    /* Loop around till the condition is met: */
+    while (done == 0U)
+    {
+        done = CSL_REG32_FEXT(&ptrAesRegs->CTRL, AES_S_CTRL_INPUT_READY);
+    }
+    return;
+}
+
+/**
+ * \brief                   The function is used to write the data and pass this to the AES engine.
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers.
+ *
+ * \param   ptrData         Pointer to the data to be written.
+ *
+ */
+static void DTHE_AES_writeDataBlock(CSL_AesRegs *ptrAesRegs, const uint32_t* ptrData)
+{
+    ptrAesRegs->DATA_IN_3 = ptrData[0U];
+    ptrAesRegs->DATA_IN_2 = ptrData[1U];
+    ptrAesRegs->DATA_IN_1 = ptrData[2U];
+    ptrAesRegs->DATA_IN_0 = ptrData[3U];
+
+    return;
+}
+
+/**
+ * \brief                   The function is used to poll until the AES IP block has available data which can be read out.
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers
+ *
+ */
+static void DTHE_AES_pollOutputReady(CSL_AesRegs *ptrAesRegs)
+{
+    uint8_t     done = 0U;
+
+    /* Loop around till the condition is met: */
+    while (done == 0U)
+    {
+        done = CSL_REG32_FEXT(&ptrAesRegs->CTRL, AES_S_CTRL_OUTPUT_READY);
+    }
+    return;
+}
+
+/**
+ * \brief                   The function is used to poll until the AES IP block has available context out register
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers
+ *
+ */
+static void DTHE_AES_pollContextReady(CSL_AesRegs *ptrAesRegs)
+{
+    uint8_t     done = 0U;
+
+    /* Loop around till the condition is met: */
+    while (done == 0U)
+    {
+        done = CSL_REG32_FEXT(&ptrAesRegs->CTRL, AES_S_CTRL_SAVE_CONTEXT_READY);
+    }
+    return;
+}
+
+/**
+ * \brief                   The function is used to read the data from the AES engine
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers
+ *
+ * \param   ptrData         Pointer to the data buffer populated by the API
+ *
+ */
+static void DTHE_AES_readDataBlock(CSL_AesRegs *ptrAesRegs, uint32_t* ptrData)
+{
+    ptrData[0] = ptrAesRegs->DATA_IN_3;
+    ptrData[1] = ptrAesRegs->DATA_IN_2;
+    ptrData[2] = ptrAesRegs->DATA_IN_1;
+    ptrData[3] = ptrAesRegs->DATA_IN_0;
+
+    return;
+}
+
+static void DTHE_AES_readTag(CSL_AesRegs *ptrAesRegs, uint32_t* ptrTag)
+{
+    ptrTag[0] = ptrAesRegs->TAG_OUT_0;
+    ptrTag[1] = ptrAesRegs->TAG_OUT_1;
+    ptrTag[2] = ptrAesRegs->TAG_OUT_2;
+    ptrTag[3] = ptrAesRegs->TAG_OUT_3;
+
+    return;
+}
+
+/**
+ * \brief                   The function is used to record the parameters of a new operation in its context.
+ *
+ * \param   ptrContext      Pointer to the AES context.
+ *
+ * \param   ptrParams       Pointer to the parameters passed at one-shot or stream init.
+ *
+ */
+static void DTHE_AES_captureContext(DTHE_AES_Context *ptrContext, const DTHE_AES_Params* ptrParams)
+{
+    ptrContext->algoType        = ptrParams->algoType;
+    ptrContext->opType          = ptrParams->opType;
+    ptrContext->useKEKMode      = ptrParams->useKEKMode;
+    ptrContext->ptrKey          = ptrParams->ptrKey;
+    ptrContext->ptrKey1         = ptrParams->ptrKey1;
+    ptrContext->ptrKey2         = ptrParams->ptrKey2;
+    ptrContext->keyLen          = ptrParams->keyLen;
+    ptrContext->counterWidth    = ptrParams->counterWidth;
+    ptrContext->ccmL            = ptrParams->ccmL;
+    ptrContext->ccmM            = ptrParams->ccmM;
+    ptrContext->aadLength       = ptrParams->aadLenght;
+    ptrContext->dataLenBytes    = ptrParams->dataLenBytes;
+    ptrContext->isLengthKnown   = ((ptrParams->dataLenBytes != 0U) ||
+                                   (ptrParams->streamState == DTHE_AES_ONE_SHOT_SUPPORT)) ? 1U : 0U;
+    ptrContext->processedBytes  = 0U;
+    ptrContext->carryLenBytes   = 0U;
+    (void)memset((void *)&ptrContext->iv[0U], 0, sizeof(ptrContext->iv));
+
+    return;
+}
+
+/**
+ * \brief                   The function is used to program the AES engine from a context.
+ *                          This is used both to start a new operation and to resume a saved one.
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers.
+ *
+ * \param   ptrContext      Pointer to the AES context.
+ *
+ * \param   ptrIV           IV to be loaded. NULL clears the IV.
+ *
+ */
+static void DTHE_AES_programContext(CSL_AesRegs *ptrAesRegs, const DTHE_AES_Context *ptrContext, const uint32_t* ptrIV)
+{
+    uint32_t algoType = ptrContext->algoType;
+
+    DTHE_AES_controlMode(ptrAesRegs, algoType);
+
+    /* Key Size setting */
+    DTHE_AES_setKeySize(ptrAesRegs, ptrContext->keyLen);
+
+    /* Select the key input: */
+    if (ptrContext->useKEKMode == TRUE)
+    {
+        /* KEK Mode: Enable Direct Bus */
+        CSL_REG32_FINS(&ptrAesRegs->SYSCONFIG,AES_S_SYSCONFIG_DIRECTBUSEN,1U);
+    }
+    else
+    {
+        /* Normal Key Mode: */
+        CSL_REG32_FINS(&ptrAesRegs->SYSCONFIG,AES_S_SYSCONFIG_DIRECTBUSEN,0U);
+
+        if (ptrContext->ptrKey != NULL)
+        {
+            /* Configure the key which is to be used: */
+            DTHE_AES_set256BitKey1 (ptrAesRegs, ptrContext->ptrKey);
+        }
+
+        if (algoType == DTHE_AES_CMAC_MODE)
+        {
+            DTHE_AES_set128BitKey2Part1(ptrAesRegs, ptrContext->ptrKey1);
+            DTHE_AES_set128BitKey2Part2(ptrAesRegs, ptrContext->ptrKey2);
+        }
+        else if (algoType == DTHE_AES_XTS_MODE)
+        {
+            /* Tweak key, same size as the data key */
+            DTHE_AES_set128BitKey2Part1(ptrAesRegs, &ptrContext->ptrKey2[0U]);
+            DTHE_AES_set128BitKey2Part2(ptrAesRegs, &ptrContext->ptrKey2[4U]);
+        }
+        else
+        {
+            /* No second key for the other modes */
+        }
+    }
+
+    DTHE_AES_setOpType(ptrAesRegs, ptrContext->opType);
+
+    if((algoType == DTHE_AES_CTR_MODE)||(algoType == DTHE_AES_ICM_MODE))
+    {
+        DTHE_AES_CTRWidth(ptrAesRegs, ptrContext->counterWidth);
+    }
+
+    /* Configure the Initialization Vector */
+    if((algoType == DTHE_AES_CBC_MODE)\
+        ||(algoType == DTHE_AES_CTR_MODE)\
+        ||(algoType == DTHE_AES_ICM_MODE)\
+        ||(algoType == DTHE_AES_CFB_MODE))
+    {
+        if (ptrIV != NULL)
+        {
+            DTHE_AES_setIV(ptrAesRegs, ptrIV);
+        }
+    }
+    else if(algoType == DTHE_AES_XTS_MODE)
+    {
+        if (ptrIV != NULL)
+        {
+            DTHE_AES_loadXtsTweak(ptrAesRegs, ptrIV);
+        }
+    }
+    else if((algoType == DTHE_AES_CBC_MAC_MODE)||(algoType == DTHE_AES_CMAC_MODE))
+    {
+        /* The IV carries the partial MAC when a saved context is resumed */
+        if (ptrIV != NULL)
+        {
+            DTHE_AES_setIV(ptrAesRegs, ptrIV);
+        }
+        else
+        {
+            DTHE_AES_clearIV(ptrAesRegs);
+        }
+        /* Enable Save Context in CTRL register*/
+        CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_SAVE_CONTEXT, 1U);
+    }
+    else
+    {
+        /* No IV for the other modes */
+    }
+
+    if (algoType == DTHE_AES_GCM_MODE)
+    {
+        /* J0 at init, the running counter when a context is resumed */
+        if (ptrIV != NULL)
+        {
+            DTHE_AES_setIV(ptrAesRegs, ptrIV);
+        }
+        /* Enable Save Context in CTRL register to read the tag */
+        CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_SAVE_CONTEXT, 1U);
+        DTHE_AES_CTRWidth(ptrAesRegs, DTHE_AES_CTR_WIDTH_32);
+    }
+
+    if (algoType == DTHE_AES_CCM_MODE)
+    {
+        /* Clear the IV value */
+        DTHE_AES_clearIV(ptrAesRegs);
+        if (ptrIV != NULL)
+        {
+            DTHE_AES_setIV(ptrAesRegs, ptrIV);
+        }
+        /* Enable Save Context in CTRL register*/
+        CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_SAVE_CONTEXT, 1U);
+        /* Nonce Length */
+        DTHE_AES_setCCM_L(ptrAesRegs, ptrContext->ccmL);
+        /* Tag Length */
+        DTHE_AES_setCCM_M(ptrAesRegs, ptrContext->ccmM);
+        DTHE_AES_CTRWidth(ptrAesRegs, DTHE_AES_CTR_WIDTH_32);
+        /* Setup the AAD data length: */
+        DTHE_AES_setAADLengthBytes(ptrAesRegs, ptrContext->aadLength);
+    }
+
+    /*
+    - DataLength is known, then set the remaining length here. A one-shot
+      operation without payload (CCM with AAD only) has a known length of 0.
+    - DataLength is not known, then set the length as maximum. */
+    if ((ptrContext->isLengthKnown == 0U) && (algoType != DTHE_AES_GCM_MODE))
+    {
+        /* Setup the data length: */
+        DTHE_AES_setDataLengthBytes(ptrAesRegs, MAX_VALUE);
+    }
+    else
+    {
+        /* Setup the data length: */
+        DTHE_AES_setDataLengthBytes(ptrAesRegs, ptrContext->dataLenBytes - ptrContext->processedBytes);
+    }
+
+    if (algoType == DTHE_AES_GCM_MODE)
+    {
+        /* Writing the AAD length last starts the GCM operation */
+        DTHE_AES_setAADLengthBytes(ptrAesRegs, ptrContext->aadLength);
+    }
+
+    return;
+}
+
+/**
+ * \brief                   The function is used to save the running state of a context out of the AES engine.
+ *                          In between blocks the IV registers hold the updated IV/counter, which for
+ *                          CBC-MAC and CMAC is the partial MAC.
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers.
+ *
+ * \param   ptrContext      Pointer to the AES context to be saved.
+ *
+ */
+static void DTHE_AES_saveContext(CSL_AesRegs *ptrAesRegs, DTHE_AES_Context *ptrContext)
+{
+    /* Make sure that the engine has finished with the last block */
+    DTHE_AES_pollInputReady(ptrAesRegs);
+
+    ptrContext->iv[0U] = ptrAesRegs->IV_IN_0;
+    ptrContext->iv[1U] = ptrAesRegs->IV_IN_1;
+    ptrContext->iv[2U] = ptrAesRegs->IV_IN_2;
+    ptrContext->iv[3U] = ptrAesRegs->IV_IN_3;
+
+    return;
+}
+
+/**
+ * \brief                   The function is used to save the context which is loaded in the engine
+ *                          before the engine is used by another context.
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers.
+ *
+ * \param   attrs           Pointer to the DTHE attributes.
+ *
+ * \param   ptrNextContext  Pointer to the context which is going to use the engine.
+ *
+ * \return                  #DTHE_AES_RETURN_SUCCESS if the engine is free for the next context.
+ *                          #DTHE_AES_RETURN_FAILURE if the loaded context cannot be saved.
+ */
+static DTHE_AES_Return_t DTHE_AES_switchOutContext(CSL_AesRegs *ptrAesRegs, DTHE_Attrs *attrs, const DTHE_AES_Context *ptrNextContext)
+{
+    DTHE_AES_Return_t   status = DTHE_AES_RETURN_SUCCESS;
+    DTHE_AES_Context    *ptrActiveContext = (DTHE_AES_Context *)attrs->aesActiveCtx;
+
+    if ((ptrActiveContext != NULL) && (ptrActiveContext != ptrNextContext) &&
+        (ptrActiveContext->state == AES_STATE_IN_PROGRESS))
+    {
+        if ((ptrActiveContext->algoType == DTHE_AES_CCM_MODE) || (ptrActiveContext->algoType == DTHE_AES_GCM_MODE) ||
+            (ptrActiveContext->algoType == DTHE_AES_XTS_MODE))
+        {
+            /* The CCM/GCM MAC state and the XTS running tweak cannot be read back while the stream is open */
+            status = DTHE_AES_RETURN_FAILURE;
+        }
+        else
+        {
+            DTHE_AES_saveContext(ptrAesRegs, ptrActiveContext);
+            attrs->aesActiveCtx = NULL;
+        }
+    }
+
+    return (status);
+}
+
+/**
+ * \brief                   The function is used to feed the AAD of a combined mode to the AES engine.
+ *                          Full blocks are moved by DMA when it is enabled, a partial last block is
+ *                          padded with zeros and written by the CPU.
+ *
+ * \param   config          Pointer to the DTHE configuration.
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers.
+ *
+ * \param   ptrAAD          Pointer to the AAD.
+ *
+ * \param   aadLenBytes     Length of the AAD in bytes.
+ *
+ */
+static void DTHE_AES_processAAD(const DTHE_Config *config, CSL_AesRegs *ptrAesRegs, uint32_t* ptrAAD, uint32_t aadLenBytes)
+{
+    DMA_Handle  dmaHandle = NULL;
+    uint16_t    numBlocks;
+    uint32_t    partialDataSize;
+    uint32_t    index = 0U;
+    uint8_t     partialBlock[16U];
+
+    numBlocks       = (uint16_t)(aadLenBytes / 16U);
+    partialDataSize = aadLenBytes % 16U;
+
+    if ((config->dmaEnable == DMA_ENABLE) && (numBlocks > 0U))
+    {
+        /* AAD only goes in: the engine produces no output for it */
+        dmaHandle = DMA_open(0);
+        DMA_Config_TxChannel(dmaHandle, ptrAAD, (uint32_t *)&ptrAesRegs->DATA_IN_3, numBlocks, 0U, DMA_AES_ENABLE);
+        DTHE_AES_clearAllInterrupts(ptrAesRegs);
+        DMA_enableTxTransferRegion(dmaHandle, DMA_AES_ENABLE);
+        DTHE_AES_setDMAInputRequestStatus(ptrAesRegs, 1);
+        DMA_WaitForTxTransfer(dmaHandle, DMA_AES_ENABLE);
+        DTHE_AES_setDMAInputRequestStatus(ptrAesRegs, 0);
+        DMA_disableTxCh(dmaHandle, DMA_AES_ENABLE);
+        index = numBlocks;
+    }
+    else
+    {
+        for (index = 0U; index < numBlocks; index++)
+        {
+            DTHE_AES_pollInputReady(ptrAesRegs);
+            DTHE_AES_writeDataBlock(ptrAesRegs, &ptrAAD[index << 2U]);
+        }
+    }
+
+    if (partialDataSize != 0U)
+    {
+        (void)memset ((void *)&partialBlock[0U], 0, sizeof(partialBlock));
+        (void)memcpy ((void *)&partialBlock[0U], (const void *)&ptrAAD[index << 2U], partialDataSize);
+        DTHE_AES_pollInputReady(ptrAesRegs);
+        DTHE_AES_writeDataBlock(ptrAesRegs, (uint32_t *)&partialBlock[0U]);
+    }
+
+    return;
+}
+
+/**
+ * \brief                   The function is used to feed the AAD and the payload of a combined mode to the
+ *                          AES engine in one pass. With DMA the input channel walks a linked list of the
+ *                          full AAD blocks, the zero padded last AAD block and the payload blocks, while
+ *                          the output channel only receives the payload blocks.
+ *
+ * \param   config          Pointer to the DTHE configuration.
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers.
+ *
+ * \param   ptrAAD          Pointer to the AAD.
+ *
+ * \param   aadLenBytes     Length of the AAD in bytes.
+ *
+ * \param   isOutputRequired Flag which indicates if output blocks are read.
+ *
+ * \param   ptrInput        Pointer to the full payload input blocks.
+ *
+ * \param   ptrOutput       Pointer to the full payload output blocks.
+ *
+ * \param   numBlocks       Number of full payload blocks.
+ *
+ */
+static void DTHE_AES_processAADAndBlocks(const DTHE_Config *config, CSL_AesRegs *ptrAesRegs, uint32_t* ptrAAD, uint32_t aadLenBytes,
+                                         uint8_t isOutputRequired, uint32_t* ptrInput, uint32_t* ptrOutput, uint16_t numBlocks)
+{
+    DMA_Handle  dmaHandle = NULL;
+    DMA_SgEntry txList[3U];
+    uint32_t    numEntries = 0U;
+    uint32_t    aadBlocks;
+    uint32_t    partialDataSize;
+    uint8_t     useDma = 0U;
+
+    aadBlocks       = aadLenBytes / 16U;
+    partialDataSize = aadLenBytes % 16U;
+
+    if ((config->dmaEnable == DMA_ENABLE) && (aadBlocks <= 0xFFFFU))
+    {
+        if (aadBlocks > 0U)
+        {
+            txList[numEntries].address   = ptrAAD;
+            txList[numEntries].numBlocks = (uint16_t)aadBlocks;
+            numEntries++;
+        }
+        if (partialDataSize != 0U)
+        {
+            /* The last AAD block is zero padded in driver memory */
+            (void)memset ((void *)&gDtheAesSgInBounce[0U], 0, 16U);
+            (void)memcpy ((void *)&gDtheAesSgInBounce[0U], (const void *)&ptrAAD[aadBlocks << 2U], partialDataSize);
+            CacheP_wb((void *)&gDtheAesSgInBounce[0U], 16U, CacheP_TYPE_ALLD);
+
+            txList[numEntries].address   = &gDtheAesSgInBounce[0U];
+            txList[numEntries].numBlocks = 1U;
+            numEntries++;
+        }
+        if (numBlocks > 0U)
+        {
+            txList[numEntries].address   = ptrInput;
+            txList[numEntries].numBlocks = numBlocks;
+            numEntries++;
+        }
+
+        if (numEntries > 0U)
+        {
+            dmaHandle = DMA_open(0);
+
+            if (DMA_Config_TxSgChannel(dmaHandle, &txList[0U], numEntries, (uint32_t *)&ptrAesRegs->DATA_IN_3, 0U,
+                                       DMA_AES_ENABLE) == DMA_RETURN_SUCCESS)
+            {
+                useDma = 1U;
+            }
+            else
+            {
+                /* No link PaRAM set left for the list: release the ones taken and feed the engine with the CPU */
+                DMA_disableTxCh(dmaHandle, DMA_AES_ENABLE);
+            }
+        }
+    }
+
+    if (useDma == 1U)
+    {
+        if ((isOutputRequired == 1U) && (numBlocks > 0U))
+        {
+            DMA_Config_RxChannel(dmaHandle, (uint32_t *)&ptrAesRegs->DATA_IN_3, ptrOutput, numBlocks);
+        }
+
+        DTHE_AES_clearAllInterrupts(ptrAesRegs);
+
+        if ((isOutputRequired == 1U) && (numBlocks > 0U))
+        {
+            DTHE_AES_setDMAOutputRequestStatus(ptrAesRegs, 1);
+            DMA_enableRxTransferRegion(dmaHandle);
+        }
+
+        DMA_enableTxTransferRegion(dmaHandle, DMA_AES_ENABLE);
+        DTHE_AES_setDMAInputRequestStatus(ptrAesRegs, 1);
+
+        if ((isOutputRequired == 1U) && (numBlocks > 0U))
+        {
+            DMA_WaitForRxTransfer(dmaHandle);
+        }
+
+        DMA_WaitForTxTransfer(dmaHandle, DMA_AES_ENABLE);
+
+        DTHE_AES_setDMAInputRequestStatus(ptrAesRegs, 0);
+        if ((isOutputRequired == 1U) && (numBlocks > 0U))
+        {
+            DTHE_AES_setDMAOutputRequestStatus(ptrAesRegs, 0);
+        }
+
+        DMA_disableTxCh(dmaHandle, DMA_AES_ENABLE);
+
+        if ((isOutputRequired == 1U) && (numBlocks > 0U))
+        {
+            DMA_disableRxCh(dmaHandle);
+        }
+    }
+    else
+    {
+        DTHE_AES_processAAD(config, ptrAesRegs, ptrAAD, aadLenBytes);
+        DTHE_AES_processBlocks(config, ptrAesRegs, isOutputRequired, ptrInput, ptrOutput, numBlocks);
+    }
+
+    return;
+}
+
+/**
+ * \brief                   The function is used to compute the GCM pre-counter block J0.
+ *                          A 96-bit IV is used as IV || 0^31 || 1. Any other IV length needs
+ *                          GHASH(IV || 0^s || [len(IV)]64) under H = E(K, 0^128), which is
+ *                          computed with one ECB block on the engine and the table based GHASH.
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers.
+ *
+ * \param   ptrContext      Pointer to the AES context holding the key.
+ *
+ * \param   ptrIV           Pointer to the IV.
+ *
+ * \param   ivLenBytes      Length of the IV in bytes.
+ *
+ * \param   ptrJ0           Pointer to the 16 byte pre-counter block populated by the API.
+ *
+ */
+static void DTHE_AES_computeGcmJ0(CSL_AesRegs *ptrAesRegs, const DTHE_AES_Context *ptrContext, const uint32_t* ptrIV, uint32_t ivLenBytes, uint32_t* ptrJ0)
+{
+    uint8_t             j0[16U];
+    uint8_t             lenBlock[16U];
+    uint32_t            hashKey[DTHE_AES_BLOCK_SIZE_WORDS];
+    DTHE_AES_GhashTable ghashTable;
+
+    (void)memset ((void *)&j0[0U], 0, sizeof(j0));
+
+    if (ivLenBytes == DTHE_AES_GCM_IV_96BIT_SIZE_BYTES)
+    {
+        (void)memcpy ((void *)&j0[0U], (const void *)ptrIV, DTHE_AES_GCM_IV_96BIT_SIZE_BYTES);
+        j0[15U] = 1U;
+    }
+    else
+    {
+        DTHE_AES_encryptZeroBlock(ptrAesRegs, ptrContext, &hashKey[0U]);
+        DTHE_AES_ghashInitTable(&ghashTable, (const uint8_t *)&hashKey[0U]);
+
+        DTHE_AES_ghashUpdate(&ghashTable, &j0[0U], (const uint8_t *)ptrIV, ivLenBytes);
+
+        (void)memset ((void *)&lenBlock[0U], 0, sizeof(lenBlock));
+        DTHE_AES_putBE64(&lenBlock[8U], (uint64_t)ivLenBytes * 8U);
+        DTHE_AES_ghashUpdate(&ghashTable, &j0[0U], &lenBlock[0U], sizeof(lenBlock));
+
+        /* H is derived from the key: do not leave it on the stack */
+        (void)memset ((void *)&hashKey[0U], 0, sizeof(hashKey));
+        (void)memset ((void *)&ghashTable, 0, sizeof(ghashTable));
+    }
+
+    (void)memcpy ((void *)ptrJ0, (const void *)&j0[0U], sizeof(j0));
+
+    return;
+}
+
+/**
+ * \brief                   The function is used to encrypt one all-zero block in ECB mode with the key
+ *                          of the context. This gives the GHASH key H.
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers.
+ *
+ * \param   ptrContext      Pointer to the AES context holding the key.
+ *
+ * \param   ptrOutput       Pointer to the 16 byte output populated by the API.
+ *
+ */
+static void DTHE_AES_encryptZeroBlock(CSL_AesRegs *ptrAesRegs, const DTHE_AES_Context *ptrContext, uint32_t* ptrOutput)
+{
+    uint32_t zeroBlock[DTHE_AES_BLOCK_SIZE_WORDS] = {0U, 0U, 0U, 0U};
+
+    DTHE_AES_controlMode(ptrAesRegs, DTHE_AES_ECB_MODE);
+    DTHE_AES_setKeySize(ptrAesRegs, ptrContext->keyLen);
+
+    if (ptrContext->useKEKMode == TRUE)
+    {
+        CSL_REG32_FINS(&ptrAesRegs->SYSCONFIG,AES_S_SYSCONFIG_DIRECTBUSEN,1U);
+    }
+    else
+    {
+        CSL_REG32_FINS(&ptrAesRegs->SYSCONFIG,AES_S_SYSCONFIG_DIRECTBUSEN,0U);
+        DTHE_AES_set256BitKey1 (ptrAesRegs, ptrContext->ptrKey);
+    }
+
+    DTHE_AES_setOpType(ptrAesRegs, DTHE_AES_ENCRYPT);
+    DTHE_AES_setDataLengthBytes(ptrAesRegs, sizeof(zeroBlock));
+
+    DTHE_AES_pollInputReady(ptrAesRegs);
+    DTHE_AES_writeDataBlock(ptrAesRegs, &zeroBlock[0U]);
+    DTHE_AES_pollOutputReady(ptrAesRegs);
+    DTHE_AES_readDataBlock(ptrAesRegs, ptrOutput);
+
+    return;
+}
+
+/**
+ * \brief                   The function is used to read the GCM tag once the last block has been
+ *                          processed. On encryption the tag is returned to the caller, on decryption
+ *                          it is compared in constant time with the tag passed by the caller.
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers.
+ *
+ * \param   ptrParams       Pointer to the parameters of the operation.
+ *
+ * \return                  #DTHE_AES_RETURN_SUCCESS if the tag was returned or matched.
+ *                          #DTHE_AES_RETURN_FAILURE if the tag length is invalid or the tag did not match.
+ */
+static DTHE_AES_Return_t DTHE_AES_finishGcmTag(CSL_AesRegs *ptrAesRegs, const DTHE_AES_Params* ptrParams)
+{
+    DTHE_AES_Return_t   status = DTHE_AES_RETURN_SUCCESS;
+    uint32_t            tag[DTHE_AES_BLOCK_SIZE_WORDS];
+    uint32_t            tagLenBytes = ptrParams->tagLenBytes;
+
+    if (tagLenBytes == 0U)
+    {
+        tagLenBytes = DTHE_AES_TAG_SIZE_BYTES;
+    }
+
+    if ((tagLenBytes > DTHE_AES_TAG_SIZE_BYTES) || (ptrParams->ptrTag == NULL))
+    {
+        status = DTHE_AES_RETURN_FAILURE;
+    }
+
+    /* Always drain the tag so that the engine is ready for the next operation */
+    DTHE_AES_pollContextReady(ptrAesRegs);
+    DTHE_AES_readTag(ptrAesRegs, &tag[0U]);
+
+    if (status == DTHE_AES_RETURN_SUCCESS)
+    {
+        if (ptrParams->opType == DTHE_AES_ENCRYPT)
+        {
+            (void)memcpy ((void *)ptrParams->ptrTag, (const void *)&tag[0U], tagLenBytes);
+        }
+        else
+        {
+            status = DTHE_AES_compareTags((const uint8_t *)&tag[0U], (const uint8_t *)ptrParams->ptrTag, tagLenBytes);
+        }
+    }
+
+    (void)memset ((void *)&tag[0U], 0, sizeof(tag));
+
+    return (status);
+}
+
+/**
+ * \brief                   The function is used to compare a computed tag with a received tag. The time
+ *                          taken does not depend on the position of the first differing byte.
+ *
+ * \param   ptrComputedTag  Pointer to the computed tag.
+ *
+ * \param   ptrReceivedTag  Pointer to the received tag.
+ *
+ * \param   tagLenBytes     Number of bytes to be compared.
+ *
+ * \return                  #DTHE_AES_RETURN_SUCCESS if the tags match.
+ *                          #DTHE_AES_RETURN_FAILURE otherwise.
+ */
+static DTHE_AES_Return_t DTHE_AES_compareTags(const uint8_t *ptrComputedTag, const uint8_t *ptrReceivedTag, uint32_t tagLenBytes)
+{
+    DTHE_AES_Return_t   status = DTHE_AES_RETURN_SUCCESS;
+    uint8_t             diff = 0U;
+    uint32_t            index;
+
+    for (index = 0U; index < tagLenBytes; index++)
+    {
+        diff = (uint8_t)(diff | (ptrComputedTag[index] ^ ptrReceivedTag[index]));
+    }
+    if (diff != 0U)
+    {
+        status = DTHE_AES_RETURN_FAILURE;
+    }
+
+    return (status);
+}
+
+/**
+ * \brief                   The function is used to read a big-endian 64-bit value.
+ *
+ * \param   ptrData         Pointer to the 8 bytes to be read.
+ *
+ * \return                  The 64-bit value.
+ */
+static uint64_t DTHE_AES_getBE64(const uint8_t *ptrData)
+{
+    uint64_t value = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < 8U; i++)
+    {
+        value = (value << 8U) | (uint64_t)ptrData[i];
+    }
+    return (value);
+}
+
+/**
+ * \brief                   The function is used to write a 64-bit value in big-endian order.
+ *
+ * \param   ptrData         Pointer to the 8 bytes to be written.
+ *
+ * \param   value           Value to be written.
+ *
+ */
+static void DTHE_AES_putBE64(uint8_t *ptrData, uint64_t value)
+{
+    uint32_t i;
+
+    for (i = 0U; i < 8U; i++)
+    {
+        ptrData[i] = (uint8_t)(value >> (56U - (8U * i)));
+    }
+    return;
+}
+
+/**
+ * \brief                   The function is used to build the 4-bit multiplication table of the hash key.
+ *
+ * \param   ptrTable        Pointer to the table to be populated.
+ *
+ * \param   ptrHashKey      Pointer to the 16 byte hash key H.
+ *
+ */
+static void DTHE_AES_ghashInitTable(DTHE_AES_GhashTable *ptrTable, const uint8_t *ptrHashKey)
+{
+    uint64_t    vh;
+    uint64_t    vl;
+    uint32_t    i;
+    uint32_t    j;
+
+    vh = DTHE_AES_getBE64(&ptrHashKey[0U]);
+    vl = DTHE_AES_getBE64(&ptrHashKey[8U]);
+
+    /* Entry 8 is H, entries 4, 2 and 1 are H.x, H.x^2 and H.x^3 */
+    ptrTable->hl[0U] = 0U;
+    ptrTable->hh[0U] = 0U;
+    ptrTable->hl[8U] = vl;
+    ptrTable->hh[8U] = vh;
+    for (i = 4U; i > 0U; i = i >> 1U)
+    {
+        uint64_t reduce = (vl & 1U) * 0xE100000000000000ULL;
+        vl = (vh << 63U) | (vl >> 1U);
+        vh = (vh >> 1U) ^ reduce;
+        ptrTable->hl[i] = vl;
+        ptrTable->hh[i] = vh;
+    }
+
+    /* Remaining entries are the XOR combinations of the above */
+    for (i = 2U; i <= 8U; i = i << 1U)
+    {
+        for (j = 1U; j < i; j++)
+        {
+            ptrTable->hh[i + j] = ptrTable->hh[i] ^ ptrTable->hh[j];
+            ptrTable->hl[i + j] = ptrTable->hl[i] ^ ptrTable->hl[j];
+        }
+    }
+    return;
+}
+
+/**
+ * \brief                   The function is used to multiply a block by the hash key in GF(2^128).
+ *
+ * \param   ptrTable        Pointer to the multiplication table of the hash key.
+ *
+ * \param   ptrBlock        Pointer to the 16 byte block, replaced by the product.
+ *
+ */
+static void DTHE_AES_ghashMultiply(const DTHE_AES_GhashTable *ptrTable, uint8_t *ptrBlock)
+{
+    uint64_t    zh;
+    uint64_t    zl;
+    uint32_t    lo;
+    uint32_t    hi;
+    uint32_t    rem;
+    int32_t     i;
+
+    lo = (uint32_t)ptrBlock[15U] & 0x0FU;
+    zh = ptrTable->hh[lo];
+    zl = ptrTable->hl[lo];
+
+    for (i = 15; i >= 0; i--)
+    {
+        lo = (uint32_t)ptrBlock[i] & 0x0FU;
+        hi = ((uint32_t)ptrBlock[i] >> 4U) & 0x0FU;
+
+        if (i != 15)
+        {
+            rem = (uint32_t)(zl & 0x0FU);
+            zl = (zh << 60U) | (zl >> 4U);
+            zh = (zh >> 4U) ^ (gDtheAesGhashLast4[rem] << 48U);
+            zh = zh ^ ptrTable->hh[lo];
+            zl = zl ^ ptrTable->hl[lo];
+        }
+
+        rem = (uint32_t)(zl & 0x0FU);
+        zl = (zh << 60U) | (zl >> 4U);
+        zh = (zh >> 4U) ^ (gDtheAesGhashLast4[rem] << 48U);
+        zh = zh ^ ptrTable->hh[hi];
+        zl = zl ^ ptrTable->hl[hi];
+    }
+
+    DTHE_AES_putBE64(&ptrBlock[0U], zh);
+    DTHE_AES_putBE64(&ptrBlock[8U], zl);
+    return;
+}
+
+/**
+ * \brief                   The function is used to absorb data into a GHASH state.
+ *                          The lookups depend on the data, so this is only used on public data (the IV).
+ *
+ * \param   ptrTable        Pointer to the multiplication table of the hash key.
+ *
+ * \param   ptrState        Pointer to the 16 byte GHASH state.
+ *
+ * \param   ptrData         Pointer to the data.
+ *
+ * \param   dataLen         Length of the data in bytes.
+ *
+ */
+static void DTHE_AES_ghashUpdate(const DTHE_AES_GhashTable *ptrTable, uint8_t *ptrState, const uint8_t *ptrData, uint32_t dataLen)
+{
+    uint32_t    offset = 0U;
+    uint32_t    blockLen;
+    uint32_t    i;
+
+    while (offset < dataLen)
+    {
+        blockLen = dataLen - offset;
+        if (blockLen > 16U)
+        {
+            blockLen = 16U;
+        }
+        /* A partial last block is padded with zeros */
+        for (i = 0U; i < blockLen; i++)
+        {
+            ptrState[i] = ptrState[i] ^ ptrData[offset + i];
+        }
+        DTHE_AES_ghashMultiply(ptrTable, ptrState);
+        offset = offset + blockLen;
+    }
+    return;
+}
+
+/**
+ * \brief                   The function is used to load a context which is in progress into the AES engine,
+ *                          saving the context which currently uses it.
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers.
+ *
+ * \param   attrs           Pointer to the DTHE attributes.
+ *
+ * \param   ptrContext      Pointer to the AES context to be resumed.
+ *
+ * \return                  #DTHE_AES_RETURN_SUCCESS if the context is loaded.
+ *                          #DTHE_AES_RETURN_FAILURE if the engine could not be handed over.
+ */
+static DTHE_AES_Return_t DTHE_AES_resumeContext(CSL_AesRegs *ptrAesRegs, DTHE_Attrs *attrs, DTHE_AES_Context *ptrContext)
+{
+    DTHE_AES_Return_t status = DTHE_AES_RETURN_SUCCESS;
+
+    if (attrs->aesActiveCtx != (void *)ptrContext)
+    {
+        status = DTHE_AES_switchOutContext(ptrAesRegs, attrs, ptrContext);
+        if (status == DTHE_AES_RETURN_SUCCESS)
+        {
+            DTHE_AES_programContext(ptrAesRegs, ptrContext, &ptrContext->iv[0U]);
+            attrs->aesActiveCtx = (void *)ptrContext;
+        }
+    }
+
+    return (status);
+}
+
+/**
+ * \brief                   The function is used to check if the AAD of a combined mode is passed in its
+ *                          own buffer. For CCM the AAD can also be written by the caller ahead of the
+ *                          payload, with no AAD buffer; the engine then produces no output.
+ *
+ * \param   ptrParams       Pointer to the parameters of the operation.
+ *
+ * \return                  1 if the driver feeds the AAD from ptrAAD, 0 otherwise.
+ */
+static uint8_t DTHE_AES_hasSeparateAAD(const DTHE_AES_Params* ptrParams)
+{
+    uint8_t hasSeparateAAD = 0U;
+
+    if(((ptrParams->algoType == DTHE_AES_GCM_MODE)||(ptrParams->algoType == DTHE_AES_CCM_MODE))&&\
+       (ptrParams->aadLenght != 0U)&&(ptrParams->ptrAAD != NULL))
+    {
+        hasSeparateAAD = 1U;
+    }
+
+    return (hasSeparateAAD);
+}
+
+/**
+ * \brief                   The function is used to check if the operation produces output blocks.
+ *                          MAC only modes and CCM with caller written AAD do not.
+ *
+ * \param   ptrParams       Pointer to the parameters of the operation.
+ *
+ * \return                  1 if output blocks have to be read, 0 otherwise.
+ */
+static uint8_t DTHE_AES_isOutputRequired(const DTHE_AES_Params* ptrParams)
+{
+    uint8_t isOutputRequired = 0U;
+
+    if((ptrParams->algoType != DTHE_AES_CBC_MAC_MODE)&&(ptrParams->algoType != DTHE_AES_CMAC_MODE)&&\
+       ((ptrParams->aadLenght == 0U)||(ptrParams->algoType == DTHE_AES_GCM_MODE)||(ptrParams->ptrAAD != NULL)))
+    {
+        isOutputRequired = 1U;
+    }
+
+    return (isOutputRequired);
+}
+
+/**
+ * \brief                   The function is used to check the buffers of a stream update or finish before
+ *                          any of the chunk is read.
+ *
+ * \param   ptrParams       Pointer to the parameters of the operation.
+ *
+ * \param   ptrContext      Pointer to the context of the stream.
+ *
+ * \return                  #DTHE_AES_RETURN_SUCCESS if the buffers are valid, #DTHE_AES_RETURN_FAILURE otherwise.
+ */
+static DTHE_AES_Return_t DTHE_AES_checkStreamBuffers(const DTHE_AES_Params* ptrParams, const DTHE_AES_Context *ptrContext)
+{
+    DTHE_AES_Return_t   status = DTHE_AES_RETURN_SUCCESS;
+    const uint32_t      *ptrInput;
+    const uint32_t      *ptrOutput;
+
+    if (ptrParams->opType == DTHE_AES_ENCRYPT)
+    {
+        ptrInput  = ptrParams->ptrPlainTextData;
+        ptrOutput = ptrParams->ptrEncryptedData;
+    }
+    else
+    {
+        ptrInput  = ptrParams->ptrEncryptedData;
+        ptrOutput = ptrParams->ptrPlainTextData;
+    }
+
+    if ((ptrParams->streamSize != 0U) && (ptrInput == NULL))
+    {
+        status = DTHE_AES_RETURN_FAILURE;
+    }
+
+    /* A finish with an empty chunk still writes out the carried block */
+    if (((ptrParams->streamSize != 0U) || (ptrContext->carryLenBytes != 0U)) &&
+        (DTHE_AES_isOutputRequired(ptrParams) == 1U) && (ptrOutput == NULL))
+    {
+        status = DTHE_AES_RETURN_FAILURE;
+    }
+
+    return (status);
+}
+
+/**
+ * \brief                   The function is used to move full blocks from a linear input buffer through the
+ *                          AES engine into a linear output buffer, by DMA when it is enabled.
+ *
+ * \param   config          Pointer to the DTHE configuration.
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers.
+ *
+ * \param   isOutputRequired Flag which indicates if output blocks are read.
+ *
+ * \param   ptrInput        Pointer to the input blocks.
+ *
+ * \param   ptrOutput       Pointer to the output blocks.
+ *
+ * \param   numBlocks       Number of full blocks to be processed.
+ */
+static void DTHE_AES_processBlocks(const DTHE_Config *config, CSL_AesRegs *ptrAesRegs, uint8_t isOutputRequired,
+                                   uint32_t* ptrInput, uint32_t* ptrOutput, uint16_t numBlocks)
+{
+    DMA_Handle      dmaHandle = NULL;
+    uint32_t        index;
+
+    if ((config->dmaEnable == DMA_ENABLE) && (numBlocks > 0U))
+    {
+        dmaHandle = DMA_open(0);
+
+        DMA_Config_TxChannel(dmaHandle, ptrInput, (uint32_t *)&ptrAesRegs->DATA_IN_3, numBlocks, 0U, DMA_AES_ENABLE);
+
+        if (isOutputRequired == 1U)
+        {
+            DMA_Config_RxChannel(dmaHandle, (uint32_t *)&ptrAesRegs->DATA_IN_3, ptrOutput, numBlocks);
+        }
+
+        DTHE_AES_clearAllInterrupts(ptrAesRegs);
+
+        if (isOutputRequired == 1U)
+        {
+            DTHE_AES_setDMAOutputRequestStatus(ptrAesRegs, 1);
+            DMA_enableRxTransferRegion(dmaHandle);
+        }
+
+        DMA_enableTxTransferRegion(dmaHandle, DMA_AES_ENABLE);
+        DTHE_AES_setDMAInputRequestStatus(ptrAesRegs, 1);
+
+        if (isOutputRequired == 1U)
+        {
+            DMA_WaitForRxTransfer(dmaHandle);
+        }
+
+        DMA_WaitForTxTransfer(dmaHandle, DMA_AES_ENABLE);
+
+        DTHE_AES_setDMAInputRequestStatus(ptrAesRegs, 0);
+        if (isOutputRequired == 1U)
+        {
+            DTHE_AES_setDMAOutputRequestStatus(ptrAesRegs, 0);
+        }
+
+        DMA_disableTxCh(dmaHandle, DMA_AES_ENABLE);
+
+        if (isOutputRequired == 1U)
+        {
+            DMA_disableRxCh(dmaHandle);
+        }
+    }
+    else
+    {
+        /* Cycle through and write all the full blocks: */
+        for (index = 0U; index < numBlocks; index++)
+        {
+            /* Wait for the AES IP to be ready to receive the data: */
+            DTHE_AES_pollInputReady(ptrAesRegs);
+
+            /* Write the data: */
+            DTHE_AES_writeDataBlock(ptrAesRegs, &ptrInput[index << 2U]);
+
+            if (isOutputRequired == 1U)
+            {
+                /* Wait for the AES IP to be ready with the output data */
+                DTHE_AES_pollOutputReady(ptrAesRegs);
+
+                /* Read the decrypted data into the decrypted block: */
+                DTHE_AES_readDataBlock(ptrAesRegs, &ptrOutput[index << 2U]);
+            }
+        }
+    }
+
+    return;
+}
+
+/**
+ * \brief                   The function is used to move full blocks from an input buffer which is not word
+ *                          aligned through the AES engine. Every block is copied into an aligned bounce block
+ *                          and written by the CPU.
+ *
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers.
+ *
+ * \param   isOutputRequired Flag which indicates if output blocks are read.
+ *
+ * \param   ptrInput        Pointer to the input blocks.
+ *
+ * \param   ptrOutput       Pointer to the output blocks, word aligned.
+ *
+ * \param   numBlocks       Number of full blocks to be processed.
+ */
+static void DTHE_AES_processUnalignedBlocks(CSL_AesRegs *ptrAesRegs, uint8_t isOutputRequired,
+                                            const uint8_t* ptrInput, uint32_t* ptrOutput, uint32_t numBlocks)
+{
+    uint32_t        bounceBlock[DTHE_AES_BLOCK_SIZE_WORDS];
+    uint32_t        index;
+
+    for (index = 0U; index < numBlocks; index++)
+    {
+        (void)memcpy ((void *)&bounceBlock[0U], (const void *)&ptrInput[index * 16U], 16U);
+
+        DTHE_AES_pollInputReady(ptrAesRegs);
+        DTHE_AES_writeDataBlock(ptrAesRegs, &bounceBlock[0U]);
+
+        if (isOutputRequired == 1U)
+        {
+            DTHE_AES_pollOutputReady(ptrAesRegs);
+            DTHE_AES_readDataBlock(ptrAesRegs, &ptrOutput[index << 2U]);
+        }
+    }
+
+    (void)memset ((void *)&bounceBlock[0U], 0, sizeof(bounceBlock));
+
     return;
 }
 
 /**
- * \brief                   The function is used to set the key size
+ * \brief                   The function is used to stream full blocks from an input segment list through the
+ *                          AES engine into an output segment list. With DMA the lists are moved as one linked
+ *                          transfer and only blocks straddling two segments go through bounce blocks. If a
+ *                          list does not fit in #DMA_MAX_SG_ENTRIES entries the blocks are moved by the CPU.
  *
- * \param   ptrAesRegs      Pointer to the EIP38T AES Registers
+ * \param   config          Pointer to the DTHE configuration.
  *
- * \param   size            Size of the key to be configured.
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers.
+ *
+ * \param   isOutputRequired Flag which indicates if output blocks are read.
+ *
+ * \param   ptrInSegments   Pointer to the input segment list.
+ *
+ * \param   numInSegments   Number of input segments.
  *
+ * \param   ptrOutSegments  Pointer to the output segment list.
+ *
+ * \param   numOutSegments  Number of output segments.
+ *
+ * \param   numBlocks       Number of full blocks to be processed.
  */
-static void DTHE_AES_setKeySize(CSL_AesRegs *ptrAesRegs, uint8_t size)
+static void DTHE_AES_processBlocksSG(const DTHE_Config *config, CSL_AesRegs *ptrAesRegs, uint8_t isOutputRequired,
+                                     const DTHE_Segment* ptrInSegments, uint32_t numInSegments,
+                                     const DTHE_Segment* ptrOutSegments, uint32_t numOutSegments, uint32_t numBlocks)
 {
-    uint8_t keySize;
-
-    if (size == CSL_AES_S_CTRL_KEY_SIZE_KEY128)
+    DMA_Handle      dmaHandle = NULL;
+    DTHE_DmaList    inList;
+    DTHE_DmaList    outList;
+    uint8_t         useDma = 0U;
+    uint32_t        index;
+    uint32_t        inBlock[DTHE_AES_BLOCK_SIZE_WORDS];
+    uint32_t        outBlock[DTHE_AES_BLOCK_SIZE_WORDS];
+
+    if (config->dmaEnable == DMA_ENABLE)
     {
-        keySize = 1U;
+        useDma = 1U;
+        if (DTHE_buildDmaList(ptrInSegments, numInSegments, 16U, numBlocks,
+                              (uint8_t *)&gDtheAesSgInBounce[0U], TRUE, &inList) != DTHE_RETURN_SUCCESS)
+        {
+            useDma = 0U;
+        }
+        if ((useDma == 1U) && (isOutputRequired == 1U))
+        {
+            if (DTHE_buildDmaList(ptrOutSegments, numOutSegments, 16U, numBlocks,
+                                  (uint8_t *)&gDtheAesSgOutBounce[0U], FALSE, &outList) != DTHE_RETURN_SUCCESS)
+            {
+                useDma = 0U;
+            }
+        }
     }
-    else if (size == CSL_AES_S_CTRL_KEY_SIZE_KEY192)
+
+    if (useDma == 1U)
     {
-        keySize = 2U;
+        /* The bounce blocks are driver memory: keep them coherent with the DMA */
+        CacheP_wb((void *)&gDtheAesSgInBounce[0U], sizeof(gDtheAesSgInBounce), CacheP_TYPE_ALLD);
+        if (isOutputRequired == 1U)
+        {
+            CacheP_wbInv((void *)&gDtheAesSgOutBounce[0U], sizeof(gDtheAesSgOutBounce), CacheP_TYPE_ALLD);
+        }
+
+        dmaHandle = DMA_open(0);
+
+        if (DMA_Config_TxSgChannel(dmaHandle, &inList.entries[0U], inList.numEntries,
+                                   (uint32_t *)&ptrAesRegs->DATA_IN_3, 0U, DMA_AES_ENABLE) != DMA_RETURN_SUCCESS)
+        {
+            useDma = 0U;
+        }
+
+        if ((useDma == 1U) && (isOutputRequired == 1U))
+        {
+            if (DMA_Config_RxSgChannel(dmaHandle, (uint32_t *)&ptrAesRegs->DATA_IN_3,
+                                       &outList.entries[0U], outList.numEntries) != DMA_RETURN_SUCCESS)
+            {
+                useDma = 0U;
+            }
+        }
+
+        if (useDma == 0U)
+        {
+            /* No link PaRAM set left for the list: release the ones taken and move the blocks with the CPU */
+            DMA_disableTxCh(dmaHandle, DMA_AES_ENABLE);
+            if (isOutputRequired == 1U)
+            {
+                DMA_disableRxCh(dmaHandle);
+            }
+        }
     }
-    else if (size == CSL_AES_S_CTRL_KEY_SIZE_KEY256)
+
+    if (useDma == 1U)
     {
-        keySize = 3U;
+        DTHE_AES_clearAllInterrupts(ptrAesRegs);
+
+        if (isOutputRequired == 1U)
+        {
+            DTHE_AES_setDMAOutputRequestStatus(ptrAesRegs, 1);
+            DMA_enableRxTransferRegion(dmaHandle);
+        }
+
+        DMA_enableTxTransferRegion(dmaHandle, DMA_AES_ENABLE);
+        DTHE_AES_setDMAInputRequestStatus(ptrAesRegs, 1);
+
+        if (isOutputRequired == 1U)
+        {
+            DMA_WaitForRxTransfer(dmaHandle);
+        }
+
+        DMA_WaitForTxTransfer(dmaHandle, DMA_AES_ENABLE);
+
+        DTHE_AES_setDMAInputRequestStatus(ptrAesRegs, 0);
+        if (isOutputRequired == 1U)
+        {
+            DTHE_AES_setDMAOutputRequestStatus(ptrAesRegs, 0);
+        }
+
+        DMA_disableTxCh(dmaHandle, DMA_AES_ENABLE);
+
+        if (isOutputRequired == 1U)
+        {
+            DMA_disableRxCh(dmaHandle);
+
+            /* Copy out the blocks which straddle two output segments */
+            CacheP_inv((void *)&gDtheAesSgOutBounce[0U], sizeof(gDtheAesSgOutBounce), CacheP_TYPE_ALLD);
+            for (index = 0U; index < outList.numBounce; index++)
+            {
+                DTHE_scatterSegments(ptrOutSegments, numOutSegments, outList.bounceOffset[index],
+                                     (const uint8_t *)&gDtheAesSgOutBounce[index * DTHE_AES_BLOCK_SIZE_WORDS], 16U);
+            }
+        }
     }
     else
     {
-        keySize = 0U;
+        for (index = 0U; index < numBlocks; index++)
+        {
+            DTHE_gatherSegments(ptrInSegments, numInSegments, index * 16U, (uint8_t *)&inBlock[0U], 16U);
+
+            /* Wait for the AES IP to be ready to receive the data: */
+            DTHE_AES_pollInputReady(ptrAesRegs);
+            DTHE_AES_writeDataBlock(ptrAesRegs, &inBlock[0U]);
+
+            if (isOutputRequired == 1U)
+            {
+                /* Wait for the AES IP to be ready with the output data */
+                DTHE_AES_pollOutputReady(ptrAesRegs);
+                DTHE_AES_readDataBlock(ptrAesRegs, &outBlock[0U]);
+                DTHE_scatterSegments(ptrOutSegments, numOutSegments, index * 16U, (const uint8_t *)&outBlock[0U], 16U);
+            }
+        }
     }
-    CSL_REG32_FINS(&ptrAesRegs->CTRL,AES_S_CTRL_KEY_SIZE, keySize);
 
     return;
 }
 
 /**
- * \brief                   The function is used to configure the key in the AES module This will only configure the 256bit keys.
+ * \brief                   The function is used to start the stream which carries a one-shot, update or finish
+ *                          operation whose data is fed outside of #DTHE_AES_process. A one-shot is set up as
+ *                          a stream of its own; an update or finish loads its context back into the engine.
  *
- * \param   ptrAesRegs      Pointer to the EIP38T AES Registers
+ * \param   handle          #DTHE_Handle returned from #DTHE_open().
  *
- * \param   ptrKey          Pointer to the 256bit key to be used.
+ * \param   ptrParams       Pointer to the parameters of the operation.
  *
- */
-static void DTHE_AES_set256BitKey1(CSL_AesRegs *ptrAesRegs, const uint32_t* ptrKey)
-{
-    ptrAesRegs->KEY1_0 = ptrKey[0U];
-    ptrAesRegs->KEY1_1 = ptrKey[1U];
-    ptrAesRegs->KEY1_2 = ptrKey[2U];
-    ptrAesRegs->KEY1_3 = ptrKey[3U];
-    ptrAesRegs->KEY1_4 = ptrKey[4U];
-    ptrAesRegs->KEY1_5 = ptrKey[5U];
-    ptrAesRegs->KEY1_6 = ptrKey[6U];
-    ptrAesRegs->KEY1_7 = ptrKey[7U];
-
-    return;
-}
-
-/**
- * \brief                   The function is used to configure the key in the AES module This will only configure the 128bit keys.
+ * \param   totalLen        Length of the data of the operation in bytes.
  *
- * \param   ptrAesRegs      Pointer to the EIP38T AES Registers
+ * \param   ptrOneShotContext Initialized context used by a one-shot without a context of its own.
  *
- * \param   ptrKey          Pointer to the 128bit key to be used.
+ * \param   ptrStreamParams Parameters to be used to finish the stream.
+ *
+ * \param   ptrPtrContext   Context of the stream.
  *
+ * \return                  #DTHE_AES_RETURN_SUCCESS if the stream is ready for the data.
+ *                          #DTHE_AES_RETURN_FAILURE otherwise.
  */
-static void DTHE_AES_set128BitKey2Part1(CSL_AesRegs *ptrAesRegs, const uint32_t* ptrKey)
+static DTHE_AES_Return_t DTHE_AES_startStream(DTHE_Handle handle, const DTHE_AES_Params* ptrParams, uint32_t totalLen,
+                                              DTHE_AES_Context *ptrOneShotContext, DTHE_AES_Params* ptrStreamParams,
+                                              DTHE_AES_Context **ptrPtrContext)
 {
-    ptrAesRegs->KEY2_0 = ptrKey[0U];
-    ptrAesRegs->KEY2_1 = ptrKey[1U];
-    ptrAesRegs->KEY2_2 = ptrKey[2U];
-    ptrAesRegs->KEY2_3 = ptrKey[3U];
+    DTHE_AES_Return_t   status = DTHE_AES_RETURN_SUCCESS;
+    DTHE_Config         *config = (DTHE_Config *) handle;
+    CSL_AesRegs         *ptrAesRegs = (CSL_AesRegs *)config->attrs->aesBaseAddr;
+    DTHE_AES_Context    *ptrContext = NULL;
 
-    return;
+    *ptrStreamParams = *ptrParams;
+
+    if (ptrParams->streamState == DTHE_AES_ONE_SHOT_SUPPORT)
+    {
+        /* One-shot is run as a stream on its own context */
+        if (ptrStreamParams->ptrContext == NULL)
+        {
+            ptrStreamParams->ptrContext = ptrOneShotContext;
+        }
+        ptrContext                     = ptrStreamParams->ptrContext;
+        ptrStreamParams->streamState   = DTHE_AES_STREAM_INIT;
+        ptrStreamParams->dataLenBytes  = totalLen;
+        status = DTHE_AES_process(handle, ptrStreamParams);
+    }
+    else if ((ptrParams->streamState == DTHE_AES_STREAM_UPDATE) || (ptrParams->streamState == DTHE_AES_STREAM_FINISH))
+    {
+        if (ptrStreamParams->ptrContext == NULL)
+        {
+            ptrStreamParams->ptrContext = &gDtheAesDefaultContext;
+        }
+        ptrContext = ptrStreamParams->ptrContext;
+
+        /* Carried bytes are only consumed by DTHE_AES_execute */
+        if ((ptrContext->state != AES_STATE_IN_PROGRESS) || (ptrContext->carryLenBytes != 0U) ||
+            ((ptrParams->streamState == DTHE_AES_STREAM_UPDATE) && ((totalLen % 16U) != 0U)))
+        {
+            status = DTHE_AES_RETURN_FAILURE;
+        }
+        else
+        {
+            status = DTHE_AES_resumeContext(ptrAesRegs, config->attrs, ptrContext);
+        }
+
+        /* The length of the last chunk is the length of the whole finish call */
+        if ((status == DTHE_AES_RETURN_SUCCESS) && (ptrParams->streamState == DTHE_AES_STREAM_FINISH) &&
+            (ptrParams->dataLenBytes == 0U) && (ptrParams->algoType != DTHE_AES_GCM_MODE))
+        {
+            DTHE_AES_setDataLengthBytes(ptrAesRegs, totalLen);
+            ptrStreamParams->dataLenBytes = totalLen;
+        }
+    }
+    else
+    {
+        status = DTHE_AES_RETURN_FAILURE;
+    }
+
+    *ptrPtrContext = ptrContext;
+
+    return (status);
 }
 
 /**
- * \brief                   The function is used to configure the key in the AES module This will only configure the 128bit keys.
+ * \brief                   The function is used to finish a stream started by #DTHE_AES_startStream once all
+ *                          its full blocks went through the engine: the partial last block and the tag are
+ *                          handled by the regular finish path.
  *
- * \param   ptrAesRegs      Pointer to the EIP38T AES Registers
+ * \param   handle          #DTHE_Handle returned from #DTHE_open().
  *
- * \param   ptrKey          Pointer to the 128bit key to be used.
+ * \param   ptrStreamParams Parameters returned by #DTHE_AES_startStream.
  *
+ * \param   ptrTailIn       Input data of the partial last block.
+ *
+ * \param   ptrTailOut      Output data of the partial last block.
+ *
+ * \param   tailLen         Length of the partial last block in bytes.
+ *
+ * \return                  #DTHE_AES_RETURN_SUCCESS if the stream is finished.
+ *                          #DTHE_AES_RETURN_FAILURE otherwise.
  */
-static void DTHE_AES_set128BitKey2Part2(CSL_AesRegs *ptrAesRegs, const uint32_t* ptrKey)
+static DTHE_AES_Return_t DTHE_AES_finishStream(DTHE_Handle handle, DTHE_AES_Params* ptrStreamParams,
+                                               uint32_t* ptrTailIn, uint32_t* ptrTailOut, uint32_t tailLen)
 {
-    ptrAesRegs->KEY2_4 = ptrKey[0U];
-    ptrAesRegs->KEY2_5 = ptrKey[1U];
-    ptrAesRegs->KEY2_6 = ptrKey[2U];
-    ptrAesRegs->KEY2_7 = ptrKey[3U];
+    ptrStreamParams->streamState = DTHE_AES_STREAM_FINISH;
+    ptrStreamParams->streamSize  = tailLen;
+    if (ptrStreamParams->opType == DTHE_AES_ENCRYPT)
+    {
+        ptrStreamParams->ptrPlainTextData = ptrTailIn;
+        ptrStreamParams->ptrEncryptedData = ptrTailOut;
+    }
+    else
+    {
+        ptrStreamParams->ptrEncryptedData = ptrTailIn;
+        ptrStreamParams->ptrPlainTextData = ptrTailOut;
+    }
 
-    return;
+    return (DTHE_AES_process(handle, ptrStreamParams));
 }
 
 /**
- * \brief                   The function is used to set the Initialization Vector (IV) in the AES module.
+ * \brief                   The function is used to release the engine after a failed one-shot, so that the
+ *                          context is not left loaded in the engine.
  *
- * \param   ptrAesRegs      Pointer to the EIP38T AES Registers.
+ * \param   attrs           Pointer to the DTHE attributes.
  *
- * \param   ptrIV           Pointer to the IV data to be used.
+ * \param   streamState     Stream state of the operation as passed by the application.
  *
+ * \param   ptrContext      Context of the operation.
  */
-static void DTHE_AES_clearIV(CSL_AesRegs *ptrAesRegs)
+static void DTHE_AES_abortOneShot(DTHE_Attrs *attrs, uint32_t streamState, DTHE_AES_Context *ptrContext)
 {
-    ptrAesRegs->IV_IN_0 = 0U;
-    ptrAesRegs->IV_IN_1 = 0U;
-    ptrAesRegs->IV_IN_2 = 0U;
-    ptrAesRegs->IV_IN_3 = 0U;
+    if ((streamState == DTHE_AES_ONE_SHOT_SUPPORT) && (ptrContext != NULL) && (ptrContext->state != AES_STATE_NEW))
+    {
+        ptrContext->state   = AES_STATE_NEW;
+        attrs->aesActiveCtx = NULL;
+    }
 
     return;
 }
 
 /**
- * \brief                   The function is used to clear the Initialization Vector (IV) in the AES module.
- *
- * \param   ptrAesRegs      Pointer to the EIP38T AES Registers.
+ * \brief                   The function is used to finish the last job once its DMA is done and to release
+ *                          its DMA channels. Neither is done from the completion interrupt itself, the
+ *                          function is called from task context.
  *
+ * \return                  #DTHE_AES_RETURN_SUCCESS if no job is running.
+ *                          #DTHE_AES_RETURN_FAILURE if a job still owns the engine.
  */
-static void DTHE_AES_setIV(CSL_AesRegs *ptrAesRegs, const uint32_t* ptrIV)
+static DTHE_AES_Return_t DTHE_AES_reapJob(void)
 {
-    /* Clear the IV value in registers */
-    DTHE_AES_clearIV(ptrAesRegs);
+    DTHE_AES_Return_t   status = DTHE_AES_RETURN_SUCCESS;
+    DTHE_AES_Job        *ptrJob = &gDtheAesJob;
 
-    ptrAesRegs->IV_IN_0 = ptrIV[0U];
-    ptrAesRegs->IV_IN_1 = ptrIV[1U];
-    ptrAesRegs->IV_IN_2 = ptrIV[2U];
-    ptrAesRegs->IV_IN_3 = ptrIV[3U];
+    if (ptrJob->state == DTHE_AES_JOB_STATE_DMA_DONE)
+    {
+        DTHE_AES_finishJob(ptrJob);
+    }
 
-    return;
+    if (ptrJob->state == DTHE_AES_JOB_STATE_RUNNING)
+    {
+        status = DTHE_AES_RETURN_FAILURE;
+    }
+    else if (ptrJob->dmaHandle != NULL)
+    {
+        DMA_disableTxCh(ptrJob->dmaHandle, DMA_AES_ENABLE);
+        if (ptrJob->isOutputRequired == 1U)
+        {
+            DMA_disableRxCh(ptrJob->dmaHandle);
+        }
+        ptrJob->dmaHandle = NULL;
+    }
+    else
+    {
+        /* Nothing to release */
+    }
+
+    return (status);
 }
 
 /**
- * \brief                   The function is used to poll until the AES IP block is ready to receive data.
- *
- * \param   ptrAesRegs      Pointer to the EIP38T AES Registers
+ * \brief                   DMA completion callback of a job, called from the EDMA interrupt once all full
+ *                          blocks went through the engine. The engine is not polled here: the job is only
+ *                          marked and the waiter and the callback are told that it can be finished.
  *
+ * \param   args            Pointer to the job.
  */
-static void DTHE_AES_pollInputReady(CSL_AesRegs *ptrAesRegs)
+static void DTHE_AES_jobDmaComplete(void *args)
 {
-    uint8_t     done = 0U;
+    DTHE_AES_Job    *ptrJob = (DTHE_AES_Job *)args;
+    DTHE_Config     *config = (DTHE_Config *)ptrJob->handle;
+    CSL_AesRegs     *ptrAesRegs = (CSL_AesRegs *)config->attrs->aesBaseAddr;
 
-    /* Loop around till the condition is met: */
-    while (done == 0U)
+    DTHE_AES_setDMAInputRequestStatus(ptrAesRegs, 0);
+    if (ptrJob->isOutputRequired == 1U)
     {
-        done = CSL_REG32_FEXT(&ptrAesRegs->CTRL, AES_S_CTRL_INPUT_READY);
+        DTHE_AES_setDMAOutputRequestStatus(ptrAesRegs, 0);
     }
-    return;
-}
 
-/**
- * \brief                   The function is used to write the data and pass this to the AES engine.
- *
- * \param   ptrAesRegs      Pointer to the EIP38T AES Registers.
- *
- * \param   ptrData         Pointer to the data to be written.
- *
- */
-static void DTHE_AES_writeDataBlock(CSL_AesRegs *ptrAesRegs, const uint32_t* ptrData)
-{
-    ptrAesRegs->DATA_IN_3 = ptrData[0U];
-    ptrAesRegs->DATA_IN_2 = ptrData[1U];
-    ptrAesRegs->DATA_IN_1 = ptrData[2U];
-    ptrAesRegs->DATA_IN_0 = ptrData[3U];
+    ptrJob->ptrContext->processedBytes = ptrJob->ptrContext->processedBytes + (ptrJob->numBlocks * 16U);
+
+    ptrJob->state = DTHE_AES_JOB_STATE_DMA_DONE;
+    (void)SemaphoreP_post(&ptrJob->doneSem);
+
+    if (ptrJob->callback != NULL)
+    {
+        ptrJob->callback(ptrJob->handle, ptrJob->token, DTHE_AES_RETURN_SUCCESS, ptrJob->args);
+    }
 
     return;
 }
 
 /**
- * \brief                   The function is used to poll until the AES IP block has available data which can be read out.
- *
- * \param   ptrAesRegs      Pointer to the EIP38T AES Registers
+ * \brief                   The function is used to finish a job once its full blocks are processed: the
+ *                          partial last block and the tag are handled by the CPU, from task context.
  *
+ * \param   ptrJob          Pointer to the job.
  */
-static void DTHE_AES_pollOutputReady(CSL_AesRegs *ptrAesRegs)
+static void DTHE_AES_finishJob(DTHE_AES_Job *ptrJob)
 {
-    uint8_t     done = 0U;
+    DTHE_AES_Return_t   status = DTHE_AES_RETURN_SUCCESS;
+    DTHE_Config         *config = (DTHE_Config *)ptrJob->handle;
 
-    /* Loop around till the condition is met: */
-    while (done == 0U)
+    if (ptrJob->streamState != DTHE_AES_STREAM_UPDATE)
     {
-        done = CSL_REG32_FEXT(&ptrAesRegs->CTRL, AES_S_CTRL_OUTPUT_READY);
+        status = DTHE_AES_finishStream(ptrJob->handle, &ptrJob->params, ptrJob->ptrTailIn, ptrJob->ptrTailOut, ptrJob->tailLen);
+    }
+
+    if (status != DTHE_AES_RETURN_SUCCESS)
+    {
+        DTHE_AES_abortOneShot(config->attrs, ptrJob->streamState, ptrJob->ptrContext);
     }
+
+    ptrJob->status = status;
+    ptrJob->state  = DTHE_AES_JOB_STATE_DONE;
+
     return;
 }
 
 /**
- * \brief                   The function is used to poll until the AES IP block has available context out register
+ * \brief                   The function is used to poll until the AES engine accepts a new context.
  *
  * \param   ptrAesRegs      Pointer to the EIP38T AES Registers
  *
  */
-static void DTHE_AES_pollContextReady(CSL_AesRegs *ptrAesRegs)
+static void DTHE_AES_pollNewContextReady(CSL_AesRegs *ptrAesRegs)
 {
     uint8_t     done = 0U;
 
     /* Loop around till the condition is met: */
     while (done == 0U)
     {
-        done = CSL_REG32_FEXT(&ptrAesRegs->CTRL, AES_S_CTRL_SAVE_CONTEXT_READY);
+        done = CSL_REG32_FEXT(&ptrAesRegs->CTRL, AES_S_CTRL_CONTEXT_READY);
     }
     return;
 }
 
 /**
- * \brief                   The function is used to read the data from the AES engine
+ * \brief                   The function is used to start a new XTS data unit. The tweak value i is loaded
+ *                          and the engine encrypts it with key2 for the first block (j = 0).
  *
- * \param   ptrAesRegs      Pointer to the EIP38T AES Registers
+ * \param   ptrAesRegs      Pointer to the EIP38T AES Registers.
  *
- * \param   ptrData         Pointer to the data buffer populated by the API
+ * \param   ptrTweak        Pointer to the 128-bit tweak value i.
  *
  */
-static void DTHE_AES_readDataBlock(CSL_AesRegs *ptrAesRegs, uint32_t* ptrData)
-{
-    ptrData[0] = ptrAesRegs->DATA_IN_3;
-    ptrData[1] = ptrAesRegs->DATA_IN_2;
-    ptrData[2] = ptrAesRegs->DATA_IN_1;
-    ptrData[3] = ptrAesRegs->DATA_IN_0;
-
-    return;
-}
-
-static void DTHE_AES_readTag(CSL_AesRegs *ptrAesRegs, uint32_t* ptrTag)
+static void DTHE_AES_loadXtsTweak(CSL_AesRegs *ptrAesRegs, const uint32_t* ptrTweak)
 {
-    ptrTag[0] = ptrAesRegs->TAG_OUT_0;
-    ptrTag[1] = ptrAesRegs->TAG_OUT_1;
-    ptrTag[2] = ptrAesRegs->TAG_OUT_2;
-    ptrTag[3] = ptrAesRegs->TAG_OUT_3;
+    DTHE_AES_setIV(ptrAesRegs, ptrTweak);
+    CSL_REG32_FINS(&ptrAesRegs->CTRL, AES_S_CTRL_XTS, CSL_AES_S_CTRL_XTS_XTS11);
 
     return;
 }
@@ -52,6 +52,7 @@
 /*                             Include Files                                  */
 /* ========================================================================== */
 #include <stdint.h>
+#include <string.h>
 #include <security_common/drivers/crypto/dthe/dthe.h>
 #include <kernel/dpl/SystemP.h>
 #include <drivers/hw_include/cslr.h>
@@ -86,6 +87,8 @@ extern "C" {
 #define DTHE_AES_CMAC_MODE                                  (0x00000100U)
 /** \brief Flag for AES CCM Mode */
 #define DTHE_AES_CCM_MODE                                   (0x00000120U)
+/** \brief Flag for AES GCM Mode */
+#define DTHE_AES_GCM_MODE                                   (0x00000200U)
 
 /** \brief Size of AES key is of 128-bit */
 #define DTHE_AES_KEY_128_SIZE                               (0x00000001U)
@@ -121,6 +124,15 @@ extern "C" {
 
 
 
+/** \brief Size of the AES block in words */
+#define DTHE_AES_BLOCK_SIZE_WORDS                           (4U)
+
+/** \brief Size of the AES tag in bytes */
+#define DTHE_AES_TAG_SIZE_BYTES                             (16U)
+
+/** \brief GCM IV length for which the IV is used directly as the pre-counter block */
+#define DTHE_AES_GCM_IV_96BIT_SIZE_BYTES                    (12U)
+
 /* ========================================================================== */
 /*                         Structure Declarations                             */
 /* ========================================================================== */
@@ -137,8 +149,122 @@ typedef enum DTHE_AES_Return_e
 {
     DTHE_AES_RETURN_SUCCESS                  = 0x62E699D9U, /*!< Success/pass return code */
     DTHE_AES_RETURN_FAILURE                  = 0x904D041AU, /*!< General or unspecified failure/error */
+    DTHE_AES_RETURN_TIMEOUT                  = 0xC4B27E85U, /*!< Job still running when the wait timed out */
 }DTHE_AES_Return_t;
 
+/**
+ * \brief One message of a CMAC batch, see #DTHE_AES_cmacBatch.
+ */
+typedef struct DTHE_AES_CmacMessage_t
+{
+    /**< Pointer to the message */
+    uint32_t*           ptrData;
+
+    /**< Length of the message in bytes, cannot be zero */
+    uint32_t            dataLenBytes;
+
+    /**< Pointer to the tag: written by #DTHE_AES_cmacBatch, compared by #DTHE_AES_cmacBatchVerify */
+    uint32_t*           ptrTag;
+
+    /**< Length of the tag in bytes, up to 16 for truncated MACs. 0 is taken as 16 */
+    uint32_t            tagLenBytes;
+
+    /**< Result for this message, populated by the driver */
+    DTHE_AES_Return_t   status;
+}DTHE_AES_CmacMessage;
+
+/**
+ * \brief               Completion callback of an asynchronous AES job. It is called from the DMA
+ *                      interrupt once the full blocks are moved; the job is then finished, and its
+ *                      result returned, by #DTHE_AES_wait from task context. When the job has less
+ *                      than one block of data it is called from #DTHE_AES_submit with the result.
+ *
+ * \param  handle       #DTHE_Handle the job was submitted on.
+ *
+ * \param  token        Token returned by #DTHE_AES_submit.
+ *
+ * \param  status       #DTHE_AES_RETURN_SUCCESS from the DMA interrupt, the result of the job otherwise.
+ *
+ * \param  args         Argument passed to #DTHE_AES_submit.
+ */
+typedef void (*DTHE_AES_JobCallback)(DTHE_Handle handle, DTHE_JobToken token, DTHE_AES_Return_t status, void *args);
+
+/**
+ * \brief AES Context
+ *  This structure holds the state of one AES operation. Each stream
+ *  (DTHE_AES_STREAM_INIT/UPDATE/FINISH) owns one context, so several streams
+ *  can be open at the same time and time-share the engine. When the engine is
+ *  handed over to another context the running IV/counter (which for CBC-MAC and
+ *  CMAC is the partial MAC) is saved here and loaded back on the next
+ *  DTHE_AES_STREAM_UPDATE or DTHE_AES_STREAM_FINISH call. The MAC state of the
+ *  combined modes (CCM, GCM) cannot be saved, so an open CCM or GCM stream
+ *  holds the engine until it is finished.
+ *
+ *  The context only keeps a reference to the key: the key buffers passed at
+ *  DTHE_AES_STREAM_INIT must stay valid until DTHE_AES_STREAM_FINISH.
+ *
+ *  The context is owned by the caller and must be initialized with
+ *  #DTHE_AES_Context_init before its first use. All fields are internal to
+ *  the driver.
+ */
+typedef struct DTHE_AES_Context_t
+{
+    /**< State of the context, internal to the driver */
+    uint32_t            state;
+
+    /**< Algorithm programmed for this context */
+    uint32_t            algoType;
+
+    /**< Operation programmed for this context */
+    uint32_t            opType;
+
+    /**< KEK mode flag programmed for this context */
+    Bool                useKEKMode;
+
+    /**< Reference to the key */
+    const uint32_t*     ptrKey;
+
+    /**< Reference to the CMAC subkey K1 */
+    const uint32_t*     ptrKey1;
+
+    /**< Reference to the CMAC subkey K2 */
+    const uint32_t*     ptrKey2;
+
+    /**< Length of the key */
+    uint8_t             keyLen;
+
+    /**< Width of Counter in bits */
+    uint32_t            counterWidth;
+
+    /**< CCM L value */
+    uint32_t            ccmL;
+
+    /**< CCM M value */
+    uint32_t            ccmM;
+
+    /**< AAD length */
+    uint32_t            aadLength;
+
+    /**< Total data length passed at init, zero if not known upfront */
+    uint32_t            dataLenBytes;
+
+    /**< 1 if dataLenBytes is the real length, also when it is zero for a one-shot operation */
+    uint32_t            isLengthKnown;
+
+    /**< Number of bytes processed so far */
+    uint32_t            processedBytes;
+
+    /**< Saved IV/counter, or the partial MAC for CBC-MAC and CMAC */
+    uint32_t            iv[DTHE_AES_BLOCK_SIZE_WORDS];
+
+    /**< Input bytes of a DTHE_AES_STREAM_UPDATE which did not fill a block yet, or the last full block
+     *   of a CBC-MAC or CMAC update, which is only written once it is known not to be the last one */
+    uint32_t            carry[DTHE_AES_BLOCK_SIZE_WORDS];
+
+    /**< Number of valid bytes in the carry block */
+    uint32_t            carryLenBytes;
+}DTHE_AES_Context;
+
 /**
  * \brief AES Driver Parameters
  *  This structure has all the parameters which are need by the AES Driver
@@ -161,6 +287,11 @@ typedef enum DTHE_AES_Return_e
 * | streamState       |                           |           *          |            *           |             *          |
 * | streamSize        |                           |                      |            *           |             *          |
 * | ptrTag            |                           |                      |                        |             *          |
+* | ptrContext        |              *            |           *          |            *           |             *          |
+* | ptrAAD            |              *            |           *          |                        |                        |
+* | aadLenght         |              *            |           *          |                        |                        |
+* | ivLenBytes        |              *            |           *          |                        |                        |
+* | tagLenBytes       |              *            |                      |                        |             *          |
  *
  */
 typedef struct DTHE_AES_Params_t
@@ -189,7 +320,7 @@ typedef struct DTHE_AES_Params_t
     uint32_t*           ptrKey1;
 
     /**
-     *< To be used only for CMAC
+     *< To be used for CMAC. For XTS this is the tweak key, of the same length as 'ptrKey'.
      */
     uint32_t*           ptrKey2;
 
@@ -199,7 +330,9 @@ typedef struct DTHE_AES_Params_t
     uint8_t             keyLen;
 
     /**
-     *<   Pointer to the Initialization Vector to be used.
+     *<   Pointer to the Initialization Vector to be used. For GCM its length is given by 'ivLenBytes'.
+     *    For XTS this is the 128-bit tweak value i of the data unit, which the engine encrypts with 'ptrKey2'.
+     *    XTS data lengths must be a multiple of 16 Bytes, ciphertext stealing is not supported.
      */
     uint32_t*           ptrIV;
 
@@ -207,6 +340,8 @@ typedef struct DTHE_AES_Params_t
      *<   Size of the data in bytes. This value cannot be equal to zero.
      *    For MAC algorithms, which support dataLength as zero bytes, the handling is done outside the driver scope.
      *
+     *    For GCM this is the total payload length and must also be set at DTHE_AES_STREAM_INIT, since the engine
+     *    needs it before the first block. Zero is allowed for GCM when AAD is present (GMAC).
      */
     uint32_t            dataLenBytes;
 
@@ -255,14 +390,20 @@ typedef struct DTHE_AES_Params_t
      *
      * - This field is not populated in case of streamState==DTHE_AES_ONE_SHOT_SUPPORT and streamState==DTHE_AES_STREAM_INIT and can be set as 0
      *
-     * - In case of streamState == DTHE_AES_STREAM_UPDATE, the streamSize must be aligned to 16 Bytes.
+     * - In case of streamState == DTHE_AES_STREAM_UPDATE, the streamSize can be of any length. Bytes short of a
+     *   block are kept in the context and completed by the next call. The output buffer receives the blocks
+     *   completed by the call, i.e. 16 * ((carried bytes + streamSize) / 16) bytes, from its start. Only
+     *   #DTHE_AES_execute carries bytes, #DTHE_AES_executeSG and #DTHE_AES_submit need 16 Byte aligned updates.
+     *   For CBC-MAC and CMAC #DTHE_AES_execute also keeps the last full block of an update until the next call.
      *
      * - In case of streamState == DTHE_AES_STREAM_FINISH, the streamSize does not have to be aligned to 16 Bytes.
      */
     uint32_t            streamSize;
 
     /**
-     *<   pointer of AAD
+     *<   pointer of AAD. For GCM and CCM the AAD is processed at DTHE_AES_ONE_SHOT_SUPPORT or DTHE_AES_STREAM_INIT.
+     *    For one-shot the AAD and the payload are moved in one DMA transfer, and CCM without payload is allowed.
+     *    For CCM it can be NULL, the caller then writes the AAD ahead of the payload and no output is produced.
      */
     uint32_t*           ptrAAD;
 
@@ -280,6 +421,35 @@ typedef struct DTHE_AES_Params_t
      *<  CCMM value
      */
     uint32_t           ccmM;
+
+    /**
+     *<   Pointer to the AES context which holds the state of the operation.
+     *
+     * - The same context must be passed for DTHE_AES_STREAM_INIT, DTHE_AES_STREAM_UPDATE and DTHE_AES_STREAM_FINISH.
+     *
+     * - If this is NULL, one-shot operations use a temporary context and streaming operations use the
+     *   default context of the driver, which allows only one such stream at a time.
+     */
+    DTHE_AES_Context*  ptrContext;
+
+    /**
+     *<   Length of the IV in bytes. Only used for GCM.
+     *
+     * - #DTHE_AES_GCM_IV_96BIT_SIZE_BYTES: the IV is used directly as the pre-counter block.
+     *
+     * - Any other non-zero length: the pre-counter block is derived from the IV with GHASH.
+     */
+    uint32_t           ivLenBytes;
+
+    /**
+     *<   Length of the tag in bytes, up to #DTHE_AES_TAG_SIZE_BYTES. Only used for GCM, zero selects the full tag.
+     *
+     * - Encryption: 'ptrTag' is an output parameter and receives the computed tag.
+     *
+     * - Decryption: 'ptrTag' is an input parameter holding the received tag. The computed tag is compared
+     *   with it and #DTHE_AES_RETURN_FAILURE is returned on mismatch; the plain text must then be discarded.
+     */
+    uint32_t           tagLenBytes;
 }DTHE_AES_Params;
 /* ========================================================================== */
 /*                            Global Variables                                */
@@ -301,6 +471,8 @@ DTHE_AES_Return_t DTHE_AES_open(DTHE_Handle handle);
 
 /**
  * \brief               The function is used to execute the AES Driver with the specified parameters.
+ *                      One-shot operations below the software threshold of their mode, see
+ *                      #DTHE_AES_setSwDispatch, are run by the software AES instead of the engine.
  *
  * \param  handle       #DTHE_Handle returned from #DTHE_open().
  *
@@ -311,6 +483,145 @@ DTHE_AES_Return_t DTHE_AES_open(DTHE_Handle handle);
  */
 DTHE_AES_Return_t DTHE_AES_execute(DTHE_Handle handle, const DTHE_AES_Params* ptrParams);
 
+/**
+ * \brief               The function is used to execute the AES Driver on scatter-gather buffer lists.
+ *                      The input segments are processed as one message without first being copied into
+ *                      a single buffer. With DMA enabled the list is moved as one linked EDMA transfer and
+ *                      only blocks which straddle two segments are copied by the CPU.
+ *
+ *                      ptrParams is used as for #DTHE_AES_execute, except that the data pointers, the
+ *                      streamSize and, for one-shot, the dataLenBytes are taken from the segment lists.
+ *                      For DTHE_AES_STREAM_UPDATE the input length must be aligned to 16 Bytes.
+ *
+ * \param  handle           #DTHE_Handle returned from #DTHE_open().
+ *
+ * \param ptrParams         Pointer to the parameters to be used to execute the driver.
+ *
+ * \param ptrInSegments     Input segments (plain text for encryption, encrypted data for decryption).
+ *
+ * \param numInSegments     Number of input segments.
+ *
+ * \param ptrOutSegments    Output segments, at least as long as the input. Not used by the MAC only modes.
+ *
+ * \param numOutSegments    Number of output segments.
+ *
+ * \return              #DTHE_AES_RETURN_SUCCESS if requested operation completed.
+ *                      #DTHE_AES_RETURN_FAILURE if requested operation not completed.
+ */
+DTHE_AES_Return_t DTHE_AES_executeSG(DTHE_Handle handle, const DTHE_AES_Params* ptrParams,
+                                     const DTHE_Segment* ptrInSegments, uint32_t numInSegments,
+                                     const DTHE_Segment* ptrOutSegments, uint32_t numOutSegments);
+
+/**
+ * \brief               The function is used to encrypt or decrypt consecutive XTS data units, such as
+ *                      the sectors of an external flash. Keys and mode are programmed once; for every
+ *                      sector only the tweak value, the data unit number as a 128-bit little-endian
+ *                      value, is loaded and the engine derives the tweak from it with 'ptrKey2'.
+ *                      With DMA enabled every sector is one DMA transfer.
+ *
+ *                      algoType of ptrParams must be DTHE_AES_XTS_MODE. ptrIV and the stream fields are
+ *                      not used, dataLenBytes must be a multiple of the sector size.
+ *
+ * \param  handle           #DTHE_Handle returned from #DTHE_open().
+ *
+ * \param ptrParams         Pointer to the parameters to be used to execute the driver.
+ *
+ * \param dataUnitNumber    Data unit number of the first sector.
+ *
+ * \param sectorSize        Size of a sector in bytes, a multiple of 16 Bytes.
+ *
+ * \return              #DTHE_AES_RETURN_SUCCESS if requested operation completed.
+ *                      #DTHE_AES_RETURN_FAILURE if requested operation not completed.
+ */
+DTHE_AES_Return_t DTHE_AES_executeXtsSectors(DTHE_Handle handle, const DTHE_AES_Params* ptrParams,
+                                             uint64_t dataUnitNumber, uint32_t sectorSize);
+
+/**
+ * \brief               The function is used to compute the AES-CMAC of a batch of messages under one key.
+ *                      Mode, key and the subkeys K1/K2 are programmed once; between messages only the
+ *                      MAC state is reset. Messages of at least 8 blocks are moved by DMA when it is
+ *                      enabled, shorter ones are written by the CPU.
+ *
+ *                      algoType of ptrParams must be DTHE_AES_CMAC_MODE; useKEKMode, ptrKey, ptrKey1,
+ *                      ptrKey2 and keyLen are used, the data, tag and stream fields are not.
+ *
+ * \param  handle       #DTHE_Handle returned from #DTHE_open().
+ *
+ * \param ptrParams     Pointer to the parameters holding the key and the subkeys.
+ *
+ * \param ptrMessages   Pointer to the messages; the tag of each message is written to its ptrTag.
+ *
+ * \param numMessages   Number of messages.
+ *
+ * \return              #DTHE_AES_RETURN_SUCCESS if requested operation completed.
+ *                      #DTHE_AES_RETURN_FAILURE if requested operation not completed.
+ */
+DTHE_AES_Return_t DTHE_AES_cmacBatch(DTHE_Handle handle, const DTHE_AES_Params* ptrParams,
+                                     DTHE_AES_CmacMessage* ptrMessages, uint32_t numMessages);
+
+/**
+ * \brief               The function is used to verify the AES-CMAC of a batch of messages under one key,
+ *                      as #DTHE_AES_cmacBatch does, against the tag held by each message. The comparison
+ *                      takes constant time. The result of each message is returned in its status.
+ *
+ * \param  handle       #DTHE_Handle returned from #DTHE_open().
+ *
+ * \param ptrParams     Pointer to the parameters holding the key and the subkeys.
+ *
+ * \param ptrMessages   Pointer to the messages holding the received tags.
+ *
+ * \param numMessages   Number of messages.
+ *
+ * \return              #DTHE_AES_RETURN_SUCCESS if every message is authentic.
+ *                      #DTHE_AES_RETURN_FAILURE if a message failed or the operation not completed.
+ */
+DTHE_AES_Return_t DTHE_AES_cmacBatchVerify(DTHE_Handle handle, const DTHE_AES_Params* ptrParams,
+                                           DTHE_AES_CmacMessage* ptrMessages, uint32_t numMessages);
+
+/**
+ * \brief               The function is used to start an AES operation without waiting for the DMA.
+ *                      The full blocks are moved by the DMA while the CPU is free; the partial last block
+ *                      and the tag are handled by #DTHE_AES_wait once the DMA is done, so that the engine
+ *                      is never polled from the interrupt. The callback tells when the job can be waited
+ *                      for without blocking; #DTHE_AES_wait must be called to get its result.
+ *
+ *                      The parameters are used as for #DTHE_AES_execute, for DTHE_AES_ONE_SHOT_SUPPORT,
+ *                      DTHE_AES_STREAM_UPDATE and DTHE_AES_STREAM_FINISH. DMA must be enabled for the
+ *                      handle. The data, tag and context buffers must stay valid until the job is done.
+ *                      One job runs at a time; the synchronous APIs fail while it runs. A job moves at
+ *                      most #DTHE_JOB_MAX_BLOCKS full blocks, larger data must be split over stream updates.
+ *
+ * \param  handle       #DTHE_Handle returned from #DTHE_open().
+ *
+ * \param ptrParams     Pointer to the parameters of the operation.
+ *
+ * \param callback      Completion callback, can be NULL.
+ *
+ * \param args          Argument passed to the callback.
+ *
+ * \param ptrToken      Token of the job, to be passed to #DTHE_AES_wait.
+ *
+ * \return              #DTHE_AES_RETURN_SUCCESS if the job is started.
+ *                      #DTHE_AES_RETURN_FAILURE if the job could not be started.
+ */
+DTHE_AES_Return_t DTHE_AES_submit(DTHE_Handle handle, const DTHE_AES_Params* ptrParams,
+                                  DTHE_AES_JobCallback callback, void *args, DTHE_JobToken *ptrToken);
+
+/**
+ * \brief               The function is used to wait for an asynchronous AES job.
+ *
+ * \param  handle       #DTHE_Handle returned from #DTHE_open().
+ *
+ * \param token         Token returned by #DTHE_AES_submit.
+ *
+ * \param timeout       Time to wait in system ticks, SystemP_NO_WAIT to poll or SystemP_WAIT_FOREVER.
+ *
+ * \return              Result of the job if it is done.
+ *                      #DTHE_AES_RETURN_TIMEOUT if the job is still running, wait again.
+ *                      #DTHE_AES_RETURN_FAILURE if the token is not valid.
+ */
+DTHE_AES_Return_t DTHE_AES_wait(DTHE_Handle handle, DTHE_JobToken token, uint32_t timeout);
+
 /**
  * \brief               Function to close DTHE AES Driver.
  *
@@ -321,6 +632,25 @@ DTHE_AES_Return_t DTHE_AES_execute(DTHE_Handle handle, const DTHE_AES_Params* pt
  */
 DTHE_AES_Return_t DTHE_AES_close(DTHE_Handle handle);
 
+/**
+ * \brief               Function to initialize an AES context before it is used for an operation.
+ *
+ * \param ptrContext    Pointer to the AES context.
+ */
+static inline void DTHE_AES_Context_init(DTHE_AES_Context *ptrContext);
+
+/* ========================================================================== */
+/*                       Static Function Definitions                          */
+/* ========================================================================== */
+
+static inline void DTHE_AES_Context_init(DTHE_AES_Context *ptrContext)
+{
+    if(ptrContext != NULL)
+    {
+        (void)memset((void *)ptrContext, 0, sizeof(DTHE_AES_Context));
+    }
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,964 @@
+/*
+ *  Copyright (C) 2024 Texas Instruments Incorporated
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  \file   dthe_aes_sw.c
+ *
+ *  \brief  This file contains the implementation of the DTHE AES software path
+ */
+
+/* ========================================================================== */
+/*                             Include Files                                  */
+/* ========================================================================== */
+
+#include <string.h>
+#include <security_common/drivers/crypto/dthe/dthe_aes_sw.h>
+
+/* ========================================================================== */
+/*                           Macros & Typedefs                                */
+/* ========================================================================== */
+
+/** Size of the AES block in bytes */
+#define DTHE_AES_SW_BLOCK_SIZE          (16U)
+
+/** Number of modes which can be dispatched to software */
+#define DTHE_AES_SW_NUM_MODES           (6U)
+
+/** Mode is not supported in software */
+#define DTHE_AES_SW_MODE_INVALID        (0xFFFFFFFFU)
+
+/** Read a big endian word */
+#define DTHE_AES_SW_GET32(p)            (((uint32_t)(p)[0U] << 24U) | ((uint32_t)(p)[1U] << 16U) | \
+                                         ((uint32_t)(p)[2U] << 8U) | (uint32_t)(p)[3U])
+
+/** Rotate a word right by n bits */
+#define DTHE_AES_SW_ROR32(x, n)         (((x) >> (n)) | ((x) << (32U - (n))))
+
+/** Software dispatch settings of one mode */
+typedef struct DTHE_AES_SwDispatch_t
+{
+    uint32_t    thresholdBytes;     /**< Largest data length run in software */
+    uint32_t    impl;               /**< Implementation to be used */
+}DTHE_AES_SwDispatch;
+
+/* ========================================================================== */
+/*                            Global Variables                                */
+/* ========================================================================== */
+
+/** Software dispatch settings, indexed by #DTHE_AES_swModeIndex */
+static DTHE_AES_SwDispatch gDtheAesSwDispatch[DTHE_AES_SW_NUM_MODES];
+
+/** Round constants of the key expansion */
+static const uint8_t gDtheAesSwRcon[10U] =
+{
+    0x01U, 0x02U, 0x04U, 0x08U, 0x10U, 0x20U, 0x40U, 0x80U, 0x1BU, 0x36U
+};
+
+static const uint8_t gDtheAesSwSbox[256U] =
+{
+    0x63U, 0x7CU, 0x77U, 0x7BU, 0xF2U, 0x6BU, 0x6FU, 0xC5U, 0x30U, 0x01U, 0x67U, 0x2BU, 0xFEU, 0xD7U, 0xABU, 0x76U,
+    0xCAU, 0x82U, 0xC9U, 0x7DU, 0xFAU, 0x59U, 0x47U, 0xF0U, 0xADU, 0xD4U, 0xA2U, 0xAFU, 0x9CU, 0xA4U, 0x72U, 0xC0U,
+    0xB7U, 0xFDU, 0x93U, 0x26U, 0x36U, 0x3FU, 0xF7U, 0xCCU, 0x34U, 0xA5U, 0xE5U, 0xF1U, 0x71U, 0xD8U, 0x31U, 0x15U,
+    0x04U, 0xC7U, 0x23U, 0xC3U, 0x18U, 0x96U, 0x05U, 0x9AU, 0x07U, 0x12U, 0x80U, 0xE2U, 0xEBU, 0x27U, 0xB2U, 0x75U,
+    0x09U, 0x83U, 0x2CU, 0x1AU, 0x1BU, 0x6EU, 0x5AU, 0xA0U, 0x52U, 0x3BU, 0xD6U, 0xB3U, 0x29U, 0xE3U, 0x2FU, 0x84U,
+    0x53U, 0xD1U, 0x00U, 0xEDU, 0x20U, 0xFCU, 0xB1U, 0x5BU, 0x6AU, 0xCBU, 0xBEU, 0x39U, 0x4AU, 0x4CU, 0x58U, 0xCFU,
+    0xD0U, 0xEFU, 0xAAU, 0xFBU, 0x43U, 0x4DU, 0x33U, 0x85U, 0x45U, 0xF9U, 0x02U, 0x7FU, 0x50U, 0x3CU, 0x9FU, 0xA8U,
+    0x51U, 0xA3U, 0x40U, 0x8FU, 0x92U, 0x9DU, 0x38U, 0xF5U, 0xBCU, 0xB6U, 0xDAU, 0x21U, 0x10U, 0xFFU, 0xF3U, 0xD2U,
+    0xCDU, 0x0CU, 0x13U, 0xECU, 0x5FU, 0x97U, 0x44U, 0x17U, 0xC4U, 0xA7U, 0x7EU, 0x3DU, 0x64U, 0x5DU, 0x19U, 0x73U,
+    0x60U, 0x81U, 0x4FU, 0xDCU, 0x22U, 0x2AU, 0x90U, 0x88U, 0x46U, 0xEEU, 0xB8U, 0x14U, 0xDEU, 0x5EU, 0x0BU, 0xDBU,
+    0xE0U, 0x32U, 0x3AU, 0x0AU, 0x49U, 0x06U, 0x24U, 0x5CU, 0xC2U, 0xD3U, 0xACU, 0x62U, 0x91U, 0x95U, 0xE4U, 0x79U,
+    0xE7U, 0xC8U, 0x37U, 0x6DU, 0x8DU, 0xD5U, 0x4EU, 0xA9U, 0x6CU, 0x56U, 0xF4U, 0xEAU, 0x65U, 0x7AU, 0xAEU, 0x08U,
+    0xBAU, 0x78U, 0x25U, 0x2EU, 0x1CU, 0xA6U, 0xB4U, 0xC6U, 0xE8U, 0xDDU, 0x74U, 0x1FU, 0x4BU, 0xBDU, 0x8BU, 0x8AU,
+    0x70U, 0x3EU, 0xB5U, 0x66U, 0x48U, 0x03U, 0xF6U, 0x0EU, 0x61U, 0x35U, 0x57U, 0xB9U, 0x86U, 0xC1U, 0x1DU, 0x9EU,
+    0xE1U, 0xF8U, 0x98U, 0x11U, 0x69U, 0xD9U, 0x8EU, 0x94U, 0x9BU, 0x1EU, 0x87U, 0xE9U, 0xCEU, 0x55U, 0x28U, 0xDFU,
+    0x8CU, 0xA1U, 0x89U, 0x0DU, 0xBFU, 0xE6U, 0x42U, 0x68U, 0x41U, 0x99U, 0x2DU, 0x0FU, 0xB0U, 0x54U, 0xBBU, 0x16U
+};
+
+static const uint8_t gDtheAesSwInvSbox[256U] =
+{
+    0x52U, 0x09U, 0x6AU, 0xD5U, 0x30U, 0x36U, 0xA5U, 0x38U, 0xBFU, 0x40U, 0xA3U, 0x9EU, 0x81U, 0xF3U, 0xD7U, 0xFBU,
+    0x7CU, 0xE3U, 0x39U, 0x82U, 0x9BU, 0x2FU, 0xFFU, 0x87U, 0x34U, 0x8EU, 0x43U, 0x44U, 0xC4U, 0xDEU, 0xE9U, 0xCBU,
+    0x54U, 0x7BU, 0x94U, 0x32U, 0xA6U, 0xC2U, 0x23U, 0x3DU, 0xEEU, 0x4CU, 0x95U, 0x0BU, 0x42U, 0xFAU, 0xC3U, 0x4EU,
+    0x08U, 0x2EU, 0xA1U, 0x66U, 0x28U, 0xD9U, 0x24U, 0xB2U, 0x76U, 0x5BU, 0xA2U, 0x49U, 0x6DU, 0x8BU, 0xD1U, 0x25U,
+    0x72U, 0xF8U, 0xF6U, 0x64U, 0x86U, 0x68U, 0x98U, 0x16U, 0xD4U, 0xA4U, 0x5CU, 0xCCU, 0x5DU, 0x65U, 0xB6U, 0x92U,
+    0x6CU, 0x70U, 0x48U, 0x50U, 0xFDU, 0xEDU, 0xB9U, 0xDAU, 0x5EU, 0x15U, 0x46U, 0x57U, 0xA7U, 0x8DU, 0x9DU, 0x84U,
+    0x90U, 0xD8U, 0xABU, 0x00U, 0x8CU, 0xBCU, 0xD3U, 0x0AU, 0xF7U, 0xE4U, 0x58U, 0x05U, 0xB8U, 0xB3U, 0x45U, 0x06U,
+    0xD0U, 0x2CU, 0x1EU, 0x8FU, 0xCAU, 0x3FU, 0x0FU, 0x02U, 0xC1U, 0xAFU, 0xBDU, 0x03U, 0x01U, 0x13U, 0x8AU, 0x6BU,
+    0x3AU, 0x91U, 0x11U, 0x41U, 0x4FU, 0x67U, 0xDCU, 0xEAU, 0x97U, 0xF2U, 0xCFU, 0xCEU, 0xF0U, 0xB4U, 0xE6U, 0x73U,
+    0x96U, 0xACU, 0x74U, 0x22U, 0xE7U, 0xADU, 0x35U, 0x85U, 0xE2U, 0xF9U, 0x37U, 0xE8U, 0x1CU, 0x75U, 0xDFU, 0x6EU,
+    0x47U, 0xF1U, 0x1AU, 0x71U, 0x1DU, 0x29U, 0xC5U, 0x89U, 0x6FU, 0xB7U, 0x62U, 0x0EU, 0xAAU, 0x18U, 0xBEU, 0x1BU,
+    0xFCU, 0x56U, 0x3EU, 0x4BU, 0xC6U, 0xD2U, 0x79U, 0x20U, 0x9AU, 0xDBU, 0xC0U, 0xFEU, 0x78U, 0xCDU, 0x5AU, 0xF4U,
+    0x1FU, 0xDDU, 0xA8U, 0x33U, 0x88U, 0x07U, 0xC7U, 0x31U, 0xB1U, 0x12U, 0x10U, 0x59U, 0x27U, 0x80U, 0xECU, 0x5FU,
+    0x60U, 0x51U, 0x7FU, 0xA9U, 0x19U, 0xB5U, 0x4AU, 0x0DU, 0x2DU, 0xE5U, 0x7AU, 0x9FU, 0x93U, 0xC9U, 0x9CU, 0xEFU,
+    0xA0U, 0xE0U, 0x3BU, 0x4DU, 0xAEU, 0x2AU, 0xF5U, 0xB0U, 0xC8U, 0xEBU, 0xBBU, 0x3CU, 0x83U, 0x53U, 0x99U, 0x61U,
+    0x17U, 0x2BU, 0x04U, 0x7EU, 0xBAU, 0x77U, 0xD6U, 0x26U, 0xE1U, 0x69U, 0x14U, 0x63U, 0x55U, 0x21U, 0x0CU, 0x7DU
+};
+
+static const uint32_t gDtheAesSwTe0[256U] =
+{
+    0xC66363A5U, 0xF87C7C84U, 0xEE777799U, 0xF67B7B8DU, 0xFFF2F20DU, 0xD66B6BBDU, 0xDE6F6FB1U, 0x91C5C554U,
+    0x60303050U, 0x02010103U, 0xCE6767A9U, 0x562B2B7DU, 0xE7FEFE19U, 0xB5D7D762U, 0x4DABABE6U, 0xEC76769AU,
+    0x8FCACA45U, 0x1F82829DU, 0x89C9C940U, 0xFA7D7D87U, 0xEFFAFA15U, 0xB25959EBU, 0x8E4747C9U, 0xFBF0F00BU,
+    0x41ADADECU, 0xB3D4D467U, 0x5FA2A2FDU, 0x45AFAFEAU, 0x239C9CBFU, 0x53A4A4F7U, 0xE4727296U, 0x9BC0C05BU,
+    0x75B7B7C2U, 0xE1FDFD1CU, 0x3D9393AEU, 0x4C26266AU, 0x6C36365AU, 0x7E3F3F41U, 0xF5F7F702U, 0x83CCCC4FU,
+    0x6834345CU, 0x51A5A5F4U, 0xD1E5E534U, 0xF9F1F108U, 0xE2717193U, 0xABD8D873U, 0x62313153U, 0x2A15153FU,
+    0x0804040CU, 0x95C7C752U, 0x46232365U, 0x9DC3C35EU, 0x30181828U, 0x379696A1U, 0x0A05050FU, 0x2F9A9AB5U,
+    0x0E070709U, 0x24121236U, 0x1B80809BU, 0xDFE2E23DU, 0xCDEBEB26U, 0x4E272769U, 0x7FB2B2CDU, 0xEA75759FU,
+    0x1209091BU, 0x1D83839EU, 0x582C2C74U, 0x341A1A2EU, 0x361B1B2DU, 0xDC6E6EB2U, 0xB45A5AEEU, 0x5BA0A0FBU,
+    0xA45252F6U, 0x763B3B4DU, 0xB7D6D661U, 0x7DB3B3CEU, 0x5229297BU, 0xDDE3E33EU, 0x5E2F2F71U, 0x13848497U,
+    0xA65353F5U, 0xB9D1D168U, 0x00000000U, 0xC1EDED2CU, 0x40202060U, 0xE3FCFC1FU, 0x79B1B1C8U, 0xB65B5BEDU,
+    0xD46A6ABEU, 0x8DCBCB46U, 0x67BEBED9U, 0x7239394BU, 0x944A4ADEU, 0x984C4CD4U, 0xB05858E8U, 0x85CFCF4AU,
+    0xBBD0D06BU, 0xC5EFEF2AU, 0x4FAAAAE5U, 0xEDFBFB16U, 0x864343C5U, 0x9A4D4DD7U, 0x66333355U, 0x11858594U,
+    0x8A4545CFU, 0xE9F9F910U, 0x04020206U, 0xFE7F7F81U, 0xA05050F0U, 0x783C3C44U, 0x259F9FBAU, 0x4BA8A8E3U,
+    0xA25151F3U, 0x5DA3A3FEU, 0x804040C0U, 0x058F8F8AU, 0x3F9292ADU, 0x219D9DBCU, 0x70383848U, 0xF1F5F504U,
+    0x63BCBCDFU, 0x77B6B6C1U, 0xAFDADA75U, 0x42212163U, 0x20101030U, 0xE5FFFF1AU, 0xFDF3F30EU, 0xBFD2D26DU,
+    0x81CDCD4CU, 0x180C0C14U, 0x26131335U, 0xC3ECEC2FU, 0xBE5F5FE1U, 0x359797A2U, 0x884444CCU, 0x2E171739U,
+    0x93C4C457U, 0x55A7A7F2U, 0xFC7E7E82U, 0x7A3D3D47U, 0xC86464ACU, 0xBA5D5DE7U, 0x3219192BU, 0xE6737395U,
+    0xC06060A0U, 0x19818198U, 0x9E4F4FD1U, 0xA3DCDC7FU, 0x44222266U, 0x542A2A7EU, 0x3B9090ABU, 0x0B888883U,
+    0x8C4646CAU, 0xC7EEEE29U, 0x6BB8B8D3U, 0x2814143CU, 0xA7DEDE79U, 0xBC5E5EE2U, 0x160B0B1DU, 0xADDBDB76U,
+    0xDBE0E03BU, 0x64323256U, 0x743A3A4EU, 0x140A0A1EU, 0x924949DBU, 0x0C06060AU, 0x4824246CU, 0xB85C5CE4U,
+    0x9FC2C25DU, 0xBDD3D36EU, 0x43ACACEFU, 0xC46262A6U, 0x399191A8U, 0x319595A4U, 0xD3E4E437U, 0xF279798BU,
+    0xD5E7E732U, 0x8BC8C843U, 0x6E373759U, 0xDA6D6DB7U, 0x018D8D8CU, 0xB1D5D564U, 0x9C4E4ED2U, 0x49A9A9E0U,
+    0xD86C6CB4U, 0xAC5656FAU, 0xF3F4F407U, 0xCFEAEA25U, 0xCA6565AFU, 0xF47A7A8EU, 0x47AEAEE9U, 0x10080818U,
+    0x6FBABAD5U, 0xF0787888U, 0x4A25256FU, 0x5C2E2E72U, 0x381C1C24U, 0x57A6A6F1U, 0x73B4B4C7U, 0x97C6C651U,
+    0xCBE8E823U, 0xA1DDDD7CU, 0xE874749CU, 0x3E1F1F21U, 0x964B4BDDU, 0x61BDBDDCU, 0x0D8B8B86U, 0x0F8A8A85U,
+    0xE0707090U, 0x7C3E3E42U, 0x71B5B5C4U, 0xCC6666AAU, 0x904848D8U, 0x06030305U, 0xF7F6F601U, 0x1C0E0E12U,
+    0xC26161A3U, 0x6A35355FU, 0xAE5757F9U, 0x69B9B9D0U, 0x17868691U, 0x99C1C158U, 0x3A1D1D27U, 0x279E9EB9U,
+    0xD9E1E138U, 0xEBF8F813U, 0x2B9898B3U, 0x22111133U, 0xD26969BBU, 0xA9D9D970U, 0x078E8E89U, 0x339494A7U,
+    0x2D9B9BB6U, 0x3C1E1E22U, 0x15878792U, 0xC9E9E920U, 0x87CECE49U, 0xAA5555FFU, 0x50282878U, 0xA5DFDF7AU,
+    0x038C8C8FU, 0x59A1A1F8U, 0x09898980U, 0x1A0D0D17U, 0x65BFBFDAU, 0xD7E6E631U, 0x844242C6U, 0xD06868B8U,
+    0x824141C3U, 0x299999B0U, 0x5A2D2D77U, 0x1E0F0F11U, 0x7BB0B0CBU, 0xA85454FCU, 0x6DBBBBD6U, 0x2C16163AU
+};
+
+static const uint32_t gDtheAesSwTd0[256U] =
+{
+    0x51F4A750U, 0x7E416553U, 0x1A17A4C3U, 0x3A275E96U, 0x3BAB6BCBU, 0x1F9D45F1U, 0xACFA58ABU, 0x4BE30393U,
+    0x2030FA55U, 0xAD766DF6U, 0x88CC7691U, 0xF5024C25U, 0x4FE5D7FCU, 0xC52ACBD7U, 0x26354480U, 0xB562A38FU,
+    0xDEB15A49U, 0x25BA1B67U, 0x45EA0E98U, 0x5DFEC0E1U, 0xC32F7502U, 0x814CF012U, 0x8D4697A3U, 0x6BD3F9C6U,
+    0x038F5FE7U, 0x15929C95U, 0xBF6D7AEBU, 0x955259DAU, 0xD4BE832DU, 0x587421D3U, 0x49E06929U, 0x8EC9C844U,
+    0x75C2896AU, 0xF48E7978U, 0x99583E6BU, 0x27B971DDU, 0xBEE14FB6U, 0xF088AD17U, 0xC920AC66U, 0x7DCE3AB4U,
+    0x63DF4A18U, 0xE51A3182U, 0x97513360U, 0x62537F45U, 0xB16477E0U, 0xBB6BAE84U, 0xFE81A01CU, 0xF9082B94U,
+    0x70486858U, 0x8F45FD19U, 0x94DE6C87U, 0x527BF8B7U, 0xAB73D323U, 0x724B02E2U, 0xE31F8F57U, 0x6655AB2AU,
+    0xB2EB2807U, 0x2FB5C203U, 0x86C57B9AU, 0xD33708A5U, 0x302887F2U, 0x23BFA5B2U, 0x02036ABAU, 0xED16825CU,
+    0x8ACF1C2BU, 0xA779B492U, 0xF307F2F0U, 0x4E69E2A1U, 0x65DAF4CDU, 0x0605BED5U, 0xD134621FU, 0xC4A6FE8AU,
+    0x342E539DU, 0xA2F355A0U, 0x058AE132U, 0xA4F6EB75U, 0x0B83EC39U, 0x4060EFAAU, 0x5E719F06U, 0xBD6E1051U,
+    0x3E218AF9U, 0x96DD063DU, 0xDD3E05AEU, 0x4DE6BD46U, 0x91548DB5U, 0x71C45D05U, 0x0406D46FU, 0x605015FFU,
+    0x1998FB24U, 0xD6BDE997U, 0x894043CCU, 0x67D99E77U, 0xB0E842BDU, 0x07898B88U, 0xE7195B38U, 0x79C8EEDBU,
+    0xA17C0A47U, 0x7C420FE9U, 0xF8841EC9U, 0x00000000U, 0x09808683U, 0x322BED48U, 0x1E1170ACU, 0x6C5A724EU,
+    0xFD0EFFFBU, 0x0F853856U, 0x3DAED51EU, 0x362D3927U, 0x0A0FD964U, 0x685CA621U, 0x9B5B54D1U, 0x24362E3AU,
+    0x0C0A67B1U, 0x9357E70FU, 0xB4EE96D2U, 0x1B9B919EU, 0x80C0C54FU, 0x61DC20A2U, 0x5A774B69U, 0x1C121A16U,
+    0xE293BA0AU, 0xC0A02AE5U, 0x3C22E043U, 0x121B171DU, 0x0E090D0BU, 0xF28BC7ADU, 0x2DB6A8B9U, 0x141EA9C8U,
+    0x57F11985U, 0xAF75074CU, 0xEE99DDBBU, 0xA37F60FDU, 0xF701269FU, 0x5C72F5BCU, 0x44663BC5U, 0x5BFB7E34U,
+    0x8B432976U, 0xCB23C6DCU, 0xB6EDFC68U, 0xB8E4F163U, 0xD731DCCAU, 0x42638510U, 0x13972240U, 0x84C61120U,
+    0x854A247DU, 0xD2BB3DF8U, 0xAEF93211U, 0xC729A16DU, 0x1D9E2F4BU, 0xDCB230F3U, 0x0D8652ECU, 0x77C1E3D0U,
+    0x2BB3166CU, 0xA970B999U, 0x119448FAU, 0x47E96422U, 0xA8FC8CC4U, 0xA0F03F1AU, 0x567D2CD8U, 0x223390EFU,
+    0x87494EC7U, 0xD938D1C1U, 0x8CCAA2FEU, 0x98D40B36U, 0xA6F581CFU, 0xA57ADE28U, 0xDAB78E26U, 0x3FADBFA4U,
+    0x2C3A9DE4U, 0x5078920DU, 0x6A5FCC9BU, 0x547E4662U, 0xF68D13C2U, 0x90D8B8E8U, 0x2E39F75EU, 0x82C3AFF5U,
+    0x9F5D80BEU, 0x69D0937CU, 0x6FD52DA9U, 0xCF2512B3U, 0xC8AC993BU, 0x10187DA7U, 0xE89C636EU, 0xDB3BBB7BU,
+    0xCD267809U, 0x6E5918F4U, 0xEC9AB701U, 0x834F9AA8U, 0xE6956E65U, 0xAAFFE67EU, 0x21BCCF08U, 0xEF15E8E6U,
+    0xBAE79BD9U, 0x4A6F36CEU, 0xEA9F09D4U, 0x29B07CD6U, 0x31A4B2AFU, 0x2A3F2331U, 0xC6A59430U, 0x35A266C0U,
+    0x744EBC37U, 0xFC82CAA6U, 0xE090D0B0U, 0x33A7D815U, 0xF104984AU, 0x41ECDAF7U, 0x7FCD500EU, 0x1791F62FU,
+    0x764DD68DU, 0x43EFB04DU, 0xCCAA4D54U, 0xE49604DFU, 0x9ED1B5E3U, 0x4C6A881BU, 0xC12C1FB8U, 0x4665517FU,
+    0x9D5EEA04U, 0x018C355DU, 0xFA877473U, 0xFB0B412EU, 0xB3671D5AU, 0x92DBD252U, 0xE9105633U, 0x6DD64713U,
+    0x9AD7618CU, 0x37A10C7AU, 0x59F8148EU, 0xEB133C89U, 0xCEA927EEU, 0xB761C935U, 0xE11CE5EDU, 0x7A47B13CU,
+    0x9CD2DF59U, 0x55F2733FU, 0x1814CE79U, 0x73C737BFU, 0x53F7CDEAU, 0x5FFDAA5BU, 0xDF3D6F14U, 0x7844DB86U,
+    0xCAAFF381U, 0xB968C43EU, 0x3824342CU, 0xC2A3405FU, 0x161DC372U, 0xBCE2250CU, 0x283C498BU, 0xFF0D9541U,
+    0x39A80171U, 0x080CB3DEU, 0xD8B4E49CU, 0x6456C190U, 0x7BCB8461U, 0xD532B670U, 0x486C5C74U, 0xD0B85742U
+};
+
+/* ========================================================================== */
+/*                          Function Declarations                             */
+/* ========================================================================== */
+
+static uint32_t DTHE_AES_swModeIndex(uint32_t algoType);
+static uint8_t DTHE_AES_swSboxCt(const uint8_t *ptrTable, uint8_t value);
+static uint32_t DTHE_AES_swSubWord(uint32_t word, uint32_t impl);
+static uint8_t DTHE_AES_swXtime(uint8_t value);
+static uint8_t DTHE_AES_swMul(uint8_t a, uint8_t b);
+static void DTHE_AES_swPut32(uint8_t *ptrData, uint32_t value);
+static void DTHE_AES_swEncryptTable(const DTHE_AES_SwKey *ptrSwKey, const uint8_t *ptrInput, uint8_t *ptrOutput);
+static void DTHE_AES_swDecryptTable(const DTHE_AES_SwKey *ptrSwKey, const uint8_t *ptrInput, uint8_t *ptrOutput);
+static void DTHE_AES_swCipherCt(const DTHE_AES_SwKey *ptrSwKey, const uint8_t *ptrInput, uint8_t *ptrOutput, uint32_t isDecrypt);
+static void DTHE_AES_swIncrementCounter(uint8_t *ptrCounter, uint32_t counterWidth);
+
+/* ========================================================================== */
+/*                          Function Definitions                              */
+/* ========================================================================== */
+
+DTHE_AES_Return_t DTHE_AES_swSetKey(DTHE_AES_SwKey *ptrSwKey, const uint8_t *ptrKey, uint32_t keyLen, uint32_t impl)
+{
+    DTHE_AES_Return_t   status = DTHE_AES_RETURN_SUCCESS;
+    uint32_t            keyWords = 0U;
+    uint32_t            numWords;
+    uint32_t            index;
+    uint32_t            round;
+    uint32_t            temp;
+    uint32_t            word;
+
+    if ((ptrSwKey == NULL) || (ptrKey == NULL) ||
+        ((impl != DTHE_AES_SW_IMPL_TTABLE) && (impl != DTHE_AES_SW_IMPL_CONST_TIME)))
+    {
+        status = DTHE_AES_RETURN_FAILURE;
+    }
+    else if (keyLen == DTHE_AES_KEY_128_SIZE)
+    {
+        keyWords = 4U;
+    }
+    else if (keyLen == DTHE_AES_KEY_192_SIZE)
+    {
+        keyWords = 6U;
+    }
+    else if (keyLen == DTHE_AES_KEY_256_SIZE)
+    {
+        keyWords = 8U;
+    }
+    else
+    {
+        status = DTHE_AES_RETURN_FAILURE;
+    }
+
+    if (status == DTHE_AES_RETURN_SUCCESS)
+    {
+        ptrSwKey->impl      = impl;
+        ptrSwKey->numRounds = keyWords + 6U;
+        numWords            = 4U * (ptrSwKey->numRounds + 1U);
+
+        for (index = 0U; index < keyWords; index++)
+        {
+            ptrSwKey->encKey[index] = DTHE_AES_SW_GET32(&ptrKey[4U * index]);
+        }
+
+        for (index = keyWords; index < numWords; index++)
+        {
+            temp = ptrSwKey->encKey[index - 1U];
+            if ((index % keyWords) == 0U)
+            {
+                temp = DTHE_AES_swSubWord((temp << 8U) | (temp >> 24U), impl) ^
+                       ((uint32_t)gDtheAesSwRcon[(index / keyWords) - 1U] << 24U);
+            }
+            else if ((keyWords == 8U) && ((index % keyWords) == 4U))
+            {
+                temp = DTHE_AES_swSubWord(temp, impl);
+            }
+            else
+            {
+                /* No substitution for the other words */
+            }
+            ptrSwKey->encKey[index] = ptrSwKey->encKey[index - keyWords] ^ temp;
+        }
+
+        /* Equivalent inverse cipher: reversed round keys, InvMixColumns on the inner rounds */
+        for (round = 0U; round <= ptrSwKey->numRounds; round++)
+        {
+            for (index = 0U; index < 4U; index++)
+            {
+                word = ptrSwKey->encKey[(4U * (ptrSwKey->numRounds - round)) + index];
+                if ((impl == DTHE_AES_SW_IMPL_TTABLE) && (round != 0U) && (round != ptrSwKey->numRounds))
+                {
+                    word = gDtheAesSwTd0[gDtheAesSwSbox[word >> 24U]] ^
+                           DTHE_AES_SW_ROR32(gDtheAesSwTd0[gDtheAesSwSbox[(word >> 16U) & 0xFFU]], 8U) ^
+                           DTHE_AES_SW_ROR32(gDtheAesSwTd0[gDtheAesSwSbox[(word >> 8U) & 0xFFU]], 16U) ^
+                           DTHE_AES_SW_ROR32(gDtheAesSwTd0[gDtheAesSwSbox[word & 0xFFU]], 24U);
+                }
+                ptrSwKey->decKey[(4U * round) + index] = word;
+            }
+        }
+    }
+
+    return (status);
+}
+
+void DTHE_AES_swEncryptBlock(const DTHE_AES_SwKey *ptrSwKey, const uint8_t *ptrInput, uint8_t *ptrOutput)
+{
+    if (ptrSwKey->impl == DTHE_AES_SW_IMPL_TTABLE)
+    {
+        DTHE_AES_swEncryptTable(ptrSwKey, ptrInput, ptrOutput);
+    }
+    else
+    {
+        DTHE_AES_swCipherCt(ptrSwKey, ptrInput, ptrOutput, 0U);
+    }
+
+    return;
+}
+
+void DTHE_AES_swDecryptBlock(const DTHE_AES_SwKey *ptrSwKey, const uint8_t *ptrInput, uint8_t *ptrOutput)
+{
+    if (ptrSwKey->impl == DTHE_AES_SW_IMPL_TTABLE)
+    {
+        DTHE_AES_swDecryptTable(ptrSwKey, ptrInput, ptrOutput);
+    }
+    else
+    {
+        DTHE_AES_swCipherCt(ptrSwKey, ptrInput, ptrOutput, 1U);
+    }
+
+    return;
+}
+
+DTHE_AES_Return_t DTHE_AES_executeSw(const DTHE_AES_Params* ptrParams, uint32_t impl)
+{
+    DTHE_AES_Return_t   status = DTHE_AES_RETURN_FAILURE;
+    DTHE_AES_SwKey      swKey;
+    const uint8_t       *ptrInput;
+    uint8_t             *ptrOutput;
+    uint8_t             block[DTHE_AES_SW_BLOCK_SIZE];
+    uint8_t             chain[DTHE_AES_SW_BLOCK_SIZE];
+    uint8_t             keyStream[DTHE_AES_SW_BLOCK_SIZE];
+    const uint8_t       *ptrSubKey;
+    uint32_t            algoType;
+    uint32_t            isDecrypt;
+    uint32_t            numBlocks;
+    uint32_t            partialDataSize;
+    uint32_t            blockIndex;
+    uint32_t            index;
+
+    if ((ptrParams != NULL) && (ptrParams->streamState == DTHE_AES_ONE_SHOT_SUPPORT) &&
+        (ptrParams->useKEKMode != TRUE) && (ptrParams->dataLenBytes != 0U) &&
+        (DTHE_AES_swModeIndex(ptrParams->algoType) != DTHE_AES_SW_MODE_INVALID))
+    {
+        status = DTHE_AES_swSetKey(&swKey, (const uint8_t *)ptrParams->ptrKey, ptrParams->keyLen, impl);
+    }
+
+    if (status == DTHE_AES_RETURN_SUCCESS)
+    {
+        algoType        = ptrParams->algoType;
+        numBlocks       = ptrParams->dataLenBytes / DTHE_AES_SW_BLOCK_SIZE;
+        partialDataSize = ptrParams->dataLenBytes % DTHE_AES_SW_BLOCK_SIZE;
+
+        /* Same buffer selection as the engine */
+        if (ptrParams->opType == DTHE_AES_ENCRYPT)
+        {
+            isDecrypt   = 0U;
+            ptrInput    = (const uint8_t *)ptrParams->ptrPlainTextData;
+            ptrOutput   = (uint8_t *)ptrParams->ptrEncryptedData;
+        }
+        else
+        {
+            isDecrypt   = 1U;
+            ptrInput    = (const uint8_t *)ptrParams->ptrEncryptedData;
+            ptrOutput   = (uint8_t *)ptrParams->ptrPlainTextData;
+        }
+
+        /* Sanity Check: buffers needed by the mode */
+        if (ptrInput == NULL)
+        {
+            status = DTHE_AES_RETURN_FAILURE;
+        }
+        if ((algoType == DTHE_AES_CBC_MAC_MODE) || (algoType == DTHE_AES_CMAC_MODE))
+        {
+            if ((ptrParams->ptrTag == NULL) ||
+                ((algoType == DTHE_AES_CMAC_MODE) && ((ptrParams->ptrKey1 == NULL) || (ptrParams->ptrKey2 == NULL))))
+            {
+                status = DTHE_AES_RETURN_FAILURE;
+            }
+        }
+        else
+        {
+            if (ptrOutput == NULL)
+            {
+                status = DTHE_AES_RETURN_FAILURE;
+            }
+            if ((algoType != DTHE_AES_ECB_MODE) && (ptrParams->ptrIV == NULL))
+            {
+                status = DTHE_AES_RETURN_FAILURE;
+            }
+            /* The engine pads a partial ECB/CBC block with zeros: such data stays on the engine */
+            if (((algoType == DTHE_AES_ECB_MODE) || (algoType == DTHE_AES_CBC_MODE)) && (partialDataSize != 0U))
+            {
+                status = DTHE_AES_RETURN_FAILURE;
+            }
+        }
+    }
+
+    if (status == DTHE_AES_RETURN_SUCCESS)
+    {
+        (void)memset ((void *)&chain[0U], 0, sizeof(chain));
+        if ((algoType != DTHE_AES_ECB_MODE) && (algoType != DTHE_AES_CBC_MAC_MODE) && (algoType != DTHE_AES_CMAC_MODE))
+        {
+            (void)memcpy ((void *)&chain[0U], (const void *)ptrParams->ptrIV, DTHE_AES_SW_BLOCK_SIZE);
+        }
+
+        for (blockIndex = 0U; blockIndex < (numBlocks + ((partialDataSize != 0U) ? 1U : 0U)); blockIndex++)
+        {
+            /* Load the block, zero padded if partial */
+            (void)memset ((void *)&block[0U], 0, sizeof(block));
+            if (blockIndex < numBlocks)
+            {
+                (void)memcpy ((void *)&block[0U], (const void *)&ptrInput[blockIndex * DTHE_AES_SW_BLOCK_SIZE], DTHE_AES_SW_BLOCK_SIZE);
+            }
+            else
+            {
+                (void)memcpy ((void *)&block[0U], (const void *)&ptrInput[blockIndex * DTHE_AES_SW_BLOCK_SIZE], partialDataSize);
+            }
+
+            if (algoType == DTHE_AES_ECB_MODE)
+            {
+                if (isDecrypt == 1U)
+                {
+                    DTHE_AES_swDecryptBlock(&swKey, &block[0U], &ptrOutput[blockIndex * DTHE_AES_SW_BLOCK_SIZE]);
+                }
+                else
+                {
+                    DTHE_AES_swEncryptBlock(&swKey, &block[0U], &ptrOutput[blockIndex * DTHE_AES_SW_BLOCK_SIZE]);
+                }
+            }
+            else if (algoType == DTHE_AES_CBC_MODE)
+            {
+                if (isDecrypt == 1U)
+                {
+                    DTHE_AES_swDecryptBlock(&swKey, &block[0U], &keyStream[0U]);
+                    for (index = 0U; index < DTHE_AES_SW_BLOCK_SIZE; index++)
+                    {
+                        ptrOutput[(blockIndex * DTHE_AES_SW_BLOCK_SIZE) + index] = keyStream[index] ^ chain[index];
+                    }
+                    (void)memcpy ((void *)&chain[0U], (const void *)&block[0U], DTHE_AES_SW_BLOCK_SIZE);
+                }
+                else
+                {
+                    for (index = 0U; index < DTHE_AES_SW_BLOCK_SIZE; index++)
+                    {
+                        chain[index] = chain[index] ^ block[index];
+                    }
+                    DTHE_AES_swEncryptBlock(&swKey, &chain[0U], &chain[0U]);
+                    (void)memcpy ((void *)&ptrOutput[blockIndex * DTHE_AES_SW_BLOCK_SIZE], (const void *)&chain[0U], DTHE_AES_SW_BLOCK_SIZE);
+                }
+            }
+            else if ((algoType == DTHE_AES_CTR_MODE) || (algoType == DTHE_AES_CFB_MODE))
+            {
+                DTHE_AES_swEncryptBlock(&swKey, &chain[0U], &keyStream[0U]);
+                for (index = 0U; index < DTHE_AES_SW_BLOCK_SIZE; index++)
+                {
+                    keyStream[index] = keyStream[index] ^ block[index];
+                }
+                /* Only the valid bytes of a partial block are written */
+                (void)memcpy ((void *)&ptrOutput[blockIndex * DTHE_AES_SW_BLOCK_SIZE], (const void *)&keyStream[0U],
+                              (blockIndex < numBlocks) ? DTHE_AES_SW_BLOCK_SIZE : partialDataSize);
+
+                if (algoType == DTHE_AES_CTR_MODE)
+                {
+                    DTHE_AES_swIncrementCounter(&chain[0U], ptrParams->counterWidth);
+                }
+                else if (isDecrypt == 1U)
+                {
+                    (void)memcpy ((void *)&chain[0U], (const void *)&block[0U], DTHE_AES_SW_BLOCK_SIZE);
+                }
+                else
+                {
+                    (void)memcpy ((void *)&chain[0U], (const void *)&keyStream[0U], DTHE_AES_SW_BLOCK_SIZE);
+                }
+            }
+            else
+            {
+                /* CBC-MAC and CMAC: the last block is combined with the CMAC subkey */
+                if ((algoType == DTHE_AES_CMAC_MODE) &&
+                    (blockIndex == (numBlocks + ((partialDataSize != 0U) ? 1U : 0U) - 1U)))
+                {
+                    if (partialDataSize != 0U)
+                    {
+                        block[partialDataSize] = 0x80U;
+                        ptrSubKey = (const uint8_t *)ptrParams->ptrKey2;
+                    }
+                    else
+                    {
+                        ptrSubKey = (const uint8_t *)ptrParams->ptrKey1;
+                    }
+                    for (index = 0U; index < DTHE_AES_SW_BLOCK_SIZE; index++)
+                    {
+                        block[index] = block[index] ^ ptrSubKey[index];
+                    }
+                }
+                for (index = 0U; index < DTHE_AES_SW_BLOCK_SIZE; index++)
+                {
+                    chain[index] = chain[index] ^ block[index];
+                }
+                DTHE_AES_swEncryptBlock(&swKey, &chain[0U], &chain[0U]);
+            }
+        }
+
+        if ((algoType == DTHE_AES_CBC_MAC_MODE) || (algoType == DTHE_AES_CMAC_MODE))
+        {
+            (void)memcpy ((void *)ptrParams->ptrTag, (const void *)&chain[0U], DTHE_AES_SW_BLOCK_SIZE);
+        }
+
+        (void)memset ((void *)&swKey, 0, sizeof(swKey));
+        (void)memset ((void *)&block[0U], 0, sizeof(block));
+        (void)memset ((void *)&chain[0U], 0, sizeof(chain));
+        (void)memset ((void *)&keyStream[0U], 0, sizeof(keyStream));
+    }
+
+    return (status);
+}
+
+DTHE_AES_Return_t DTHE_AES_setSwDispatch(uint32_t algoType, uint32_t thresholdBytes, uint32_t impl)
+{
+    DTHE_AES_Return_t   status = DTHE_AES_RETURN_FAILURE;
+    uint32_t            modeIndex;
+
+    modeIndex = DTHE_AES_swModeIndex(algoType);
+    if ((modeIndex != DTHE_AES_SW_MODE_INVALID) &&
+        ((impl == DTHE_AES_SW_IMPL_TTABLE) || (impl == DTHE_AES_SW_IMPL_CONST_TIME)))
+    {
+        gDtheAesSwDispatch[modeIndex].thresholdBytes = thresholdBytes;
+        gDtheAesSwDispatch[modeIndex].impl           = impl;
+        status = DTHE_AES_RETURN_SUCCESS;
+    }
+
+    return (status);
+}
+
+uint32_t DTHE_AES_isSwDispatched(const DTHE_AES_Params* ptrParams, uint32_t *ptrImpl)
+{
+    uint32_t    isSw = 0U;
+    uint32_t    modeIndex;
+
+    modeIndex = DTHE_AES_swModeIndex(ptrParams->algoType);
+    if ((modeIndex != DTHE_AES_SW_MODE_INVALID) && (ptrParams->streamState == DTHE_AES_ONE_SHOT_SUPPORT) &&
+        (ptrParams->useKEKMode != TRUE) && (ptrParams->dataLenBytes != 0U) &&
+        (ptrParams->dataLenBytes <= gDtheAesSwDispatch[modeIndex].thresholdBytes))
+    {
+        /* Partial ECB/CBC blocks keep the zero padding behaviour of the engine */
+        if (((ptrParams->algoType != DTHE_AES_ECB_MODE) && (ptrParams->algoType != DTHE_AES_CBC_MODE)) ||
+            ((ptrParams->dataLenBytes % DTHE_AES_SW_BLOCK_SIZE) == 0U))
+        {
+            *ptrImpl = gDtheAesSwDispatch[modeIndex].impl;
+            isSw     = 1U;
+        }
+    }
+
+    return (isSw);
+}
+
+/**
+ * \brief                   The function is used to get the dispatch settings index of a mode.
+ *
+ * \param   algoType        Mode of the operation.
+ *
+ * \return                  Index, or DTHE_AES_SW_MODE_INVALID if the mode is not supported in software.
+ */
+static uint32_t DTHE_AES_swModeIndex(uint32_t algoType)
+{
+    uint32_t    modeIndex;
+
+    switch (algoType)
+    {
+        case DTHE_AES_ECB_MODE:
+            modeIndex = 0U;
+            break;
+        case DTHE_AES_CBC_MODE:
+            modeIndex = 1U;
+            break;
+        case DTHE_AES_CTR_MODE:
+            modeIndex = 2U;
+            break;
+        case DTHE_AES_CFB_MODE:
+            modeIndex = 3U;
+            break;
+        case DTHE_AES_CBC_MAC_MODE:
+            modeIndex = 4U;
+            break;
+        case DTHE_AES_CMAC_MODE:
+            modeIndex = 5U;
+            break;
+        default:
+            modeIndex = DTHE_AES_SW_MODE_INVALID;
+            break;
+    }
+
+    return (modeIndex);
+}
+
+/**
+ * \brief                   The function is used to look up a substitution table without a data dependent
+ *                          memory access: every entry is read and the matching one is selected by a mask.
+ *
+ * \param   ptrTable        Pointer to the 256 entry table.
+ *
+ * \param   value           Index to be looked up.
+ *
+ * \return                  Table entry.
+ */
+static uint8_t DTHE_AES_swSboxCt(const uint8_t *ptrTable, uint8_t value)
+{
+    uint32_t    result = 0U;
+    uint32_t    diff;
+    uint32_t    mask;
+    uint32_t    index;
+
+    for (index = 0U; index < 256U; index++)
+    {
+        diff    = index ^ (uint32_t)value;
+        /* All ones when diff is zero, zero otherwise */
+        mask    = ((diff - 1U) >> 8U) & 0xFFU;
+        result  = result | ((uint32_t)ptrTable[index] & mask);
+    }
+
+    return ((uint8_t)result);
+}
+
+/**
+ * \brief                   The function is used to substitute the bytes of a key expansion word.
+ *
+ * \param   word            Word to be substituted.
+ *
+ * \param   impl            Implementation of the key.
+ *
+ * \return                  Substituted word.
+ */
+static uint32_t DTHE_AES_swSubWord(uint32_t word, uint32_t impl)
+{
+    uint32_t    result = 0U;
+    uint32_t    shift;
+    uint8_t     value;
+
+    for (shift = 0U; shift < 32U; shift = shift + 8U)
+    {
+        value = (uint8_t)(word >> shift);
+        if (impl == DTHE_AES_SW_IMPL_CONST_TIME)
+        {
+            value = DTHE_AES_swSboxCt(&gDtheAesSwSbox[0U], value);
+        }
+        else
+        {
+            value = gDtheAesSwSbox[value];
+        }
+        result = result | ((uint32_t)value << shift);
+    }
+
+    return (result);
+}
+
+/**
+ * \brief                   The function is used to multiply by x in GF(2^8) without a branch.
+ *
+ * \param   value           Value to be multiplied.
+ *
+ * \return                  Product.
+ */
+static uint8_t DTHE_AES_swXtime(uint8_t value)
+{
+    return ((uint8_t)(((uint32_t)value << 1U) ^ (0x1BU & (0U - ((uint32_t)value >> 7U)))));
+}
+
+/**
+ * \brief                   The function is used to multiply two values in GF(2^8) without a data
+ *                          dependent branch.
+ *
+ * \param   a               First value.
+ *
+ * \param   b               Second value, a public constant.
+ *
+ * \return                  Product.
+ */
+static uint8_t DTHE_AES_swMul(uint8_t a, uint8_t b)
+{
+    uint8_t     result = 0U;
+    uint8_t     value  = a;
+    uint32_t    bit;
+
+    for (bit = 0U; bit < 4U; bit++)
+    {
+        result = (uint8_t)(result ^ (value & (uint8_t)(0U - (((uint32_t)b >> bit) & 1U))));
+        value  = DTHE_AES_swXtime(value);
+    }
+
+    return (result);
+}
+
+/**
+ * \brief                   The function is used to write a big endian word.
+ *
+ * \param   ptrData         Pointer to the 4 output bytes.
+ *
+ * \param   value           Word to be written.
+ */
+static void DTHE_AES_swPut32(uint8_t *ptrData, uint32_t value)
+{
+    ptrData[0U] = (uint8_t)(value >> 24U);
+    ptrData[1U] = (uint8_t)(value >> 16U);
+    ptrData[2U] = (uint8_t)(value >> 8U);
+    ptrData[3U] = (uint8_t)value;
+}
+
+/**
+ * \brief                   The function is used to encrypt one block with the table based AES.
+ *
+ * \param   ptrSwKey        Pointer to the expanded key.
+ *
+ * \param   ptrInput        Pointer to the input block.
+ *
+ * \param   ptrOutput       Pointer to the output block.
+ */
+static void DTHE_AES_swEncryptTable(const DTHE_AES_SwKey *ptrSwKey, const uint8_t *ptrInput, uint8_t *ptrOutput)
+{
+    const uint32_t  *ptrRoundKey = &ptrSwKey->encKey[0U];
+    uint32_t        s0, s1, s2, s3;
+    uint32_t        t0, t1, t2, t3;
+    uint32_t        round;
+
+    s0 = DTHE_AES_SW_GET32(&ptrInput[0U]) ^ ptrRoundKey[0U];
+    s1 = DTHE_AES_SW_GET32(&ptrInput[4U]) ^ ptrRoundKey[1U];
+    s2 = DTHE_AES_SW_GET32(&ptrInput[8U]) ^ ptrRoundKey[2U];
+    s3 = DTHE_AES_SW_GET32(&ptrInput[12U]) ^ ptrRoundKey[3U];
+
+    for (round = 1U; round < ptrSwKey->numRounds; round++)
+    {
+        ptrRoundKey = &ptrRoundKey[4U];
+        t0 = gDtheAesSwTe0[s0 >> 24U] ^ DTHE_AES_SW_ROR32(gDtheAesSwTe0[(s1 >> 16U) & 0xFFU], 8U) ^
+             DTHE_AES_SW_ROR32(gDtheAesSwTe0[(s2 >> 8U) & 0xFFU], 16U) ^ DTHE_AES_SW_ROR32(gDtheAesSwTe0[s3 & 0xFFU], 24U) ^ ptrRoundKey[0U];
+        t1 = gDtheAesSwTe0[s1 >> 24U] ^ DTHE_AES_SW_ROR32(gDtheAesSwTe0[(s2 >> 16U) & 0xFFU], 8U) ^
+             DTHE_AES_SW_ROR32(gDtheAesSwTe0[(s3 >> 8U) & 0xFFU], 16U) ^ DTHE_AES_SW_ROR32(gDtheAesSwTe0[s0 & 0xFFU], 24U) ^ ptrRoundKey[1U];
+        t2 = gDtheAesSwTe0[s2 >> 24U] ^ DTHE_AES_SW_ROR32(gDtheAesSwTe0[(s3 >> 16U) & 0xFFU], 8U) ^
+             DTHE_AES_SW_ROR32(gDtheAesSwTe0[(s0 >> 8U) & 0xFFU], 16U) ^ DTHE_AES_SW_ROR32(gDtheAesSwTe0[s1 & 0xFFU], 24U) ^ ptrRoundKey[2U];
+        t3 = gDtheAesSwTe0[s3 >> 24U] ^ DTHE_AES_SW_ROR32(gDtheAesSwTe0[(s0 >> 16U) & 0xFFU], 8U) ^
+             DTHE_AES_SW_ROR32(gDtheAesSwTe0[(s1 >> 8U) & 0xFFU], 16U) ^ DTHE_AES_SW_ROR32(gDtheAesSwTe0[s2 & 0xFFU], 24U) ^ ptrRoundKey[3U];
+        s0 = t0;
+        s1 = t1;
+        s2 = t2;
+        s3 = t3;
+    }
+
+    /* Last round: no MixColumns */
+    ptrRoundKey = &ptrRoundKey[4U];
+    t0 = ((uint32_t)gDtheAesSwSbox[s0 >> 24U] << 24U) ^ ((uint32_t)gDtheAesSwSbox[(s1 >> 16U) & 0xFFU] << 16U) ^
+         ((uint32_t)gDtheAesSwSbox[(s2 >> 8U) & 0xFFU] << 8U) ^ (uint32_t)gDtheAesSwSbox[s3 & 0xFFU] ^ ptrRoundKey[0U];
+    t1 = ((uint32_t)gDtheAesSwSbox[s1 >> 24U] << 24U) ^ ((uint32_t)gDtheAesSwSbox[(s2 >> 16U) & 0xFFU] << 16U) ^
+         ((uint32_t)gDtheAesSwSbox[(s3 >> 8U) & 0xFFU] << 8U) ^ (uint32_t)gDtheAesSwSbox[s0 & 0xFFU] ^ ptrRoundKey[1U];
+    t2 = ((uint32_t)gDtheAesSwSbox[s2 >> 24U] << 24U) ^ ((uint32_t)gDtheAesSwSbox[(s3 >> 16U) & 0xFFU] << 16U) ^
+         ((uint32_t)gDtheAesSwSbox[(s0 >> 8U) & 0xFFU] << 8U) ^ (uint32_t)gDtheAesSwSbox[s1 & 0xFFU] ^ ptrRoundKey[2U];
+    t3 = ((uint32_t)gDtheAesSwSbox[s3 >> 24U] << 24U) ^ ((uint32_t)gDtheAesSwSbox[(s0 >> 16U) & 0xFFU] << 16U) ^
+         ((uint32_t)gDtheAesSwSbox[(s1 >> 8U) & 0xFFU] << 8U) ^ (uint32_t)gDtheAesSwSbox[s2 & 0xFFU] ^ ptrRoundKey[3U];
+
+    DTHE_AES_swPut32(&ptrOutput[0U], t0);
+    DTHE_AES_swPut32(&ptrOutput[4U], t1);
+    DTHE_AES_swPut32(&ptrOutput[8U], t2);
+    DTHE_AES_swPut32(&ptrOutput[12U], t3);
+
+    return;
+}
+
+/**
+ * \brief                   The function is used to decrypt one block with the table based AES.
+ *
+ * \param   ptrSwKey        Pointer to the expanded key.
+ *
+ * \param   ptrInput        Pointer to the input block.
+ *
+ * \param   ptrOutput       Pointer to the output block.
+ */
+static void DTHE_AES_swDecryptTable(const DTHE_AES_SwKey *ptrSwKey, const uint8_t *ptrInput, uint8_t *ptrOutput)
+{
+    const uint32_t  *ptrRoundKey = &ptrSwKey->decKey[0U];
+    uint32_t        s0, s1, s2, s3;
+    uint32_t        t0, t1, t2, t3;
+    uint32_t        round;
+
+    s0 = DTHE_AES_SW_GET32(&ptrInput[0U]) ^ ptrRoundKey[0U];
+    s1 = DTHE_AES_SW_GET32(&ptrInput[4U]) ^ ptrRoundKey[1U];
+    s2 = DTHE_AES_SW_GET32(&ptrInput[8U]) ^ ptrRoundKey[2U];
+    s3 = DTHE_AES_SW_GET32(&ptrInput[12U]) ^ ptrRoundKey[3U];
+
+    for (round = 1U; round < ptrSwKey->numRounds; round++)
+    {
+        ptrRoundKey = &ptrRoundKey[4U];
+        t0 = gDtheAesSwTd0[s0 >> 24U] ^ DTHE_AES_SW_ROR32(gDtheAesSwTd0[(s3 >> 16U) & 0xFFU], 8U) ^
+             DTHE_AES_SW_ROR32(gDtheAesSwTd0[(s2 >> 8U) & 0xFFU], 16U) ^ DTHE_AES_SW_ROR32(gDtheAesSwTd0[s1 & 0xFFU], 24U) ^ ptrRoundKey[0U];
+        t1 = gDtheAesSwTd0[s1 >> 24U] ^ DTHE_AES_SW_ROR32(gDtheAesSwTd0[(s0 >> 16U) & 0xFFU], 8U) ^
+             DTHE_AES_SW_ROR32(gDtheAesSwTd0[(s3 >> 8U) & 0xFFU], 16U) ^ DTHE_AES_SW_ROR32(gDtheAesSwTd0[s2 & 0xFFU], 24U) ^ ptrRoundKey[1U];
+        t2 = gDtheAesSwTd0[s2 >> 24U] ^ DTHE_AES_SW_ROR32(gDtheAesSwTd0[(s1 >> 16U) & 0xFFU], 8U) ^
+             DTHE_AES_SW_ROR32(gDtheAesSwTd0[(s0 >> 8U) & 0xFFU], 16U) ^ DTHE_AES_SW_ROR32(gDtheAesSwTd0[s3 & 0xFFU], 24U) ^ ptrRoundKey[2U];
+        t3 = gDtheAesSwTd0[s3 >> 24U] ^ DTHE_AES_SW_ROR32(gDtheAesSwTd0[(s2 >> 16U) & 0xFFU], 8U) ^
+             DTHE_AES_SW_ROR32(gDtheAesSwTd0[(s1 >> 8U) & 0xFFU], 16U) ^ DTHE_AES_SW_ROR32(gDtheAesSwTd0[s0 & 0xFFU], 24U) ^ ptrRoundKey[3U];
+        s0 = t0;
+        s1 = t1;
+        s2 = t2;
+        s3 = t3;
+    }
+
+    /* Last round: no InvMixColumns */
+    ptrRoundKey = &ptrRoundKey[4U];
+    t0 = ((uint32_t)gDtheAesSwInvSbox[s0 >> 24U] << 24U) ^ ((uint32_t)gDtheAesSwInvSbox[(s3 >> 16U) & 0xFFU] << 16U) ^
+         ((uint32_t)gDtheAesSwInvSbox[(s2 >> 8U) & 0xFFU] << 8U) ^ (uint32_t)gDtheAesSwInvSbox[s1 & 0xFFU] ^ ptrRoundKey[0U];
+    t1 = ((uint32_t)gDtheAesSwInvSbox[s1 >> 24U] << 24U) ^ ((uint32_t)gDtheAesSwInvSbox[(s0 >> 16U) & 0xFFU] << 16U) ^
+         ((uint32_t)gDtheAesSwInvSbox[(s3 >> 8U) & 0xFFU] << 8U) ^ (uint32_t)gDtheAesSwInvSbox[s2 & 0xFFU] ^ ptrRoundKey[1U];
+    t2 = ((uint32_t)gDtheAesSwInvSbox[s2 >> 24U] << 24U) ^ ((uint32_t)gDtheAesSwInvSbox[(s1 >> 16U) & 0xFFU] << 16U) ^
+         ((uint32_t)gDtheAesSwInvSbox[(s0 >> 8U) & 0xFFU] << 8U) ^ (uint32_t)gDtheAesSwInvSbox[s3 & 0xFFU] ^ ptrRoundKey[2U];
+    t3 = ((uint32_t)gDtheAesSwInvSbox[s3 >> 24U] << 24U) ^ ((uint32_t)gDtheAesSwInvSbox[(s2 >> 16U) & 0xFFU] << 16U) ^
+         ((uint32_t)gDtheAesSwInvSbox[(s1 >> 8U) & 0xFFU] << 8U) ^ (uint32_t)gDtheAesSwInvSbox[s0 & 0xFFU] ^ ptrRoundKey[3U];
+
+    DTHE_AES_swPut32(&ptrOutput[0U], t0);
+    DTHE_AES_swPut32(&ptrOutput[4U], t1);
+    DTHE_AES_swPut32(&ptrOutput[8U], t2);
+    DTHE_AES_swPut32(&ptrOutput[12U], t3);
+
+    return;
+}
+
+/**
+ * \brief                   The function is used to encrypt or decrypt one block with the constant-time AES.
+ *                          The state is processed byte by byte; substitutions read the whole table and
+ *                          the GF(2^8) arithmetic has no data dependent branch.
+ *
+ * \param   ptrSwKey        Pointer to the expanded key.
+ *
+ * \param   ptrInput        Pointer to the input block.
+ *
+ * \param   ptrOutput       Pointer to the output block.
+ *
+ * \param   isDecrypt       1 to decrypt, 0 to encrypt.
+ */
+static void DTHE_AES_swCipherCt(const DTHE_AES_SwKey *ptrSwKey, const uint8_t *ptrInput, uint8_t *ptrOutput, uint32_t isDecrypt)
+{
+    uint8_t     state[DTHE_AES_SW_BLOCK_SIZE];
+    uint8_t     temp[DTHE_AES_SW_BLOCK_SIZE];
+    uint8_t     a0, a1, a2, a3;
+    uint32_t    round;
+    uint32_t    roundKeyIndex;
+    uint32_t    column;
+    uint32_t    index;
+
+    (void)memcpy ((void *)&state[0U], (const void *)ptrInput, DTHE_AES_SW_BLOCK_SIZE);
+
+    for (round = 0U; round <= ptrSwKey->numRounds; round++)
+    {
+        if (round != 0U)
+        {
+            /* (Inv)SubBytes and (Inv)ShiftRows: byte r of column c moves to column c -/+ r */
+            for (column = 0U; column < 4U; column++)
+            {
+                for (index = 0U; index < 4U; index++)
+                {
+                    if (isDecrypt == 0U)
+                    {
+                        temp[(4U * column) + index] = DTHE_AES_swSboxCt(&gDtheAesSwSbox[0U], state[(4U * ((column + index) % 4U)) + index]);
+                    }
+                    else
+                    {
+                        temp[(4U * column) + index] = DTHE_AES_swSboxCt(&gDtheAesSwInvSbox[0U], state[(4U * ((column + 4U - index) % 4U)) + index]);
+                    }
+                }
+            }
+            (void)memcpy ((void *)&state[0U], (const void *)&temp[0U], DTHE_AES_SW_BLOCK_SIZE);
+
+            /* Encryption mixes before the round key, decryption after it */
+            if ((isDecrypt == 0U) && (round != ptrSwKey->numRounds))
+            {
+                for (column = 0U; column < 4U; column++)
+                {
+                    a0 = state[4U * column];
+                    a1 = state[(4U * column) + 1U];
+                    a2 = state[(4U * column) + 2U];
+                    a3 = state[(4U * column) + 3U];
+                    state[4U * column]         = (uint8_t)(DTHE_AES_swXtime(a0 ^ a1) ^ a1 ^ a2 ^ a3);
+                    state[(4U * column) + 1U]  = (uint8_t)(DTHE_AES_swXtime(a1 ^ a2) ^ a2 ^ a3 ^ a0);
+                    state[(4U * column) + 2U]  = (uint8_t)(DTHE_AES_swXtime(a2 ^ a3) ^ a3 ^ a0 ^ a1);
+                    state[(4U * column) + 3U]  = (uint8_t)(DTHE_AES_swXtime(a3 ^ a0) ^ a0 ^ a1 ^ a2);
+                }
+            }
+        }
+
+        /* AddRoundKey: decryption uses the encryption round keys in reverse order */
+        roundKeyIndex = (isDecrypt == 0U) ? (4U * round) : (4U * (ptrSwKey->numRounds - round));
+        for (column = 0U; column < 4U; column++)
+        {
+            for (index = 0U; index < 4U; index++)
+            {
+                state[(4U * column) + index] = (uint8_t)(state[(4U * column) + index] ^
+                                               (uint8_t)(ptrSwKey->encKey[roundKeyIndex + column] >> (24U - (8U * index))));
+            }
+        }
+
+        if ((isDecrypt == 1U) && (round != 0U) && (round != ptrSwKey->numRounds))
+        {
+            for (column = 0U; column < 4U; column++)
+            {
+                a0 = state[4U * column];
+                a1 = state[(4U * column) + 1U];
+                a2 = state[(4U * column) + 2U];
+                a3 = state[(4U * column) + 3U];
+                state[4U * column]         = (uint8_t)(DTHE_AES_swMul(a0, 14U) ^ DTHE_AES_swMul(a1, 11U) ^ DTHE_AES_swMul(a2, 13U) ^ DTHE_AES_swMul(a3, 9U));
+                state[(4U * column) + 1U]  = (uint8_t)(DTHE_AES_swMul(a0, 9U) ^ DTHE_AES_swMul(a1, 14U) ^ DTHE_AES_swMul(a2, 11U) ^ DTHE_AES_swMul(a3, 13U));
+                state[(4U * column) + 2U]  = (uint8_t)(DTHE_AES_swMul(a0, 13U) ^ DTHE_AES_swMul(a1, 9U) ^ DTHE_AES_swMul(a2, 14U) ^ DTHE_AES_swMul(a3, 11U));
+                state[(4U * column) + 3U]  = (uint8_t)(DTHE_AES_swMul(a0, 11U) ^ DTHE_AES_swMul(a1, 13U) ^ DTHE_AES_swMul(a2, 9U) ^ DTHE_AES_swMul(a3, 14U));
+            }
+        }
+    }
+
+    (void)memcpy ((void *)ptrOutput, (const void *)&state[0U], DTHE_AES_SW_BLOCK_SIZE);
+    (void)memset ((void *)&state[0U], 0, sizeof(state));
+    (void)memset ((void *)&temp[0U], 0, sizeof(temp));
+
+    return;
+}
+
+/**
+ * \brief                   The function is used to increment the counter block the way the engine does:
+ *                          the low counterWidth bits are a big endian counter which wraps around.
+ *
+ * \param   ptrCounter      Pointer to the 16 byte counter block.
+ *
+ * \param   counterWidth    Width of the counter, DTHE_AES_CTR_WIDTH_32 to DTHE_AES_CTR_WIDTH_128.
+ */
+static void DTHE_AES_swIncrementCounter(uint8_t *ptrCounter, uint32_t counterWidth)
+{
+    uint32_t    counterBytes;
+    uint32_t    carry = 1U;
+    uint32_t    sum;
+    uint32_t    index;
+
+    if (counterWidth == DTHE_AES_CTR_WIDTH_32)
+    {
+        counterBytes = 4U;
+    }
+    else if (counterWidth == DTHE_AES_CTR_WIDTH_64)
+    {
+        counterBytes = 8U;
+    }
+    else if (counterWidth == DTHE_AES_CTR_WIDTH_96)
+    {
+        counterBytes = 12U;
+    }
+    else
+    {
+        /* Any other value programs a 128-bit counter in the engine */
+        counterBytes = 16U;
+    }
+
+    for (index = 0U; index < counterBytes; index++)
+    {
+        sum = (uint32_t)ptrCounter[15U - index] + carry;
+        ptrCounter[15U - index] = (uint8_t)sum;
+        carry = sum >> 8U;
+    }
+
+    return;
+}
@@ -0,0 +1,188 @@
+/*
+ *  Copyright (C) 2024 Texas Instruments Incorporated
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  \defgroup SECURITY_DTHE_AES_SW_MODULE APIs for the DTHE AES software path
+ *  \ingroup  SECURITY_MODULE
+ *
+ *  This module contains a software AES behind the DTHE AES parameters. Short
+ *  one-shot operations can be dispatched to it, where programming the engine
+ *  costs more than the cipher itself. It also serves as the reference to check
+ *  the hardware results against.
+ *
+ *  @{
+ */
+
+/**
+ *  \file dthe_aes_sw.h
+ *
+ *  \brief This file contains the prototype of the DTHE AES software path APIs
+ */
+
+#ifndef DTHE_AES_SW_H_
+#define DTHE_AES_SW_H_
+
+/* ========================================================================== */
+/*                             Include Files                                  */
+/* ========================================================================== */
+#include <stdint.h>
+#include <security_common/drivers/crypto/dthe/dthe_aes.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================== */
+/*                           Macros & Typedefs                                */
+/* ========================================================================== */
+
+/** \brief Table based software AES. Fastest, but the table lookups depend on the key and the data */
+#define DTHE_AES_SW_IMPL_TTABLE                             (0x00000001U)
+/** \brief Software AES without key or data dependent memory accesses or branches */
+#define DTHE_AES_SW_IMPL_CONST_TIME                         (0x00000002U)
+
+/** \brief Number of round key words for a 256-bit key */
+#define DTHE_AES_SW_MAX_ROUND_KEY_WORDS                     (60U)
+
+/* ========================================================================== */
+/*                         Structure Declarations                             */
+/* ========================================================================== */
+
+/** \brief Expanded key of the software AES */
+typedef struct DTHE_AES_SwKey_t
+{
+    /**< Encryption round keys */
+    uint32_t            encKey[DTHE_AES_SW_MAX_ROUND_KEY_WORDS];
+
+    /**< Decryption round keys of the equivalent inverse cipher, used by DTHE_AES_SW_IMPL_TTABLE */
+    uint32_t            decKey[DTHE_AES_SW_MAX_ROUND_KEY_WORDS];
+
+    /**< Number of rounds: 10, 12 or 14 */
+    uint32_t            numRounds;
+
+    /**< Implementation used with this key */
+    uint32_t            impl;
+}DTHE_AES_SwKey;
+
+/* ========================================================================== */
+/*                              Function Declarations                         */
+/* ========================================================================== */
+
+/**
+ * \brief               The function is used to expand a key for the software AES.
+ *
+ * \param ptrSwKey      Pointer to the expanded key populated by the API.
+ *
+ * \param ptrKey        Pointer to the key.
+ *
+ * \param keyLen        DTHE_AES_KEY_128_SIZE, DTHE_AES_KEY_192_SIZE or DTHE_AES_KEY_256_SIZE.
+ *
+ * \param impl          DTHE_AES_SW_IMPL_TTABLE or DTHE_AES_SW_IMPL_CONST_TIME.
+ *
+ * \return              #DTHE_AES_RETURN_SUCCESS if requested operation completed.
+ *                      #DTHE_AES_RETURN_FAILURE if requested operation not completed.
+ */
+DTHE_AES_Return_t DTHE_AES_swSetKey(DTHE_AES_SwKey *ptrSwKey, const uint8_t *ptrKey, uint32_t keyLen, uint32_t impl);
+
+/**
+ * \brief               The function is used to encrypt one block with the software AES.
+ *
+ * \param ptrSwKey      Pointer to the expanded key.
+ *
+ * \param ptrInput      Pointer to the 16 byte input block.
+ *
+ * \param ptrOutput     Pointer to the 16 byte output block, can be the input block.
+ */
+void DTHE_AES_swEncryptBlock(const DTHE_AES_SwKey *ptrSwKey, const uint8_t *ptrInput, uint8_t *ptrOutput);
+
+/**
+ * \brief               The function is used to decrypt one block with the software AES.
+ *
+ * \param ptrSwKey      Pointer to the expanded key.
+ *
+ * \param ptrInput      Pointer to the 16 byte input block.
+ *
+ * \param ptrOutput     Pointer to the 16 byte output block, can be the input block.
+ */
+void DTHE_AES_swDecryptBlock(const DTHE_AES_SwKey *ptrSwKey, const uint8_t *ptrInput, uint8_t *ptrOutput);
+
+/**
+ * \brief               The function is used to execute a one-shot AES operation in software, with the same
+ *                      parameters and results as #DTHE_AES_execute. The engine is not used.
+ *
+ *                      Supported are DTHE_AES_ECB_MODE and DTHE_AES_CBC_MODE on whole blocks,
+ *                      DTHE_AES_CTR_MODE, DTHE_AES_CFB_MODE, DTHE_AES_CBC_MAC_MODE and DTHE_AES_CMAC_MODE.
+ *                      The KEK mode is not available to software.
+ *
+ * \param ptrParams     Pointer to the parameters to be used to execute the operation.
+ *
+ * \param impl          DTHE_AES_SW_IMPL_TTABLE or DTHE_AES_SW_IMPL_CONST_TIME.
+ *
+ * \return              #DTHE_AES_RETURN_SUCCESS if requested operation completed.
+ *                      #DTHE_AES_RETURN_FAILURE if requested operation not completed.
+ */
+DTHE_AES_Return_t DTHE_AES_executeSw(const DTHE_AES_Params* ptrParams, uint32_t impl);
+
+/**
+ * \brief               The function is used to set when #DTHE_AES_execute runs a mode in software.
+ *                      One-shot operations of the mode with at most thresholdBytes of data are run by
+ *                      #DTHE_AES_executeSw. The crossover depends on the core clock and on DMA use; it is
+ *                      typically between 32 and 128 Bytes. All modes use the engine by default.
+ *
+ * \param algoType      Mode, one of the modes supported by #DTHE_AES_executeSw.
+ *
+ * \param thresholdBytes Largest data length run in software, 0 to always use the engine.
+ *
+ * \param impl          DTHE_AES_SW_IMPL_TTABLE or DTHE_AES_SW_IMPL_CONST_TIME.
+ *
+ * \return              #DTHE_AES_RETURN_SUCCESS if requested operation completed.
+ *                      #DTHE_AES_RETURN_FAILURE if the mode or the implementation is not supported.
+ */
+DTHE_AES_Return_t DTHE_AES_setSwDispatch(uint32_t algoType, uint32_t thresholdBytes, uint32_t impl);
+
+/**
+ * \brief               The function is used to check if an operation is to be run in software.
+ *
+ * \param ptrParams     Pointer to the parameters of the operation.
+ *
+ * \param ptrImpl       Implementation to be used, populated by the API.
+ *
+ * \return              1 if the operation is run by #DTHE_AES_executeSw, 0 otherwise.
+ */
+uint32_t DTHE_AES_isSwDispatched(const DTHE_AES_Params* ptrParams, uint32_t *ptrImpl);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/** @} */
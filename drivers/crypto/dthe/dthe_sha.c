@@ -43,6 +43,8 @@
 #include <string.h>
 #include <security_common/drivers/crypto/dthe/dthe_sha.h>
 #include <security_common/drivers/crypto/dthe/dma.h>
+#include <kernel/dpl/CacheP.h>
+#include <kernel/dpl/SemaphoreP.h>
 
 /* ========================================================================== */
 /*                           Macros & Typedefs                                */
@@ -68,16 +70,57 @@
 
 /** \brief The Maximum HMAC Key Size is 128bytes or 1024bits for the SHA512. */
 #define DTHE_HMAC_SHA_MAX_KEY_SIZE_BYTES        (128U)
+
+/** No asynchronous job was submitted since the driver was opened */
+#define DTHE_SHA_JOB_STATE_IDLE                 (0x00U)
+
+/** The asynchronous job owns the engine */
+#define DTHE_SHA_JOB_STATE_RUNNING              (0x5AU)
+
+/** The DMA of the asynchronous job is done, the job is finished from task context */
+#define DTHE_SHA_JOB_STATE_DMA_DONE             (0x96U)
+
+/** The asynchronous job is complete */
+#define DTHE_SHA_JOB_STATE_DONE                 (0xC3U)
+
+/** The context has no hash in progress */
+#define DTHE_SHA_CONTEXT_STATE_NEW              (0x00U)
+
+/** The context holds the intermediate state of a multishot hash */
+#define DTHE_SHA_CONTEXT_STATE_IN_PROGRESS      (0xA5U)
 /* ========================================================================== */
 /*                         Structure Declarations                             */
 /* ========================================================================== */
+
+/**
+ * \brief State of an asynchronous SHA job. The engine runs one job at a time, the job
+ *        is started by #DTHE_SHA_submit, its DMA completes in the DMA interrupt and the
+ *        rest of the data and the digest are handled by #DTHE_SHA_wait.
+ */
+typedef struct DTHE_SHA_Job_t
+{
+    DTHE_Handle             handle;             /**< Driver handle the job was submitted on */
+    DTHE_SHA_Params         *ptrShaParams;      /**< Parameters of the job */
+    int32_t                 isLastBlock;        /**< Flag which indicates if the hash is closed */
+    uint32_t                numBytes;           /**< Number of bytes moved by the DMA */
+    DMA_Handle              dmaHandle;          /**< DMA handle while the channel is held */
+    DTHE_SHA_JobCallback    callback;           /**< Completion callback, can be NULL */
+    void                    *args;              /**< Argument of the completion callback */
+    DTHE_JobToken           token;              /**< Token of the job */
+    volatile uint32_t       state;              /**< State of the job */
+    volatile DTHE_SHA_Return_t status;          /**< Result of the job once done */
+    SemaphoreP_Object       doneSem;            /**< Posted when the job is done */
+}DTHE_SHA_Job;
+
 /* ========================================================================== */
 /*                           Global variables                                */
 /* ========================================================================== */
-/** \brief Flag to check SHA in Progress */
-Bool                    gDTHESHAInProgress;
-/** \brief SHA Digest Count */
-uint32_t                gDTHESHAdigestCount;
+/** \brief Context of the multishot hashes which do not pass their own */
+static DTHE_SHA_Context gDTHESHADefaultContext;
+/** \brief Bounce blocks for data blocks which straddle two segments of a scatter-gather list */
+static uint32_t         gDTHESHASgBounce[DMA_MAX_SG_ENTRIES * DTHE_SHA512_BLOCK_SIZE];
+/** \brief Asynchronous SHA job */
+static DTHE_SHA_Job     gDTHESHAJob;
 /* ========================================================================== */
 /*                 Internal Function Declarations                             */
 /* ========================================================================== */
@@ -105,10 +148,29 @@ static uint8_t DTHE_SHA_isOutputReadyIRQ(const CSL_EIP57T_SHARegs* ptrSHARegs);
 static uint8_t DTHE_SHA_isInputReadyIRQ(const CSL_EIP57T_SHARegs* ptrSHARegs);
 static uint32_t DTHE_SHA512_getDigestCount(const CSL_EIP57T_SHARegs* ptrSHARegs);
 static uint32_t DTHE_SHA_getDigestCount(const CSL_EIP57T_SHARegs* ptrSHARegs);
+static void DTHE_SHA_setHashDigest(CSL_EIP57T_SHARegs* ptrSHARegs, const uint32_t* ptrDigest);
+static void DTHE_SHA512_setHashDigest(CSL_EIP57T_SHARegs* ptrSHARegs, const uint32_t* ptrDigest);
+static void DTHE_SHA_setDigestCount(CSL_EIP57T_SHARegs* ptrSHARegs, uint32_t digestCount);
+static void DTHE_SHA512_setDigestCount(CSL_EIP57T_SHARegs* ptrSHARegs, uint32_t digestCount);
 static void DTHE_SHA_setHMACOuterKey(CSL_EIP57T_SHARegs* ptrSHARegs, const uint32_t* ptrHMACKey);
 static void DTHE_SHA_setHMACInnerKey(CSL_EIP57T_SHARegs* ptrSHARegs, const uint32_t* ptrHMACKey);
 static void DTHE_SHA512_setHMACOuterKey(CSL_EIP57T_SHARegs* ptrSHARegs, const uint32_t* ptrHMACKey);
 static void DTHE_SHA512_setHMACInnerKey(CSL_EIP57T_SHARegs* ptrSHARegs, const uint32_t* ptrHMACKey);
+static uint32_t DTHE_SHA_getBlockSizeBytes(uint32_t algoType);
+static uint32_t DTHE_SHA_getDigestSizeBytes(uint32_t algoType);
+static DTHE_SHA_Context* DTHE_SHA_getContext(const DTHE_SHA_Params* ptrShaParams);
+static DTHE_SHA_Return_t DTHE_SHA_checkContext(const DTHE_SHA_Params* ptrShaParams);
+static void DTHE_SHA_restoreContext(CSL_EIP57T_SHARegs* ptrShaRegs, const DTHE_SHA_Context* ptrContext);
+static uint8_t DTHE_SHA_setupHashMode(CSL_EIP57T_SHARegs* ptrShaRegs, DTHE_Attrs* attrs, DTHE_SHA_Context* ptrContext,
+                                      uint32_t algoType, uint32_t dataLenBytes, int32_t isLastBlock);
+static void DTHE_SHA_readResult(CSL_EIP57T_SHARegs* ptrShaRegs, DTHE_Attrs* attrs, DTHE_SHA_Context* ptrContext,
+                                DTHE_SHA_Params* ptrShaParams, int32_t isLastBlock);
+static void DTHE_SHA_writeRemainder(CSL_EIP57T_SHARegs* ptrShaRegs, const uint32_t* ptrDataBuffer, uint32_t numBytes, uint32_t dataLenBytes);
+static void DTHE_SHA_writeData(const DTHE_Config* config, CSL_EIP57T_SHARegs* ptrShaRegs, const uint32_t* ptrDataBuffer,
+                               uint32_t dataLenBytes, uint8_t blockSize);
+static DTHE_SHA_Return_t DTHE_SHA_reapJob(void);
+static void DTHE_SHA_jobDmaComplete(void *args);
+static void DTHE_SHA_finishJob(DTHE_SHA_Job *ptrJob);
 
 /* ========================================================================== */
 /*                          Function Definitions                              */
@@ -131,10 +193,19 @@ DTHE_SHA_Return_t DTHE_SHA_open(DTHE_Handle handle)
         config              = (DTHE_Config *) handle;
         attrs               = config->attrs;
         ptrShaRegs          = (CSL_EIP57T_SHARegs *)attrs->shaBaseAddr;
-        gDTHESHAInProgress  = FALSE;
+
+        DTHE_SHA_Context_init(&gDTHESHADefaultContext);
+        attrs->shaActiveCtx = NULL;
 
         /* Disable all interrupts */
         DTHE_SHA_setInterruptStatus(ptrShaRegs, 0U);
+
+        gDTHESHAJob.state       = DTHE_SHA_JOB_STATE_IDLE;
+        gDTHESHAJob.dmaHandle   = NULL;
+        if (SemaphoreP_constructBinary(&gDTHESHAJob.doneSem, 0U) != SystemP_SUCCESS)
+        {
+            status = DTHE_SHA_RETURN_FAILURE;
+        }
     }
 
     return (status);
@@ -157,13 +228,16 @@ DTHE_SHA_Return_t DTHE_SHA_close(DTHE_Handle handle)
         config              = (DTHE_Config *) handle;
         attrs               = config->attrs;
         ptrShaRegs          = (CSL_EIP57T_SHARegs *)attrs->shaBaseAddr;
-        if(gDTHESHAInProgress == FALSE)
+        if((gDTHESHADefaultContext.state == DTHE_SHA_CONTEXT_STATE_NEW) && (DTHE_SHA_reapJob() == DTHE_SHA_RETURN_SUCCESS))
         {
             /* Disable all interrupts */
             DTHE_SHA_setInterruptStatus(ptrShaRegs, 0U);
 
-            gDTHESHAInProgress = 0;
-            gDTHESHAdigestCount = 0;
+            DTHE_SHA_Context_init(&gDTHESHADefaultContext);
+            attrs->shaActiveCtx = NULL;
+
+            gDTHESHAJob.state = DTHE_SHA_JOB_STATE_IDLE;
+            SemaphoreP_destruct(&gDTHESHAJob.doneSem);
         }
         else
         {
@@ -177,19 +251,8 @@ DTHE_SHA_Return_t DTHE_SHA_close(DTHE_Handle handle)
 DTHE_SHA_Return_t DTHE_SHA_compute(DTHE_Handle handle, DTHE_SHA_Params* ptrShaParams, int32_t isLastBlock)
 {
     DTHE_SHA_Return_t       status = DTHE_SHA_RETURN_SUCCESS;
-    DMA_Handle              dmaHandle = NULL;
-    uint32_t                index = 0U;
-    uint32_t                dataLenWords;
     uint32_t                dataLenBytes;
-    uint8_t                 *ptrByteDataBuffer;
-    uint16_t                numBlocks;
-    uint8_t                 useAlgoConstants;
-    uint8_t                 closeHash;
     uint8_t                 blockSize;
-    uint32_t                shiftSize;
-    uint32_t                numPartialWords;
-    uint32_t                partialWord = 0U;
-    uint32_t                numBytes    = 0U;
     DTHE_Config             *config = NULL;
     DTHE_Attrs              *attrs  = NULL;
     CSL_EIP57T_SHARegs      *ptrShaRegs;
@@ -198,6 +261,16 @@ DTHE_SHA_Return_t DTHE_SHA_compute(DTHE_Handle handle, DTHE_SHA_Params* ptrShaPa
     {
         status = DTHE_SHA_RETURN_FAILURE;
     }
+    else
+    {
+        /* The engine is not available while an asynchronous job runs */
+        status = DTHE_SHA_reapJob();
+    }
+
+    if(status == DTHE_SHA_RETURN_SUCCESS)
+    {
+        status = DTHE_SHA_checkContext(ptrShaParams);
+    }
 
     if(status == DTHE_SHA_RETURN_SUCCESS)
     {
@@ -241,299 +314,564 @@ DTHE_SHA_Return_t DTHE_SHA_compute(DTHE_Handle handle, DTHE_SHA_Params* ptrShaPa
         /* Ensure that the SHA IP Block is ready to receive data: */
         DTHE_SHA_pollContextReady (ptrShaRegs);
 
-        /********************************************************************
-         * Is this the first block which is being passed to the SHA Engine?
-         ********************************************************************/
-        if (gDTHESHAInProgress == FALSE)
-        {
-            /* Yes: For the first block we will use the algorithm constants */
-            useAlgoConstants = 1U;
-        }
-        else
-        {
-            /* No: For all other blocks we will not use the algorithm constants */
-            useAlgoConstants = 0U;
-        }
+        /* Program the hash mode and the length of the data: */
+        blockSize = DTHE_SHA_setupHashMode(ptrShaRegs, attrs, DTHE_SHA_getContext(ptrShaParams),
+                                           ptrShaParams->algoType, dataLenBytes, isLastBlock);
 
-        /* Is this the last block? */
-        if (isLastBlock == TRUE)
-        {
-            /* Yes: Close the Hash */
-            closeHash = 1U;
-        }
-        else
-        {
-            /* No: Dont close the hash there are more data blocks. */
-            closeHash = 0U;
-        }
+        /* Write the data to the engine: */
+        DTHE_SHA_writeData(config, ptrShaRegs, ptrShaParams->ptrDataBuffer, dataLenBytes, blockSize);
 
-        /* Update the Hash Mode: */
-        if (ptrShaParams->algoType == DTHE_SHA_ALGO_SHA256)
-        {
-            DTHE_SHA_setUseAlgoConstants(ptrShaRegs, useAlgoConstants);
-            DTHE_SHA_setCloseHash(ptrShaRegs, closeHash);
+        /* Read back the digest once the engine is done: */
+        DTHE_SHA_readResult(ptrShaRegs, attrs, DTHE_SHA_getContext(ptrShaParams), ptrShaParams, isLastBlock);
+    }
+    return (status);
+}
 
-            /* Reset the HMAC Processing: */
-            DTHE_SHA_setHMACKeyProcessing(ptrShaRegs, 0U);
-            DTHE_SHA_setHMACOuterHash(ptrShaRegs, 0U);
-        }
-        else
-        {
-            DTHE_SHA512_setUseAlgoConstants(ptrShaRegs, useAlgoConstants);
-            DTHE_SHA512_setCloseHash(ptrShaRegs, closeHash);
+DTHE_SHA_Return_t DTHE_SHA_computeSG(DTHE_Handle handle, DTHE_SHA_Params* ptrShaParams,
+                                     const DTHE_Segment* ptrSegments, uint32_t numSegments, int32_t isLastBlock)
+{
+    DTHE_SHA_Return_t       status = DTHE_SHA_RETURN_SUCCESS;
+    DMA_Handle              dmaHandle = NULL;
+    DTHE_DmaList            dmaList;
+    uint32_t                index;
+    uint32_t                dataLenBytes = 0U;
+    uint32_t                blockSizeBytes;
+    uint32_t                numBlocks = 0U;
+    uint32_t                tailLen;
+    uint32_t                tailWords[DTHE_SHA512_BLOCK_SIZE];
+    uint8_t                 blockSize = 0U;
+    uint8_t                 useDma = 0U;
+    DTHE_Config             *config = NULL;
+    DTHE_Attrs              *attrs  = NULL;
+    CSL_EIP57T_SHARegs      *ptrShaRegs = NULL;
 
-            /* Reset the HMAC Processing: */
-            DTHE_SHA512_setHMACKeyProcessing(ptrShaRegs, 0U);
-            DTHE_SHA512_setHMACOuterHash(ptrShaRegs, 0U);
-        }
+    if((NULL == handle) || (NULL == ptrShaParams) || ((NULL == ptrSegments) && (numSegments != 0U)))
+    {
+        status = DTHE_SHA_RETURN_FAILURE;
+    }
+    else
+    {
+        status = DTHE_SHA_reapJob();
+    }
+
+    if(status == DTHE_SHA_RETURN_SUCCESS)
+    {
+        status = DTHE_SHA_checkContext(ptrShaParams);
+    }
+
+    if(status == DTHE_SHA_RETURN_SUCCESS)
+    {
+        config              = (DTHE_Config *) handle;
+        attrs               = config->attrs;
+        ptrShaRegs          = (CSL_EIP57T_SHARegs *)attrs->shaBaseAddr;
+        dataLenBytes        = DTHE_getSegmentsLength(ptrSegments, numSegments);
+
+        DTHE_SHA_setAlgorithm(ptrShaRegs, ptrShaParams->algoType);
 
-        /* Write the length of the data: */
         if (ptrShaParams->algoType == DTHE_SHA_ALGO_SHA256)
         {
-            /* SHA256: Setup the block & shift size: */
-            blockSize = DTHE_SHA256_BLOCK_SIZE;
-            shiftSize = DTHE_SHA256_SHIFT_SIZE;
-
-            /* Set the data length: */
-            DTHE_SHA_setHashLength(ptrShaRegs, dataLenBytes);
+            blockSizeBytes = DTHE_SHA256_BLOCK_SIZE * sizeof(uint32_t);
         }
         else
         {
-            /* SHA512: Setup the block & shift size: */
-            blockSize = DTHE_SHA512_BLOCK_SIZE;
-            shiftSize = DTHE_SHA512_SHIFT_SIZE;
+            blockSizeBytes = DTHE_SHA512_BLOCK_SIZE * sizeof(uint32_t);
+        }
+        numBlocks = dataLenBytes / blockSizeBytes;
 
-            /* Set the data length: */
-            DTHE_SHA512_setHashLength(ptrShaRegs, dataLenBytes);
+        /* Sanity Checking: Any list except the last one should be aligned as per the SHA Size. */
+        if ((isLastBlock == FALSE) && ((dataLenBytes % blockSizeBytes) != 0U))
+        {
+            status = DTHE_SHA_RETURN_FAILURE;
         }
+    }
 
-        /* Determine the data length in words: */
-        dataLenWords = dataLenBytes / 4U;
+    /* Perform the SHA Computation */
+    if (status == DTHE_SHA_RETURN_SUCCESS)
+    {
+        /* Ensure that the SHA IP Block is ready to receive data: */
+        DTHE_SHA_pollContextReady (ptrShaRegs);
 
-        /* Compute the number of blocks: */
-        numBlocks = dataLenWords / blockSize;
+        /* Program the hash mode and the length of the whole list: */
+        blockSize = DTHE_SHA_setupHashMode(ptrShaRegs, attrs, DTHE_SHA_getContext(ptrShaParams),
+                                           ptrShaParams->algoType, dataLenBytes, isLastBlock);
 
-        /* Compute the number of partial words which need to be handled seperately */
-        numPartialWords = dataLenWords % blockSize;
+        if ((config->dmaEnable == DMA_ENABLE) && (numBlocks > 0U))
+        {
+            useDma = 1U;
+            if (DTHE_buildDmaList(ptrSegments, numSegments, blockSizeBytes, numBlocks,
+                                  (uint8_t *)&gDTHESHASgBounce[0U], TRUE, &dmaList) != DTHE_RETURN_SUCCESS)
+            {
+                /* List too fragmented for the PaRAM sets: fall back to the CPU */
+                useDma = 0U;
+            }
+        }
 
-        if ((config->dmaEnable == DMA_ENABLE) && numBlocks > 0U)
+        if (useDma == 1U)
         {
+            CacheP_wb((void *)&gDTHESHASgBounce[0U], sizeof(gDTHESHASgBounce), CacheP_TYPE_ALLD);
+
             dmaHandle = DMA_open(0);
 
-            DMA_Config_TxChannel(dmaHandle, ptrShaParams->ptrDataBuffer, (uint32_t *)&ptrShaRegs->DATA_IN[0], numBlocks, blockSize, DMA_SHA_ENABLE);
+            if (DMA_Config_TxSgChannel(dmaHandle, &dmaList.entries[0U], dmaList.numEntries,
+                                       (uint32_t *)&ptrShaRegs->DATA_IN[0], blockSize, DMA_SHA_ENABLE) != DMA_RETURN_SUCCESS)
+            {
+                /* No link PaRAM set left for the list: release the ones taken and fall back to the CPU */
+                DMA_disableTxCh(dmaHandle, DMA_SHA_ENABLE);
+                useDma = 0U;
+            }
+        }
 
-            /* Compute the number of full blocks which need to be processed: */
-            DMA_enableTxTransferRegion(dmaHandle);
+        if (useDma == 1U)
+        {
+            DMA_enableTxTransferRegion(dmaHandle, DMA_SHA_ENABLE);
 
             DTHE_SHA_setDMA(ptrShaRegs, 1);
 
-            DMA_WaitForTxTransfer(dmaHandle);
-            
-            DTHE_SHA_setDMA(ptrShaRegs, 0);
+            DMA_WaitForTxTransfer(dmaHandle, DMA_SHA_ENABLE);
 
-            DMA_disableTxCh(dmaHandle);
+            DTHE_SHA_setDMA(ptrShaRegs, 0);
 
-            /* Compute the number of bytes which have been processed: */
-            numBytes = numBytes + (numBlocks * blockSize * sizeof(uint32_t));
-            index = numBlocks;
+            DMA_disableTxCh(dmaHandle, DMA_SHA_ENABLE);
         }
         else
         {
-            /* Compute the number of full blocks which need to be processed: */
             for (index = 0U; index < numBlocks; index = index + 1U)
             {
+                DTHE_gatherSegments(ptrSegments, numSegments, index * blockSizeBytes, (uint8_t *)&tailWords[0U], blockSizeBytes);
+
                 /* Ensure that the SHA IP Block is ready to receive data: */
                 DTHE_SHA_pollInputReady(ptrShaRegs);
 
                 /* Write the data block: */
-                DTHE_SHA_writeDataBlock(ptrShaRegs,
-                                        &ptrShaParams->ptrDataBuffer[index << shiftSize],
-                                        blockSize);
-
-                /* Compute the number of bytes which have been processed: */
-                numBytes = numBytes + (blockSize * sizeof(uint32_t));
+                DTHE_SHA_writeDataBlock(ptrShaRegs, &tailWords[0U], blockSize);
             }
         }
 
-        /* Process any left over data: */
-        if (numPartialWords != 0U)
+        /* Process any left over data as zero padded words: */
+        tailLen = dataLenBytes - (numBlocks * blockSizeBytes);
+        if (tailLen != 0U)
         {
+            (void)memset((void *)&tailWords[0U], 0, sizeof(tailWords));
+            DTHE_gatherSegments(ptrSegments, numSegments, numBlocks * blockSizeBytes, (uint8_t *)&tailWords[0U], tailLen);
+
             /* Ensure that the SHA IP Block is ready to receive data: */
             DTHE_SHA_pollInputReady(ptrShaRegs);
 
             /* Write the data block: */
-            DTHE_SHA_writeDataBlock(ptrShaRegs,
-                                    &ptrShaParams->ptrDataBuffer[index << shiftSize],
-                                    (uint8_t)numPartialWords);
-
-            /* Compute the number of bytes which have been processed: */
-            numBytes = numBytes + (numPartialWords * sizeof(uint32_t));
+            DTHE_SHA_writeDataBlock(ptrShaRegs, &tailWords[0U], (uint8_t)((tailLen + 3U) / 4U));
         }
 
-        /* Do we need to account for some additional bytes? */
-        if (dataLenBytes != numBytes)
-        {
-            /* Get the pointer to the data buffer in bytes which will be written: */
-            ptrByteDataBuffer = (uint8_t*)ptrShaParams->ptrDataBuffer;
+        /* Read back the digest once the engine is done: */
+        DTHE_SHA_readResult(ptrShaRegs, attrs, DTHE_SHA_getContext(ptrShaParams), ptrShaParams, isLastBlock);
+    }
+    return (status);
+}
 
-            /* Copy into the partial word: */
-            (void)memcpy ((void *)&partialWord, (void *)&ptrByteDataBuffer[numBytes], (dataLenBytes - numBytes));
+DTHE_SHA_Return_t DTHE_SHA_submit(DTHE_Handle handle, DTHE_SHA_Params* ptrShaParams, int32_t isLastBlock,
+                                  DTHE_SHA_JobCallback callback, void *args, DTHE_JobToken *ptrToken)
+{
+    DTHE_SHA_Return_t       status = DTHE_SHA_RETURN_FAILURE;
+    DTHE_SHA_Job            *ptrJob = &gDTHESHAJob;
+    DTHE_Config             *config = NULL;
+    CSL_EIP57T_SHARegs      *ptrShaRegs = NULL;
+    uint32_t                blockSizeBytes;
+    uint8_t                 blockSize;
+    DMA_Return_t            dmaStatus;
 
-            /* Ensure that the SHA IP Block is ready to receive data: */
-            DTHE_SHA_pollInputReady(ptrShaRegs);
+    if((NULL != handle) && (NULL != ptrShaParams) && (NULL != ptrToken))
+    {
+        status = DTHE_SHA_reapJob();
+    }
 
-            /* Write the data block: */
-            DTHE_SHA_writeDataBlock(ptrShaRegs, &partialWord, 1U);
-        }
+    if(status == DTHE_SHA_RETURN_SUCCESS)
+    {
+        status = DTHE_SHA_checkContext(ptrShaParams);
+    }
 
-        /* Poll till the intermediate hash results are available: */
-        DTHE_SHA_pollOutputReady (ptrShaRegs);
+    if(status == DTHE_SHA_RETURN_SUCCESS)
+    {
+        config              = (DTHE_Config *) handle;
+        ptrShaRegs          = (CSL_EIP57T_SHARegs *)config->attrs->shaBaseAddr;
 
-        /* Get the digest count and value: */
         if (ptrShaParams->algoType == DTHE_SHA_ALGO_SHA256)
         {
-            DTHE_SHA_getHashDigest(ptrShaRegs, &ptrShaParams->digest[0]);
-            gDTHESHAdigestCount = DTHE_SHA_getDigestCount(ptrShaRegs);
+            blockSize = DTHE_SHA256_BLOCK_SIZE;
         }
         else
         {
-            DTHE_SHA512_getHashDigest(ptrShaRegs, &ptrShaParams->digest[0]);
-            gDTHESHAdigestCount = DTHE_SHA512_getDigestCount(ptrShaRegs);
+            blockSize = DTHE_SHA512_BLOCK_SIZE;
         }
+        blockSizeBytes = (uint32_t)blockSize * sizeof(uint32_t);
 
-        if( isLastBlock == TRUE )
+        /* Jobs are completed from the DMA interrupt, which moves a bounded number of blocks; except for
+         * the last block the data must be block aligned */
+        if ((config->dmaEnable != DMA_ENABLE) || ((ptrShaParams->dataLenBytes / blockSizeBytes) > DTHE_JOB_MAX_BLOCKS) ||
+            ((isLastBlock == FALSE) && ((ptrShaParams->dataLenBytes % blockSizeBytes) != 0U)))
         {
-            /* SHA Computation is in progress: */
-            gDTHESHAInProgress = FALSE;
-        }
-        else
-        {
-            /* SHA Computation is in progress: */
-            gDTHESHAInProgress = TRUE;
+            status = DTHE_SHA_RETURN_FAILURE;
         }
     }
-    return (status);
-}
-
-DTHE_SHA_Return_t DTHE_HMACSHA_compute(DTHE_Handle handle, DTHE_SHA_Params* ptrShaParams)
-{
-    DTHE_SHA_Return_t       status = DTHE_SHA_RETURN_FAILURE;
-    DMA_Handle              dmaHandle = NULL;
-    uint32_t                index;
-    uint32_t                dataLenWords;
-    uint32_t                dataLenBytes;
-    uint8_t                 *ptrByteDataBuffer;
-    uint16_t                numBlocks;
-    uint8_t                 blockSize;
-    uint32_t                shiftSize;
-    uint32_t                numPartialWords;
-    uint32_t                partialWord = 0U;
-    uint32_t                numBytes    = 0U;
-    uint32_t                hmacPaddedKey[DTHE_HMAC_SHA_MAX_KEY_SIZE_BYTES/4U];
-    DTHE_Config             *config = NULL;
-    DTHE_Attrs              *attrs  = NULL;
-    CSL_EIP57T_SHARegs      *ptrShaRegs;
-
-    if((NULL != handle) && (NULL != ptrShaParams))
-    {
-        status = DTHE_SHA_RETURN_SUCCESS;
-    }
 
     if(status == DTHE_SHA_RETURN_SUCCESS)
     {
-        config              = (DTHE_Config *) handle;
-        attrs               = config->attrs;
-        ptrShaRegs          = (CSL_EIP57T_SHARegs *)attrs->shaBaseAddr;
-        dataLenBytes        = ptrShaParams->dataLenBytes;
-        DTHE_SHA_setAlgorithm(ptrShaRegs, ptrShaParams->algoType);
-        /* Sanity Check: The HMAC Key Size cannot be greater than the MAX allowed. */
-        if (ptrShaParams->keySize > DTHE_HMAC_SHA_MAX_KEY_SIZE_BYTES)
+        /* Drop a completion which was never waited for */
+        (void)SemaphoreP_pend(&ptrJob->doneSem, SystemP_NO_WAIT);
+
+        ptrJob->handle          = handle;
+        ptrJob->ptrShaParams    = ptrShaParams;
+        ptrJob->isLastBlock     = isLastBlock;
+        ptrJob->numBytes        = (ptrShaParams->dataLenBytes / blockSizeBytes) * blockSizeBytes;
+        ptrJob->callback        = callback;
+        ptrJob->args            = args;
+        ptrJob->dmaHandle       = NULL;
+        ptrJob->status          = DTHE_SHA_RETURN_FAILURE;
+
+        /* Token zero is never handed out */
+        ptrJob->token = ptrJob->token + 1U;
+        if (ptrJob->token == DTHE_JOB_TOKEN_INVALID)
         {
-            /* Long HMAC Keys are not supported. */
-            status = DTHE_SHA_RETURN_FAILURE;
+            ptrJob->token = 1U;
         }
+        *ptrToken = ptrJob->token;
 
-        if(status == DTHE_SHA_RETURN_SUCCESS)
+        /* Get the completion interrupt before the engine is programmed */
+        if (ptrJob->numBytes != 0U)
         {
-            /* Initialize the padded key */
-            (void)memset ((void *)&hmacPaddedKey[0], 0, sizeof(hmacPaddedKey));
+            dmaStatus         = DMA_RETURN_FAILURE;
+            ptrJob->dmaHandle = DMA_open(0);
 
-            /* Copy the key if one was provided: */
-            if (ptrShaParams->keySize != 0U)
+            if (ptrJob->dmaHandle != NULL)
             {
-                /* Copy the key data into the HMAC Padded Key: */
-                (void)memcpy ((void *)&hmacPaddedKey[0], (const void*)ptrShaParams->ptrKey, ptrShaParams->keySize);
+                dmaStatus = DMA_Config_TxChannel(ptrJob->dmaHandle, ptrShaParams->ptrDataBuffer, (uint32_t *)&ptrShaRegs->DATA_IN[0],
+                                                 (uint16_t)(ptrJob->numBytes / blockSizeBytes), blockSize, DMA_SHA_ENABLE);
             }
 
-            /* Which algorithm are we executing? */
-            if (ptrShaParams->algoType == DTHE_SHA_ALGO_SHA256)
+            if (dmaStatus == DMA_RETURN_SUCCESS)
             {
-                /* SHA256: Outer & Inner Keys are 256bits = 32bytes = 8words */
-                DTHE_SHA_setHMACOuterKey(ptrShaRegs, &hmacPaddedKey[0]);
-                DTHE_SHA_setHMACInnerKey(ptrShaRegs, &hmacPaddedKey[8]);
-
-                /* HMAC Processing:-
-                *  - Algorithm Constants are not used
-                *  - Compute the hash and close it here. */
-                DTHE_SHA_setUseAlgoConstants(ptrShaRegs, 0U);
-                DTHE_SHA_setCloseHash(ptrShaRegs, 1U);
-                DTHE_SHA_setHMACKeyProcessing(ptrShaRegs, 1U);
-                DTHE_SHA_setHMACOuterHash(ptrShaRegs, 1U);
-
-                /* Set the data length: */
-                DTHE_SHA_setHashLength(ptrShaRegs, dataLenBytes);
-
-                /* SHA256: Setup the block & shift size: */
-                blockSize = DTHE_SHA256_BLOCK_SIZE;
-                shiftSize = DTHE_SHA256_SHIFT_SIZE;
+                dmaStatus = DMA_registerTxCallback(ptrJob->dmaHandle, &DTHE_SHA_jobDmaComplete, (void *)ptrJob, DMA_SHA_ENABLE);
             }
-            else
+
+            if (dmaStatus != DMA_RETURN_SUCCESS)
             {
-                /* SHA512: Outer & Inner Keys are 512bits = 64bytes = 16words */
-                DTHE_SHA512_setHMACOuterKey(ptrShaRegs, &hmacPaddedKey[0]);
-                DTHE_SHA512_setHMACInnerKey(ptrShaRegs, &hmacPaddedKey[16]);
+                ptrJob->state = DTHE_SHA_JOB_STATE_DONE;
+                (void)DTHE_SHA_reapJob();
+                status = DTHE_SHA_RETURN_FAILURE;
+            }
+        }
+    }
 
-                /* HMAC Processing:-
-                *  - Algorithm Constants are not used
-                *  - Compute the hash and close it here. */
-                DTHE_SHA512_setUseAlgoConstants(ptrShaRegs, 0U);
-                DTHE_SHA512_setCloseHash(ptrShaRegs, 1U);
-                DTHE_SHA512_setHMACKeyProcessing(ptrShaRegs, 1U);
-                DTHE_SHA512_setHMACOuterHash(ptrShaRegs, 1U);
+    if(status == DTHE_SHA_RETURN_SUCCESS)
+    {
+        DTHE_SHA_setAlgorithm(ptrShaRegs, ptrShaParams->algoType);
 
-                /* Set the data length: */
-                DTHE_SHA512_setHashLength(ptrShaRegs, dataLenBytes);
+        /* Ensure that the SHA IP Block is ready to receive data: */
+        DTHE_SHA_pollContextReady (ptrShaRegs);
 
-                /* SHA512: Setup the block & shift size: */
-                blockSize = DTHE_SHA512_BLOCK_SIZE;
-                shiftSize = DTHE_SHA512_SHIFT_SIZE;
-            }
+        /* Program the hash mode and the length of the data: */
+        (void)DTHE_SHA_setupHashMode(ptrShaRegs, config->attrs, DTHE_SHA_getContext(ptrShaParams),
+                                     ptrShaParams->algoType, ptrShaParams->dataLenBytes, isLastBlock);
 
-            /* Determine the data length in words: */
-            dataLenWords = dataLenBytes / 4U;
+        ptrJob->state = DTHE_SHA_JOB_STATE_RUNNING;
 
-            /* Compute the number of blocks: */
-            numBlocks = dataLenWords / blockSize;
+        if (ptrJob->dmaHandle != NULL)
+        {
+            DMA_enableTxTransferRegion(ptrJob->dmaHandle, DMA_SHA_ENABLE);
 
-            /* Compute the number of partial words which need to be handled seperately */
-            numPartialWords = dataLenWords % blockSize;
+            DTHE_SHA_setDMA(ptrShaRegs, 1);
+        }
+        else
+        {
+            /* Less than a block of data: complete the job right away */
+            ptrJob->state = DTHE_SHA_JOB_STATE_DMA_DONE;
+            DTHE_SHA_finishJob(ptrJob);
 
-            if ((config->dmaEnable == DMA_ENABLE) && numBlocks > 0U)
+            if (ptrJob->callback != NULL)
             {
-                dmaHandle = DMA_open(0);
-
-                DMA_Config_TxChannel(dmaHandle, ptrShaParams->ptrDataBuffer, (uint32_t *)&ptrShaRegs->DATA_IN[0], numBlocks, blockSize, DMA_SHA_ENABLE);
+                ptrJob->callback(ptrJob->handle, ptrJob->token, ptrJob->status, ptrJob->args);
+            }
+        }
+    }
 
-                /* Compute the number of full blocks which need to be processed: */
-                DMA_enableTxTransferRegion(dmaHandle);
+    return (status);
+}
 
-                DTHE_SHA_setDMA(ptrShaRegs, 1);
+DTHE_SHA_Return_t DTHE_SHA_wait(DTHE_Handle handle, DTHE_JobToken token, uint32_t timeout)
+{
+    DTHE_SHA_Return_t       status = DTHE_SHA_RETURN_FAILURE;
+    DTHE_SHA_Job            *ptrJob = &gDTHESHAJob;
 
-                DMA_WaitForTxTransfer(dmaHandle);
+    if ((NULL != handle) && (token != DTHE_JOB_TOKEN_INVALID) && (token == ptrJob->token) &&
+        (ptrJob->state != DTHE_SHA_JOB_STATE_IDLE))
+    {
+        status = DTHE_SHA_RETURN_SUCCESS;
+    }
+
+    if ((status == DTHE_SHA_RETURN_SUCCESS) && (ptrJob->state == DTHE_SHA_JOB_STATE_RUNNING))
+    {
+        if (SemaphoreP_pend(&ptrJob->doneSem, timeout) != SystemP_SUCCESS)
+        {
+            /* Still running */
+            status = DTHE_SHA_RETURN_TIMEOUT;
+        }
+    }
+
+    if (status == DTHE_SHA_RETURN_SUCCESS)
+    {
+        /* Finishes the job if only its DMA is done */
+        (void)DTHE_SHA_reapJob();
+        status = ptrJob->status;
+    }
+
+    return (status);
+}
+
+DTHE_SHA_Return_t DTHE_SHA_init(DTHE_Handle handle, DTHE_SHA_Context* ptrContext, uint32_t algoType)
+{
+    DTHE_SHA_Return_t       status = DTHE_SHA_RETURN_FAILURE;
+
+    /* The context saves and restores the SHA-256 and SHA-512 family state only */
+    if((NULL != handle) && (NULL != ptrContext) &&
+       ((algoType == DTHE_SHA_ALGO_SHA256) || (algoType == DTHE_SHA_ALGO_SHA384) || (algoType == DTHE_SHA_ALGO_SHA512)))
+    {
+        status = DTHE_SHA_RETURN_SUCCESS;
+    }
+
+    if(status == DTHE_SHA_RETURN_SUCCESS)
+    {
+        DTHE_SHA_Context_init(ptrContext);
+        ptrContext->algoType = algoType;
+    }
+
+    return (status);
+}
+
+DTHE_SHA_Return_t DTHE_SHA_update(DTHE_Handle handle, DTHE_SHA_Context* ptrContext, const uint8_t* ptrData, uint32_t dataLenBytes)
+{
+    DTHE_SHA_Return_t       status = DTHE_SHA_RETURN_FAILURE;
+    DTHE_SHA_Params         shaParams;
+    uint32_t                blockSizeBytes;
+    uint32_t                numBytes;
+    uint8_t                 *ptrBuffer;
+
+    if((NULL != handle) && (NULL != ptrContext) && (ptrContext->algoType != 0U) &&
+       ((NULL != ptrData) || (dataLenBytes == 0U)))
+    {
+        status = DTHE_SHA_RETURN_SUCCESS;
+    }
+
+    if(status == DTHE_SHA_RETURN_SUCCESS)
+    {
+        blockSizeBytes = DTHE_SHA_getBlockSizeBytes(ptrContext->algoType);
+
+        (void)memset((void *)&shaParams, 0, sizeof(shaParams));
+        shaParams.algoType      = ptrContext->algoType;
+        shaParams.ptrContext    = ptrContext;
+        ptrBuffer               = (uint8_t *)&ptrContext->buffer[0U];
+    }
+
+    /* The last block is always kept in the context, so there is data left to close the hash with. */
+    while((status == DTHE_SHA_RETURN_SUCCESS) && (dataLenBytes != 0U))
+    {
+        if (ptrContext->bufferLenBytes == blockSizeBytes)
+        {
+            /* More data follows the buffered block: hash it */
+            CacheP_wb((void *)ptrBuffer, blockSizeBytes, CacheP_TYPE_ALLD);
+
+            shaParams.ptrDataBuffer = &ptrContext->buffer[0U];
+            shaParams.dataLenBytes  = blockSizeBytes;
+            status = DTHE_SHA_compute(handle, &shaParams, FALSE);
+            if (status == DTHE_SHA_RETURN_SUCCESS)
+            {
+                ptrContext->bufferLenBytes = 0U;
+            }
+        }
+        else if ((ptrContext->bufferLenBytes == 0U) && (dataLenBytes > blockSizeBytes) &&
+                 (((uintptr_t)ptrData & 3U) == 0U))
+        {
+            /* Hash the full blocks straight from the caller buffer, at most one DMA transfer at a time: */
+            numBytes = ((dataLenBytes - 1U) / blockSizeBytes) * blockSizeBytes;
+            if (numBytes > (DTHE_JOB_MAX_BLOCKS * blockSizeBytes))
+            {
+                numBytes = DTHE_JOB_MAX_BLOCKS * blockSizeBytes;
+            }
+
+            shaParams.ptrDataBuffer = (uint32_t *)ptrData;
+            shaParams.dataLenBytes  = numBytes;
+            status = DTHE_SHA_compute(handle, &shaParams, FALSE);
+
+            ptrData         = &ptrData[numBytes];
+            dataLenBytes    = dataLenBytes - numBytes;
+        }
+        else
+        {
+            /* Fill up the buffered block: */
+            numBytes = blockSizeBytes - ptrContext->bufferLenBytes;
+            if (numBytes > dataLenBytes)
+            {
+                numBytes = dataLenBytes;
+            }
+            (void)memcpy((void *)&ptrBuffer[ptrContext->bufferLenBytes], (const void *)ptrData, numBytes);
+
+            ptrContext->bufferLenBytes = ptrContext->bufferLenBytes + numBytes;
+            ptrData         = &ptrData[numBytes];
+            dataLenBytes    = dataLenBytes - numBytes;
+        }
+    }
+
+    return (status);
+}
+
+DTHE_SHA_Return_t DTHE_SHA_final(DTHE_Handle handle, DTHE_SHA_Context* ptrContext, uint32_t* ptrDigest)
+{
+    DTHE_SHA_Return_t       status = DTHE_SHA_RETURN_FAILURE;
+    DTHE_SHA_Params         shaParams;
+
+    if((NULL != handle) && (NULL != ptrContext) && (ptrContext->algoType != 0U) && (NULL != ptrDigest))
+    {
+        status = DTHE_SHA_RETURN_SUCCESS;
+    }
+
+    if(status == DTHE_SHA_RETURN_SUCCESS)
+    {
+        CacheP_wb((void *)&ptrContext->buffer[0U], sizeof(ptrContext->buffer), CacheP_TYPE_ALLD);
+
+        (void)memset((void *)&shaParams, 0, sizeof(shaParams));
+        shaParams.algoType      = ptrContext->algoType;
+        shaParams.ptrDataBuffer = &ptrContext->buffer[0U];
+        shaParams.dataLenBytes  = ptrContext->bufferLenBytes;
+        shaParams.ptrContext    = ptrContext;
+
+        /* Hash the buffered data and close the hash; this also resets the context */
+        status = DTHE_SHA_compute(handle, &shaParams, TRUE);
+    }
+
+    if(status == DTHE_SHA_RETURN_SUCCESS)
+    {
+        (void)memcpy((void *)ptrDigest, (const void *)&shaParams.digest[0U], sizeof(shaParams.digest));
+    }
+
+    return (status);
+}
+
+DTHE_SHA_Return_t DTHE_HMACSHA_compute(DTHE_Handle handle, DTHE_SHA_Params* ptrShaParams)
+{
+    DTHE_SHA_Return_t       status = DTHE_SHA_RETURN_FAILURE;
+    DMA_Handle              dmaHandle = NULL;
+    uint32_t                index;
+    uint32_t                dataLenWords;
+    uint32_t                dataLenBytes;
+    uint8_t                 *ptrByteDataBuffer;
+    uint16_t                numBlocks;
+    uint8_t                 blockSize;
+    uint32_t                shiftSize;
+    uint32_t                numPartialWords;
+    uint32_t                partialWord = 0U;
+    uint32_t                numBytes    = 0U;
+    uint32_t                hmacPaddedKey[DTHE_HMAC_SHA_MAX_KEY_SIZE_BYTES/4U];
+    DTHE_Config             *config = NULL;
+    DTHE_Attrs              *attrs  = NULL;
+    CSL_EIP57T_SHARegs      *ptrShaRegs;
+
+    if((NULL != handle) && (NULL != ptrShaParams))
+    {
+        status = DTHE_SHA_reapJob();
+    }
+
+    if(status == DTHE_SHA_RETURN_SUCCESS)
+    {
+        config              = (DTHE_Config *) handle;
+        attrs               = config->attrs;
+        ptrShaRegs          = (CSL_EIP57T_SHARegs *)attrs->shaBaseAddr;
+        dataLenBytes        = ptrShaParams->dataLenBytes;
+        DTHE_SHA_setAlgorithm(ptrShaRegs, ptrShaParams->algoType);
+        /* Sanity Check: The HMAC Key Size cannot be greater than the MAX allowed. */
+        if (ptrShaParams->keySize > DTHE_HMAC_SHA_MAX_KEY_SIZE_BYTES)
+        {
+            /* Long HMAC Keys are not supported. */
+            status = DTHE_SHA_RETURN_FAILURE;
+        }
+
+        if(status == DTHE_SHA_RETURN_SUCCESS)
+        {
+            /* Initialize the padded key */
+            (void)memset ((void *)&hmacPaddedKey[0], 0, sizeof(hmacPaddedKey));
+
+            /* Copy the key if one was provided: */
+            if (ptrShaParams->keySize != 0U)
+            {
+                /* Copy the key data into the HMAC Padded Key: */
+                (void)memcpy ((void *)&hmacPaddedKey[0], (const void*)ptrShaParams->ptrKey, ptrShaParams->keySize);
+            }
+
+            /* Which algorithm are we executing? */
+            if (ptrShaParams->algoType == DTHE_SHA_ALGO_SHA256)
+            {
+                /* SHA256: Outer & Inner Keys are 256bits = 32bytes = 8words */
+                DTHE_SHA_setHMACOuterKey(ptrShaRegs, &hmacPaddedKey[0]);
+                DTHE_SHA_setHMACInnerKey(ptrShaRegs, &hmacPaddedKey[8]);
+
+                /* HMAC Processing:-
+                *  - Algorithm Constants are not used
+                *  - Compute the hash and close it here. */
+                DTHE_SHA_setUseAlgoConstants(ptrShaRegs, 0U);
+                DTHE_SHA_setCloseHash(ptrShaRegs, 1U);
+                DTHE_SHA_setHMACKeyProcessing(ptrShaRegs, 1U);
+                DTHE_SHA_setHMACOuterHash(ptrShaRegs, 1U);
+
+                /* Set the data length: */
+                DTHE_SHA_setHashLength(ptrShaRegs, dataLenBytes);
+
+                /* SHA256: Setup the block & shift size: */
+                blockSize = DTHE_SHA256_BLOCK_SIZE;
+                shiftSize = DTHE_SHA256_SHIFT_SIZE;
+            }
+            else
+            {
+                /* SHA512: Outer & Inner Keys are 512bits = 64bytes = 16words */
+                DTHE_SHA512_setHMACOuterKey(ptrShaRegs, &hmacPaddedKey[0]);
+                DTHE_SHA512_setHMACInnerKey(ptrShaRegs, &hmacPaddedKey[16]);
+
+                /* HMAC Processing:-
+                *  - Algorithm Constants are not used
+                *  - Compute the hash and close it here. */
+                DTHE_SHA512_setUseAlgoConstants(ptrShaRegs, 0U);
+                DTHE_SHA512_setCloseHash(ptrShaRegs, 1U);
+                DTHE_SHA512_setHMACKeyProcessing(ptrShaRegs, 1U);
+                DTHE_SHA512_setHMACOuterHash(ptrShaRegs, 1U);
+
+                /* Set the data length: */
+                DTHE_SHA512_setHashLength(ptrShaRegs, dataLenBytes);
+
+                /* SHA512: Setup the block & shift size: */
+                blockSize = DTHE_SHA512_BLOCK_SIZE;
+                shiftSize = DTHE_SHA512_SHIFT_SIZE;
+            }
+
+            /* Determine the data length in words: */
+            dataLenWords = dataLenBytes / 4U;
+
+            /* Compute the number of blocks: */
+            numBlocks = dataLenWords / blockSize;
+
+            /* Compute the number of partial words which need to be handled seperately */
+            numPartialWords = dataLenWords % blockSize;
+
+            if ((config->dmaEnable == DMA_ENABLE) && numBlocks > 0U)
+            {
+                dmaHandle = DMA_open(0);
+
+                DMA_Config_TxChannel(dmaHandle, ptrShaParams->ptrDataBuffer, (uint32_t *)&ptrShaRegs->DATA_IN[0], numBlocks, blockSize, DMA_SHA_ENABLE);
+
+                /* Compute the number of full blocks which need to be processed: */
+                DMA_enableTxTransferRegion(dmaHandle, DMA_SHA_ENABLE);
+
+                DTHE_SHA_setDMA(ptrShaRegs, 1);
+
+                DMA_WaitForTxTransfer(dmaHandle, DMA_SHA_ENABLE);
 
                 DTHE_SHA_setDMA(ptrShaRegs, 0);
 
-                DMA_disableTxCh(dmaHandle);
+                DMA_disableTxCh(dmaHandle, DMA_SHA_ENABLE);
 
                 /* Compute the number of bytes which have been processed: */
                 numBytes = numBytes + (numBlocks * blockSize * sizeof(uint32_t));
@@ -591,483 +929,1275 @@ DTHE_SHA_Return_t DTHE_HMACSHA_compute(DTHE_Handle handle, DTHE_SHA_Params* ptrS
             /* Poll till the intermediate hash results are available: */
             DTHE_SHA_pollOutputReady (ptrShaRegs);
 
-            /* Get the digest count and value: */
+            /* Get the digest value: */
             if (ptrShaParams->algoType == DTHE_SHA_ALGO_SHA256)
             {
                 DTHE_SHA_getHashDigest(ptrShaRegs, &ptrShaParams->digest[0]);
-                gDTHESHAdigestCount = DTHE_SHA_getDigestCount(ptrShaRegs);
             }
             else
             {
                 DTHE_SHA512_getHashDigest(ptrShaRegs, &ptrShaParams->digest[0]);
-                gDTHESHAdigestCount = DTHE_SHA512_getDigestCount(ptrShaRegs);
             }
 
-            /* SHA Computation is in progress: */
-            gDTHESHAInProgress = FALSE;
-        }
+            /* The HMAC keys replaced the digest of the loaded context; it is restored on its next block */
+            attrs->shaActiveCtx = NULL;
+        }
+    }
+    return (status);
+}
+DTHE_SHA_Return_t DTHE_HMACSHA_setupKey(DTHE_Handle handle, DTHE_HMACSHA_Key* ptrHmacKey, uint32_t algoType,
+                                        const uint32_t* ptrKey, uint32_t keySize)
+{
+    DTHE_SHA_Return_t       status = DTHE_SHA_RETURN_FAILURE;
+    DTHE_SHA_Context        keyContext;
+    DTHE_SHA_Params         shaParams;
+    uint32_t                keyBlock[DTHE_SHA_MAX_BLOCK_SIZE_BYTES/4U];
+    uint32_t                padBlock[DTHE_SHA_MAX_BLOCK_SIZE_BYTES/4U];
+    uint32_t                blockSizeBytes;
+    uint32_t                index;
+    DTHE_Config             *config = NULL;
+
+    if((NULL != handle) && (NULL != ptrHmacKey) && ((NULL != ptrKey) || (keySize == 0U)))
+    {
+        status = DTHE_SHA_RETURN_SUCCESS;
+    }
+
+    if(status == DTHE_SHA_RETURN_SUCCESS)
+    {
+        config          = (DTHE_Config *) handle;
+        blockSizeBytes  = DTHE_SHA_getBlockSizeBytes(algoType);
+
+        (void)memset((void *)&keyBlock[0], 0, sizeof(keyBlock));
+        (void)memset((void *)&shaParams, 0, sizeof(shaParams));
+        shaParams.algoType      = algoType;
+        shaParams.ptrContext    = &keyContext;
+
+        if (keySize > blockSizeBytes)
+        {
+            /* Long keys are replaced by their hash: */
+            DTHE_SHA_Context_init(&keyContext);
+            shaParams.ptrDataBuffer = (uint32_t *)ptrKey;
+            shaParams.dataLenBytes  = keySize;
+            status = DTHE_SHA_compute(handle, &shaParams, TRUE);
+            (void)memcpy((void *)&keyBlock[0], (const void *)&shaParams.digest[0], DTHE_SHA_getDigestSizeBytes(algoType));
+        }
+        else if (keySize != 0U)
+        {
+            (void)memcpy((void *)&keyBlock[0], (const void *)ptrKey, keySize);
+        }
+        else
+        {
+            /* Empty key: all zero block */
+        }
+    }
+
+    /* Hash the inner (ipad) and the outer (opad) key blocks and keep the open hash states: */
+    if(status == DTHE_SHA_RETURN_SUCCESS)
+    {
+        for (index = 0U; index < (blockSizeBytes / 4U); index++)
+        {
+            padBlock[index] = keyBlock[index] ^ 0x36363636U;
+        }
+        CacheP_wb((void *)&padBlock[0], sizeof(padBlock), CacheP_TYPE_ALLD);
+
+        DTHE_SHA_Context_init(&keyContext);
+        shaParams.ptrDataBuffer = &padBlock[0];
+        shaParams.dataLenBytes  = blockSizeBytes;
+        status = DTHE_SHA_compute(handle, &shaParams, FALSE);
+        (void)memcpy((void *)&ptrHmacKey->innerDigest[0], (const void *)&shaParams.digest[0], sizeof(ptrHmacKey->innerDigest));
+    }
+
+    if(status == DTHE_SHA_RETURN_SUCCESS)
+    {
+        for (index = 0U; index < (blockSizeBytes / 4U); index++)
+        {
+            padBlock[index] = keyBlock[index] ^ 0x5C5C5C5CU;
+        }
+        CacheP_wb((void *)&padBlock[0], sizeof(padBlock), CacheP_TYPE_ALLD);
+
+        DTHE_SHA_Context_init(&keyContext);
+        status = DTHE_SHA_compute(handle, &shaParams, FALSE);
+        (void)memcpy((void *)&ptrHmacKey->outerDigest[0], (const void *)&shaParams.digest[0], sizeof(ptrHmacKey->outerDigest));
+
+        ptrHmacKey->algoType = algoType;
+    }
+
+    if(config != NULL)
+    {
+        /* The key context lives on the stack: it cannot stay loaded in the engine */
+        if (config->attrs->shaActiveCtx == (void *)&keyContext)
+        {
+            config->attrs->shaActiveCtx = NULL;
+        }
+
+        /* Do not leave the key material behind */
+        (void)memset((void *)&keyBlock[0], 0, sizeof(keyBlock));
+        (void)memset((void *)&padBlock[0], 0, sizeof(padBlock));
+        (void)memset((void *)&keyContext, 0, sizeof(keyContext));
+        (void)memset((void *)&shaParams, 0, sizeof(shaParams));
+    }
+
+    return (status);
+}
+
+DTHE_SHA_Return_t DTHE_HMACSHA_computeWithKey(DTHE_Handle handle, const DTHE_HMACSHA_Key* ptrHmacKey,
+                                              DTHE_SHA_Params* ptrShaParams)
+{
+    DTHE_SHA_Return_t       status = DTHE_SHA_RETURN_FAILURE;
+    uint8_t                 blockSize;
+    DTHE_Config             *config = NULL;
+    DTHE_Attrs              *attrs  = NULL;
+    CSL_EIP57T_SHARegs      *ptrShaRegs;
+
+    if((NULL != handle) && (NULL != ptrHmacKey) && (NULL != ptrShaParams) && (ptrHmacKey->algoType != 0U))
+    {
+        status = DTHE_SHA_reapJob();
+    }
+
+    if(status == DTHE_SHA_RETURN_SUCCESS)
+    {
+        config              = (DTHE_Config *) handle;
+        attrs               = config->attrs;
+        ptrShaRegs          = (CSL_EIP57T_SHARegs *)attrs->shaBaseAddr;
+
+        DTHE_SHA_setAlgorithm(ptrShaRegs, ptrHmacKey->algoType);
+
+        /* Ensure that the SHA IP Block is ready to receive data: */
+        DTHE_SHA_pollContextReady (ptrShaRegs);
+
+        /* HMAC Processing with the processed key:-
+         *  - Inner and outer digests hold the states after the padded key blocks
+         *  - The digest count accounts for the key block which was already hashed
+         *  - Algorithm Constants are not used, no key processing
+         *  - Compute the inner hash, close it and run the outer hash here. */
+        if (ptrHmacKey->algoType == DTHE_SHA_ALGO_SHA256)
+        {
+            DTHE_SHA_setHMACOuterKey(ptrShaRegs, &ptrHmacKey->outerDigest[0]);
+            DTHE_SHA_setHashDigest(ptrShaRegs, &ptrHmacKey->innerDigest[0]);
+            DTHE_SHA_setDigestCount(ptrShaRegs, DTHE_SHA256_BLOCK_SIZE * sizeof(uint32_t));
+
+            DTHE_SHA_setUseAlgoConstants(ptrShaRegs, 0U);
+            DTHE_SHA_setCloseHash(ptrShaRegs, 1U);
+            DTHE_SHA_setHMACKeyProcessing(ptrShaRegs, 0U);
+            DTHE_SHA_setHMACOuterHash(ptrShaRegs, 1U);
+
+            /* Set the data length: */
+            DTHE_SHA_setHashLength(ptrShaRegs, ptrShaParams->dataLenBytes);
+            blockSize = DTHE_SHA256_BLOCK_SIZE;
+        }
+        else
+        {
+            DTHE_SHA512_setHMACOuterKey(ptrShaRegs, &ptrHmacKey->outerDigest[0]);
+            DTHE_SHA512_setHashDigest(ptrShaRegs, &ptrHmacKey->innerDigest[0]);
+            DTHE_SHA512_setDigestCount(ptrShaRegs, DTHE_SHA512_BLOCK_SIZE * sizeof(uint32_t));
+
+            DTHE_SHA512_setUseAlgoConstants(ptrShaRegs, 0U);
+            DTHE_SHA512_setCloseHash(ptrShaRegs, 1U);
+            DTHE_SHA512_setHMACKeyProcessing(ptrShaRegs, 0U);
+            DTHE_SHA512_setHMACOuterHash(ptrShaRegs, 1U);
+
+            /* Set the data length: */
+            DTHE_SHA512_setHashLength(ptrShaRegs, ptrShaParams->dataLenBytes);
+            blockSize = DTHE_SHA512_BLOCK_SIZE;
+        }
+
+        /* Write the message to the engine: */
+        DTHE_SHA_writeData(config, ptrShaRegs, ptrShaParams->ptrDataBuffer, ptrShaParams->dataLenBytes, blockSize);
+
+        /* Poll till the hash results are available: */
+        DTHE_SHA_pollOutputReady (ptrShaRegs);
+
+        if (ptrHmacKey->algoType == DTHE_SHA_ALGO_SHA256)
+        {
+            DTHE_SHA_getHashDigest(ptrShaRegs, &ptrShaParams->digest[0]);
+        }
+        else
+        {
+            DTHE_SHA512_getHashDigest(ptrShaRegs, &ptrShaParams->digest[0]);
+        }
+
+        /* The processed key replaced the digest of the loaded context; it is restored on its next block */
+        attrs->shaActiveCtx = NULL;
+    }
+
+    return (status);
+}
+
+DTHE_SHA_Return_t DTHE_HMACSHA_init(DTHE_Handle handle, DTHE_HMACSHA_Context* ptrContext, const DTHE_HMACSHA_Key* ptrHmacKey)
+{
+    DTHE_SHA_Return_t       status = DTHE_SHA_RETURN_FAILURE;
+    DTHE_Config             *config = NULL;
+
+    if((NULL != ptrContext) && (NULL != ptrHmacKey) && (ptrHmacKey->algoType != 0U))
+    {
+        status = DTHE_SHA_init(handle, &ptrContext->innerContext, ptrHmacKey->algoType);
+    }
+
+    if(status == DTHE_SHA_RETURN_SUCCESS)
+    {
+        config = (DTHE_Config *) handle;
+
+        /* The inner hash continues from the state after the inner padded key block: */
+        (void)memcpy((void *)&ptrContext->innerContext.digest[0], (const void *)&ptrHmacKey->innerDigest[0],
+                     sizeof(ptrContext->innerContext.digest));
+        ptrContext->innerContext.digestCount    = DTHE_SHA_getBlockSizeBytes(ptrHmacKey->algoType);
+        ptrContext->innerContext.state          = DTHE_SHA_CONTEXT_STATE_IN_PROGRESS;
+        (void)memcpy((void *)&ptrContext->outerDigest[0], (const void *)&ptrHmacKey->outerDigest[0],
+                     sizeof(ptrContext->outerDigest));
+
+        /* The engine may still hold an older hash of this context: force the state to be loaded */
+        if (config->attrs->shaActiveCtx == (void *)&ptrContext->innerContext)
+        {
+            config->attrs->shaActiveCtx = NULL;
+        }
+    }
+
+    return (status);
+}
+
+DTHE_SHA_Return_t DTHE_HMACSHA_update(DTHE_Handle handle, DTHE_HMACSHA_Context* ptrContext, const uint8_t* ptrData, uint32_t dataLenBytes)
+{
+    DTHE_SHA_Return_t       status = DTHE_SHA_RETURN_FAILURE;
+
+    if(NULL != ptrContext)
+    {
+        status = DTHE_SHA_update(handle, &ptrContext->innerContext, ptrData, dataLenBytes);
+    }
+
+    return (status);
+}
+
+DTHE_SHA_Return_t DTHE_HMACSHA_final(DTHE_Handle handle, DTHE_HMACSHA_Context* ptrContext, uint32_t* ptrMac)
+{
+    DTHE_SHA_Return_t       status = DTHE_SHA_RETURN_FAILURE;
+    DTHE_SHA_Context        outerContext;
+    DTHE_SHA_Params         shaParams;
+    uint32_t                innerHash[DTHE_SHA_MAX_DIGEST_SIZE_BYTES/4U];
+    uint32_t                algoType = 0U;
+
+    if((NULL != ptrContext) && (NULL != ptrMac) && (ptrContext->innerContext.algoType != 0U))
+    {
+        algoType = ptrContext->innerContext.algoType;
+
+        /* Close the inner hash: */
+        status = DTHE_SHA_final(handle, &ptrContext->innerContext, &innerHash[0]);
+    }
+
+    if(status == DTHE_SHA_RETURN_SUCCESS)
+    {
+        /* The outer hash continues from the state after the outer padded key block: */
+        DTHE_SHA_Context_init(&outerContext);
+        (void)memcpy((void *)&outerContext.digest[0], (const void *)&ptrContext->outerDigest[0], sizeof(outerContext.digest));
+        outerContext.algoType       = algoType;
+        outerContext.digestCount    = DTHE_SHA_getBlockSizeBytes(algoType);
+        outerContext.state          = DTHE_SHA_CONTEXT_STATE_IN_PROGRESS;
+
+        (void)memset((void *)&shaParams, 0, sizeof(shaParams));
+        shaParams.algoType      = algoType;
+        shaParams.ptrDataBuffer = &innerHash[0];
+        shaParams.dataLenBytes  = DTHE_SHA_getDigestSizeBytes(algoType);
+        shaParams.ptrContext    = &outerContext;
+
+        /* Less than a block: no DMA, and the closed context is not left loaded in the engine */
+        status = DTHE_SHA_compute(handle, &shaParams, TRUE);
+    }
+
+    if(status == DTHE_SHA_RETURN_SUCCESS)
+    {
+        (void)memcpy((void *)ptrMac, (const void *)&shaParams.digest[0], sizeof(shaParams.digest));
+    }
+
+    /* Closing the inner hash resets its context; from then on the HMAC cannot be retried */
+    if((algoType != 0U) && (algoType != ptrContext->innerContext.algoType))
+    {
+        /* Do not leave the key states behind */
+        (void)memset((void *)ptrContext, 0, sizeof(DTHE_HMACSHA_Context));
+        (void)memset((void *)&innerHash[0], 0, sizeof(innerHash));
+        (void)memset((void *)&outerContext, 0, sizeof(outerContext));
+    }
+
+    return (status);
+}
+
+/* ========================================================================== */
+/*                         Internal Function Definitions                      */
+/* ========================================================================== */
+/**
+ *  \brief  The function is used to enable/disable the interrupts
+ *
+ *  \param  ptrSHARegs      Pointer to the EIP57T SHA Registers
+ *
+ *  \param  intStatus       Flag which is used to enable(1)/disable(0) the interrupts
+ *
+ */
+static void DTHE_SHA_setInterruptStatus(CSL_EIP57T_SHARegs* ptrSHARegs, uint8_t intStatus)
+{
+    CSL_FINSR(ptrSHARegs->SYSCONFIG, 2U, 2U, intStatus);
+    return;
+}
+
+
+/**
+ *  \brief  The function is used to enable/disable the DMA
+ *
+ *  \param  ptrSHARegs      Pointer to the EIP57T SHA Registers
+ *
+ *  \param  dmaStatus       Flag which is used to enable(1)/disable(0) the DMA operation
+ *
+ */
+static void DTHE_SHA_setDMA(CSL_EIP57T_SHARegs* ptrSHARegs, uint8_t dmaStatus)
+{
+    /* SDMA_en */
+    CSL_FINSR (ptrSHARegs->SYSCONFIG, 3U, 3U, dmaStatus);
+}
+
+/**
+ *  \brief  The function is used to poll until the SHA IP block is ready to
+ *          receive the context
+ *
+ *  \param  ptrSHARegs      Pointer to the SHA Driver Context Object
+ *
+ */
+static void DTHE_SHA_pollContextReady(CSL_EIP57T_SHARegs* ptrSHARegs)
+{
+    uint8_t     done = 0U;
+
+    /* Loop around till the condition is met: */
+    while (done == 0U)
+    {
+        done = DTHE_SHA_isContextReadyIRQ(ptrSHARegs);
+    }
+    return;
+}
+
+/**
+ *  \brief  The function is used to get the context ready IRQ status
+ *
+ *  \param  ptrSHARegs      Pointer to the EIP57T SHA Registers
+ *
+ *  \retval                 1 - Available for a new context
+ *                          0 - Not available for a new context
+ */
+static uint8_t DTHE_SHA_isContextReadyIRQ(const CSL_EIP57T_SHARegs* ptrSHARegs)
+{
+    return CSL_FEXTR (ptrSHARegs->IRQSTATUS, 3U, 3U);
+}
+
+/**
+ *  \brief  The function is used to enable/disable the usage of the algorithm
+ *      constants
+ *
+ *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
+ *  \param useAlgConstants  Flag which will use enable(1)/disable(0) the usage of the algorithm constants
+ *
+ */
+static void DTHE_SHA_setUseAlgoConstants(CSL_EIP57T_SHARegs* ptrSHARegs, uint8_t useAlgConstants)
+{
+    CSL_FINSR (ptrSHARegs->HASH_MODE, 3U, 3U, useAlgConstants);
+    return;
+}
+
+/**
+ *  \brief  The function is used to close/continue the hash algorithm
+ *
+ *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
+ *  \param closeHashFlag    Flag which will close(1)/continue(0) the hash algorithm
+ *
+ */
+static void DTHE_SHA_setCloseHash(CSL_EIP57T_SHARegs* ptrSHARegs, uint8_t closeHashFlag)
+{
+    CSL_FINSR (ptrSHARegs->HASH_MODE, 4U, 4U, closeHashFlag);
+    return;
+}
+
+/**
+ *  \brief The function is used to set the HMAC Key processing
+ *
+ *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
+ *  \param hmacKeyFlag      Flag which will enable(1)/disable(0) the HMAC key processing
+ *
+ */
+static void DTHE_SHA_setHMACKeyProcessing(CSL_EIP57T_SHARegs* ptrSHARegs, uint8_t hmacKeyFlag)
+{
+    CSL_FINSR (ptrSHARegs->HASH_MODE, 5U, 5U, hmacKeyFlag);
+    return;
+}
+
+/**
+ *  \brief  The function is used to set the HMAC Outer Hash flag
+ *
+ *  \param  ptrSHARegs      Pointer to the EIP57T SHA Registers
+ *  \param  hmacOuterHash   Flag which will enable(1)/disable(0) the HMAC outer hash is performed
+ *                          on the hash digest when the inner hash has finished
+ *
+ */
+static void DTHE_SHA_setHMACOuterHash(CSL_EIP57T_SHARegs* ptrSHARegs, uint8_t hmacOuterHash)
+{
+    CSL_FINSR (ptrSHARegs->HASH_MODE, 7U, 7U, hmacOuterHash);
+    return;
+}
+
+/**
+ *  \brief  The function is used to enable/disable the usage of the algorithm
+ *      constants
+ *
+ *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
+ *  \param useAlgConstants  Flag which will use enable(1)/disable(0) the usage of the algorithm constants
+ *
+ */
+static void DTHE_SHA512_setUseAlgoConstants(CSL_EIP57T_SHARegs* ptrSHARegs, uint8_t useAlgConstants)
+{
+    CSL_FINSR (ptrSHARegs->HASH512_MODE, 3U, 3U, useAlgConstants);
+    return;
+}
+
+/**
+ *  \brief  The function is used to close/continue the hash algorithm
+ *
+ *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
+ *  \param closeHashFlag    Flag which will close(1)/continue(0) the hash algorithm
+ *
+ */
+static void DTHE_SHA512_setCloseHash(CSL_EIP57T_SHARegs* ptrSHARegs, uint8_t closeHashFlag)
+{
+    CSL_FINSR (ptrSHARegs->HASH512_MODE, 4U, 4U, closeHashFlag);
+    return;
+}
+
+/**
+ *  \brief  The function is used to set the HMAC Key processing
+ *
+ *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
+ *  \param hmacKeyFlag      Flag which will enable(1)/disable(0) the HMAC key processing
+ *
+ */
+static void DTHE_SHA512_setHMACKeyProcessing(CSL_EIP57T_SHARegs* ptrSHARegs, uint8_t hmacKeyFlag)
+{
+    CSL_FINSR (ptrSHARegs->HASH512_MODE, 5U, 5U, hmacKeyFlag);
+    return;
+}
+
+/**
+ *  \brief  The function is used to set the HMAC Outer Hash flag
+ *
+ *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
+ *  \param hmacOuterHash    Flag which will enable(1)/disable(0) the HMAC outer hash is performed
+ *                          on the hash digest when the inner hash has finished
+ *
+ */
+static void DTHE_SHA512_setHMACOuterHash(CSL_EIP57T_SHARegs* ptrSHARegs, uint8_t hmacOuterHash)
+{
+    CSL_FINSR (ptrSHARegs->HASH_MODE, 7U, 7U, hmacOuterHash);
+    return;
+}
+
+/**
+ *  \brief  The function is used to set the length of the block to be processed
+ *          for the hash operation
+ *
+ *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
+ *  \param length           Length of the data
+ *
+ */
+static void DTHE_SHA_setHashLength(CSL_EIP57T_SHARegs* ptrSHARegs, uint32_t length)
+{
+    ptrSHARegs->LENGTH = length;
+    return;
+}
+
+/**
+ *  \brief  The function is used to set the length of the block to be processed
+ *          for the hash operation
+ *
+ *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
+ *  \param length           Length of the data
+ *
+ */
+static void DTHE_SHA512_setHashLength(CSL_EIP57T_SHARegs* ptrSHARegs, uint32_t length)
+{
+    ptrSHARegs->HASH512_LENGTH = length;
+    return;
+}
+
+/**
+ *  \brief  The function is used to poll until the SHA IP block is ready to
+ *          receive data
+ *
+ *  \param ptrSHARegs       Pointer to the SHA Driver Context Object
+ *
+ */
+static void DTHE_SHA_pollInputReady(CSL_EIP57T_SHARegs* ptrSHARegs)
+{
+    uint8_t     done = 0U;
+
+    /* Loop around till the condition is met: */
+    while (done == 0U)
+    {
+        done = DTHE_SHA_isInputReadyIRQ(ptrSHARegs);
+    }
+    return;
+}
+
+/**
+ *  \brief  The function is used write the data block. Data Block sizes
+ *          are specific to the size of algorithm selected.
+ *
+ *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
+ *  \param ptrDataBlock     Pointer to the data block to be written
+ *  \param blockSize        Block Size. This is selected on the basis of the algorithm.
+ *
+ */
+static void DTHE_SHA_writeDataBlock(CSL_EIP57T_SHARegs* ptrSHARegs, const uint32_t* ptrDataBlock, uint8_t blockSize)
+{
+    uint8_t index;
+    for (index = 0U; index < blockSize; index = index + 1U)
+    {
+        ptrSHARegs->DATA_IN[0] = ptrDataBlock[index];
+    }
+    return;
+}
+
+/**
+ *  \brief  The function is used to poll until the SHA IP block is ready with
+ *          the results
+ *
+ *  \param ptrSHARegs       Pointer to the SHA Driver Context Object
+ *
+ */
+static void DTHE_SHA_pollOutputReady (CSL_EIP57T_SHARegs* ptrSHARegs)
+{
+    uint8_t     done = 0U;
+
+    /* Loop around till the condition is met: */
+    while (done == 0U)
+    {
+        done = DTHE_SHA_isOutputReadyIRQ(ptrSHARegs);
     }
-    return (status);
+    return;
 }
-/* ========================================================================== */
-/*                         Internal Function Definitions                      */
-/* ========================================================================== */
+
 /**
- *  \brief  The function is used to enable/disable the interrupts
+ *  \brief  The function is used to get the hash inner digest for SHA-256.
+ *          The SHA Digest in this case is 32bytes.
  *
  *  \param  ptrSHARegs      Pointer to the EIP57T SHA Registers
- *
- *  \param  intStatus       Flag which is used to enable(1)/disable(0) the interrupts
+ *  \param  ptrDigest       Pointer to the digest populated by the API
  *
  */
-static void DTHE_SHA_setInterruptStatus(CSL_EIP57T_SHARegs* ptrSHARegs, uint8_t intStatus)
+static void DTHE_SHA_getHashDigest(const CSL_EIP57T_SHARegs* ptrSHARegs, uint32_t* ptrDigest)
 {
-    CSL_FINSR(ptrSHARegs->SYSCONFIG, 2U, 2U, intStatus);
+    uint8_t index;
+    for (index = 0U; index < 8U; index++)
+    {
+        ptrDigest[index] = ptrSHARegs->IDIGEST[index];
+    }
     return;
 }
 
-
 /**
- *  \brief  The function is used to enable/disable the DMA
+ *  \brief  The function is used to get the hash inner digest for SHA512.
+ *          The SHA Digest in this case is 64bytes.
  *
  *  \param  ptrSHARegs      Pointer to the EIP57T SHA Registers
- *
- *  \param  dmaStatus       Flag which is used to enable(1)/disable(0) the DMA operation
+ *  \param  ptrDigest       Pointer to the digest populated by the API
  *
  */
-static void DTHE_SHA_setDMA(CSL_EIP57T_SHARegs* ptrSHARegs, uint8_t dmaStatus)
+static void DTHE_SHA512_getHashDigest(const CSL_EIP57T_SHARegs* ptrSHARegs, uint32_t* ptrDigest)
 {
-    /* SDMA_en */
-    CSL_FINSR (ptrSHARegs->SYSCONFIG, 3U, 3U, dmaStatus);
+    uint8_t index;
+    for (index = 0U; index < 16U; index++)
+    {
+        ptrDigest[index] = ptrSHARegs->HASH512_IDIGEST[index];
+    }
+    return;
 }
 
 /**
- *  \brief  The function is used to poll until the SHA IP block is ready to
- *          receive the context
+ *  \brief  The function is used to set the selected algorithm
  *
- *  \param  ptrSHARegs      Pointer to the SHA Driver Context Object
+ *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
+ *  \param algorithm        Algorithm to be executed
  *
  */
-static void DTHE_SHA_pollContextReady(CSL_EIP57T_SHARegs* ptrSHARegs)
+static void DTHE_SHA_setAlgorithm(CSL_EIP57T_SHARegs* ptrSHARegs, uint32_t algorithm)
 {
-    uint8_t     done = 0U;
+    uint8_t     value;
 
-    /* Loop around till the condition is met: */
-    while (done == 0U)
+    switch (algorithm)
     {
-        done = DTHE_SHA_isContextReadyIRQ(ptrSHARegs);
+        case CSL_EIP57T_SHAAlgo_MD5:
+        {
+            value = 0U;
+            break;
+        }
+        case CSL_EIP57T_SHAAlgo_SHA384:
+        {
+            value = 1U;
+            break;
+        }
+        case CSL_EIP57T_SHAAlgo_SHA1:
+        {
+            value = 2U;
+            break;
+        }
+        case CSL_EIP57T_SHAAlgo_SHA512:
+        {
+            value = 3U;
+            break;
+        }
+        case CSL_EIP57T_SHAAlgo_SHA224:
+        {
+            value = 4U;
+            break;
+        }
+        default:
+        {
+            value = 6U;
+            break;
+        }
     }
+    CSL_FINSR (ptrSHARegs->HASH_MODE, 2U, 0U, value);
     return;
 }
 
 /**
- *  \brief  The function is used to get the context ready IRQ status
+ *  \brief The function is used to get the output ready IRQ status
  *
- *  \param  ptrSHARegs      Pointer to the EIP57T SHA Registers
+ *  \param ptrSHARegs Pointer to the EIP57T SHA Registers
  *
- *  \retval                 1 - Available for a new context
- *                          0 - Not available for a new context
+ *  \return 1 - (Partial) result is available
+ *          0 - (Partial) result is not available
  */
-static uint8_t DTHE_SHA_isContextReadyIRQ(const CSL_EIP57T_SHARegs* ptrSHARegs)
+static uint8_t DTHE_SHA_isOutputReadyIRQ(const CSL_EIP57T_SHARegs* ptrSHARegs)
 {
-    return CSL_FEXTR (ptrSHARegs->IRQSTATUS, 3U, 3U);
+    return CSL_FEXTR (ptrSHARegs->IRQSTATUS, 0U, 0U);
 }
 
 /**
- *  \brief  The function is used to enable/disable the usage of the algorithm
- *      constants
+ *  \brief The function is used to get the input ready IRQ status
  *
  *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
- *  \param useAlgConstants  Flag which will use enable(1)/disable(0) the usage of the algorithm constants
  *
+ *  \return 1 - Data FIFO is ready to receive data
+ *          0 - Data FIFO is not ready to receive data
  */
-static void DTHE_SHA_setUseAlgoConstants(CSL_EIP57T_SHARegs* ptrSHARegs, uint8_t useAlgConstants)
+static uint8_t DTHE_SHA_isInputReadyIRQ(const CSL_EIP57T_SHARegs* ptrSHARegs)
 {
-    CSL_FINSR (ptrSHARegs->HASH_MODE, 3U, 3U, useAlgConstants);
-    return;
+    return CSL_FEXTR (ptrSHARegs->IRQSTATUS, 1U, 1U);
 }
 
 /**
- *  \brief  The function is used to close/continue the hash algorithm
+ *  \brief The function is used to get the digest count for the SHA512
  *
  *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
- *  \param closeHashFlag    Flag which will close(1)/continue(0) the hash algorithm
  *
+ *  \retval                 Digest Count
  */
-static void DTHE_SHA_setCloseHash(CSL_EIP57T_SHARegs* ptrSHARegs, uint8_t closeHashFlag)
+static uint32_t DTHE_SHA512_getDigestCount(const CSL_EIP57T_SHARegs* ptrSHARegs)
 {
-    CSL_FINSR (ptrSHARegs->HASH_MODE, 4U, 4U, closeHashFlag);
-    return;
+    return ptrSHARegs->HASH512_DIGEST_COUNT;
 }
 
 /**
- *  \brief The function is used to set the HMAC Key processing
+ *  \brief The function is used to get the digest count
  *
  *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
- *  \param hmacKeyFlag      Flag which will enable(1)/disable(0) the HMAC key processing
  *
+ *  \retval                 Digest Count
  */
-static void DTHE_SHA_setHMACKeyProcessing(CSL_EIP57T_SHARegs* ptrSHARegs, uint8_t hmacKeyFlag)
+static uint32_t DTHE_SHA_getDigestCount(const CSL_EIP57T_SHARegs* ptrSHARegs)
 {
-    CSL_FINSR (ptrSHARegs->HASH_MODE, 5U, 5U, hmacKeyFlag);
-    return;
+    return ptrSHARegs->DIGEST_COUNT;
 }
 
 /**
- *  \brief  The function is used to set the HMAC Outer Hash flag
- *
- *  \param  ptrSHARegs      Pointer to the EIP57T SHA Registers
- *  \param  hmacOuterHash   Flag which will enable(1)/disable(0) the HMAC outer hash is performed
- *                          on the hash digest when the inner hash has finished
+ *  \brief The function is used to load an intermediate digest into the inner digest registers
  *
+ *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
+ *  \param ptrDigest        Pointer to the 256bit digest
  */
-static void DTHE_SHA_setHMACOuterHash(CSL_EIP57T_SHARegs* ptrSHARegs, uint8_t hmacOuterHash)
+static void DTHE_SHA_setHashDigest(CSL_EIP57T_SHARegs* ptrSHARegs, const uint32_t* ptrDigest)
 {
-    CSL_FINSR (ptrSHARegs->HASH_MODE, 7U, 7U, hmacOuterHash);
+    uint8_t index;
+    for (index = 0U; index < 8U; index++)
+    {
+        ptrSHARegs->IDIGEST[index] = ptrDigest[index];
+    }
     return;
 }
 
 /**
- *  \brief  The function is used to enable/disable the usage of the algorithm
- *      constants
+ *  \brief The function is used to load an intermediate digest into the SHA512 inner digest registers
  *
  *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
- *  \param useAlgConstants  Flag which will use enable(1)/disable(0) the usage of the algorithm constants
- *
+ *  \param ptrDigest        Pointer to the 512bit digest
  */
-static void DTHE_SHA512_setUseAlgoConstants(CSL_EIP57T_SHARegs* ptrSHARegs, uint8_t useAlgConstants)
+static void DTHE_SHA512_setHashDigest(CSL_EIP57T_SHARegs* ptrSHARegs, const uint32_t* ptrDigest)
 {
-    CSL_FINSR (ptrSHARegs->HASH512_MODE, 3U, 3U, useAlgConstants);
+    uint8_t index;
+    for (index = 0U; index < 16U; index++)
+    {
+        ptrSHARegs->HASH512_IDIGEST[index] = ptrDigest[index];
+    }
     return;
 }
 
 /**
- *  \brief  The function is used to close/continue the hash algorithm
+ *  \brief The function is used to set the digest count
  *
  *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
- *  \param closeHashFlag    Flag which will close(1)/continue(0) the hash algorithm
+ *  \param digestCount      Number of bytes already hashed
+ */
+static void DTHE_SHA_setDigestCount(CSL_EIP57T_SHARegs* ptrSHARegs, uint32_t digestCount)
+{
+    ptrSHARegs->DIGEST_COUNT = digestCount;
+    return;
+}
+
+/**
+ *  \brief The function is used to set the digest count for the SHA512
  *
+ *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
+ *  \param digestCount      Number of bytes already hashed
  */
-static void DTHE_SHA512_setCloseHash(CSL_EIP57T_SHARegs* ptrSHARegs, uint8_t closeHashFlag)
+static void DTHE_SHA512_setDigestCount(CSL_EIP57T_SHARegs* ptrSHARegs, uint32_t digestCount)
 {
-    CSL_FINSR (ptrSHARegs->HASH512_MODE, 4U, 4U, closeHashFlag);
+    ptrSHARegs->HASH512_DIGEST_COUNT = digestCount;
     return;
 }
 
 /**
- *  \brief  The function is used to set the HMAC Key processing
+ *  \brief  The function is used to write the lower 256bits (32bytes) of the HMAC Key
+ *          to the Outer Digest. Padding is done outside this function.
  *
  *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
- *  \param hmacKeyFlag      Flag which will enable(1)/disable(0) the HMAC key processing
+ *  \param ptrHMACKey       Pointer to the lower 256bits to be configured
  *
  */
-static void DTHE_SHA512_setHMACKeyProcessing(CSL_EIP57T_SHARegs* ptrSHARegs, uint8_t hmacKeyFlag)
+static void DTHE_SHA_setHMACOuterKey(CSL_EIP57T_SHARegs* ptrSHARegs, const uint32_t* ptrHMACKey)
 {
-    CSL_FINSR (ptrSHARegs->HASH512_MODE, 5U, 5U, hmacKeyFlag);
+    uint8_t index;
+    for (index = 0U; index < 8U; index = index + 1U)
+    {
+        ptrSHARegs->ODIGEST[index] = ptrHMACKey[index];
+    }
     return;
 }
 
 /**
- *  \brief  The function is used to set the HMAC Outer Hash flag
+ *  \brief The function is used to write the upper 256bits (32bytes) of the HMAC Key
+ *         to the Inner Digest.
  *
  *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
- *  \param hmacOuterHash    Flag which will enable(1)/disable(0) the HMAC outer hash is performed
- *                          on the hash digest when the inner hash has finished
+ *  \param ptrHMACKey       Pointer to the upper 256bits to be configured
  *
  */
-static void DTHE_SHA512_setHMACOuterHash(CSL_EIP57T_SHARegs* ptrSHARegs, uint8_t hmacOuterHash)
+static void DTHE_SHA_setHMACInnerKey(CSL_EIP57T_SHARegs* ptrSHARegs, const uint32_t* ptrHMACKey)
 {
-    CSL_FINSR (ptrSHARegs->HASH_MODE, 7U, 7U, hmacOuterHash);
+    uint8_t index;
+    for (index = 0U; index < 8U; index = index + 1U)
+    {
+        ptrSHARegs->IDIGEST[index] = ptrHMACKey[index];
+    }
     return;
 }
 
 /**
- *  \brief  The function is used to set the length of the block to be processed
- *          for the hash operation
+ *  \brief The function is used to write the lower 512bits (64bytes) of the HMAC Key
+ *         to the Outer Digest. Padding is done outside this function.
  *
  *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
- *  \param length           Length of the data
+ *  \param ptrHMACKey       Pointer to the lower 512bits to be configured
  *
  */
-static void DTHE_SHA_setHashLength(CSL_EIP57T_SHARegs* ptrSHARegs, uint32_t length)
+static void DTHE_SHA512_setHMACOuterKey(CSL_EIP57T_SHARegs* ptrSHARegs, const uint32_t* ptrHMACKey)
 {
-    ptrSHARegs->LENGTH = length;
+    uint8_t index;
+    for (index = 0U; index < 16U; index = index + 1U)
+    {
+        ptrSHARegs->HASH512_ODIGEST[index] = ptrHMACKey[index];
+    }
     return;
 }
 
 /**
- *  \brief  The function is used to set the length of the block to be processed
- *          for the hash operation
+ *  \brief The function is used to write the upper 512bits (64bytes) of the HMAC Key
+ *         to the Inner Digest.
  *
  *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
- *  \param length           Length of the data
+ *  \param ptrHMACKey       Pointer to the upper 512bits to be configured
  *
  */
-static void DTHE_SHA512_setHashLength(CSL_EIP57T_SHARegs* ptrSHARegs, uint32_t length)
+static void DTHE_SHA512_setHMACInnerKey(CSL_EIP57T_SHARegs* ptrSHARegs, const uint32_t* ptrHMACKey)
 {
-    ptrSHARegs->HASH512_LENGTH = length;
+    uint8_t index;
+    for (index = 0U; index < 16U; index = index + 1U)
+    {
+        ptrSHARegs->HASH512_IDIGEST[index] = ptrHMACKey[index];
+    }
     return;
 }
 
 /**
- *  \brief  The function is used to poll until the SHA IP block is ready to
- *          receive data
+ * \brief                   The function is used to get the block size of an algorithm.
  *
- *  \param ptrSHARegs       Pointer to the SHA Driver Context Object
+ * \param   algoType        SHA algorithm.
  *
+ * \return                  Size of a hash block in bytes.
  */
-static void DTHE_SHA_pollInputReady(CSL_EIP57T_SHARegs* ptrSHARegs)
+static uint32_t DTHE_SHA_getBlockSizeBytes(uint32_t algoType)
 {
-    uint8_t     done = 0U;
+    uint32_t                blockSizeBytes;
 
-    /* Loop around till the condition is met: */
-    while (done == 0U)
+    if (algoType == DTHE_SHA_ALGO_SHA256)
     {
-        done = DTHE_SHA_isInputReadyIRQ(ptrSHARegs);
+        blockSizeBytes = DTHE_SHA256_BLOCK_SIZE * sizeof(uint32_t);
     }
-    return;
+    else
+    {
+        blockSizeBytes = DTHE_SHA512_BLOCK_SIZE * sizeof(uint32_t);
+    }
+
+    return (blockSizeBytes);
 }
 
 /**
- *  \brief  The function is used write the data block. Data Block sizes
- *          are specific to the size of algorithm selected.
+ * \brief                   The function is used to get the digest size of an algorithm.
  *
- *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
- *  \param ptrDataBlock     Pointer to the data block to be written
- *  \param blockSize        Block Size. This is selected on the basis of the algorithm.
+ * \param   algoType        SHA algorithm.
  *
+ * \return                  Size of the digest in bytes.
  */
-static void DTHE_SHA_writeDataBlock(CSL_EIP57T_SHARegs* ptrSHARegs, const uint32_t* ptrDataBlock, uint8_t blockSize)
+static uint32_t DTHE_SHA_getDigestSizeBytes(uint32_t algoType)
 {
-    uint8_t index;
-    for (index = 0U; index < blockSize; index = index + 1U)
+    uint32_t                digestSizeBytes;
+
+    if (algoType == DTHE_SHA_ALGO_SHA256)
     {
-        ptrSHARegs->DATA_IN[0] = ptrDataBlock[index];
+        digestSizeBytes = 32U;
     }
-    return;
+    else if (algoType == DTHE_SHA_ALGO_SHA384)
+    {
+        digestSizeBytes = 48U;
+    }
+    else
+    {
+        digestSizeBytes = DTHE_SHA_MAX_DIGEST_SIZE_BYTES;
+    }
+
+    return (digestSizeBytes);
 }
 
 /**
- *  \brief  The function is used to poll until the SHA IP block is ready with
- *          the results
+ * \brief                   The function is used to get the context of a hash operation.
  *
- *  \param ptrSHARegs       Pointer to the SHA Driver Context Object
+ * \param   ptrShaParams    Pointer to the SHA parameters.
  *
+ * \return                  Context passed in the parameters, or the default context of the driver.
  */
-static void DTHE_SHA_pollOutputReady (CSL_EIP57T_SHARegs* ptrSHARegs)
+static DTHE_SHA_Context* DTHE_SHA_getContext(const DTHE_SHA_Params* ptrShaParams)
 {
-    uint8_t     done = 0U;
+    DTHE_SHA_Context        *ptrContext = ptrShaParams->ptrContext;
 
-    /* Loop around till the condition is met: */
-    while (done == 0U)
+    if (ptrContext == NULL)
     {
-        done = DTHE_SHA_isOutputReadyIRQ(ptrSHARegs);
+        ptrContext = &gDTHESHADefaultContext;
     }
-    return;
+
+    return (ptrContext);
 }
 
 /**
- *  \brief  The function is used to get the hash inner digest for SHA-256.
- *          The SHA Digest in this case is 32bytes.
+ * \brief                   The function is used to check that a hash operation can continue
+ *                          the hash held by its context.
  *
- *  \param  ptrSHARegs      Pointer to the EIP57T SHA Registers
- *  \param  ptrDigest       Pointer to the digest populated by the API
+ * \param   ptrShaParams    Pointer to the SHA parameters.
  *
+ * \return                  #DTHE_SHA_RETURN_SUCCESS if the context is new or holds a hash of the same algorithm.
+ *                          #DTHE_SHA_RETURN_FAILURE otherwise.
  */
-static void DTHE_SHA_getHashDigest(const CSL_EIP57T_SHARegs* ptrSHARegs, uint32_t* ptrDigest)
+static DTHE_SHA_Return_t DTHE_SHA_checkContext(const DTHE_SHA_Params* ptrShaParams)
 {
-    uint8_t index;
-    for (index = 0U; index < 8U; index++)
+    DTHE_SHA_Return_t       status = DTHE_SHA_RETURN_SUCCESS;
+    const DTHE_SHA_Context  *ptrContext = DTHE_SHA_getContext(ptrShaParams);
+
+    if ((ptrContext->state == DTHE_SHA_CONTEXT_STATE_IN_PROGRESS) &&
+        (ptrContext->algoType != ptrShaParams->algoType))
     {
-        ptrDigest[index] = ptrSHARegs->IDIGEST[index];
+        status = DTHE_SHA_RETURN_FAILURE;
     }
-    return;
+
+    return (status);
 }
 
 /**
- *  \brief  The function is used to get the hash inner digest for SHA512.
- *          The SHA Digest in this case is 64bytes.
+ * \brief                   The function is used to load the intermediate digest and the digest count
+ *                          of a context back into the engine.
  *
- *  \param  ptrSHARegs      Pointer to the EIP57T SHA Registers
- *  \param  ptrDigest       Pointer to the digest populated by the API
+ * \param   ptrShaRegs      Pointer to the EIP57T SHA Registers.
  *
+ * \param   ptrContext      Pointer to the SHA context.
  */
-static void DTHE_SHA512_getHashDigest(const CSL_EIP57T_SHARegs* ptrSHARegs, uint32_t* ptrDigest)
+static void DTHE_SHA_restoreContext(CSL_EIP57T_SHARegs* ptrShaRegs, const DTHE_SHA_Context* ptrContext)
 {
-    uint8_t index;
-    for (index = 0U; index < 16U; index++)
+    if (ptrContext->algoType == DTHE_SHA_ALGO_SHA256)
     {
-        ptrDigest[index] = ptrSHARegs->HASH512_IDIGEST[index];
+        DTHE_SHA_setHashDigest(ptrShaRegs, &ptrContext->digest[0]);
+        DTHE_SHA_setDigestCount(ptrShaRegs, ptrContext->digestCount);
+    }
+    else
+    {
+        DTHE_SHA512_setHashDigest(ptrShaRegs, &ptrContext->digest[0]);
+        DTHE_SHA512_setDigestCount(ptrShaRegs, ptrContext->digestCount);
     }
+
     return;
 }
 
 /**
- *  \brief  The function is used to set the selected algorithm
+ * \brief                   The function is used to program the hash mode and the data length
+ *                          for a plain (non HMAC) hash operation. If the engine was used by another
+ *                          context since the last block of this hash, the state of the hash is
+ *                          loaded back first.
  *
- *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
- *  \param algorithm        Algorithm to be executed
+ * \param   ptrShaRegs      Pointer to the EIP57T SHA Registers.
  *
+ * \param   attrs           Pointer to the DTHE attributes.
+ *
+ * \param   ptrContext      Pointer to the SHA context.
+ *
+ * \param   algoType        SHA algorithm.
+ *
+ * \param   dataLenBytes    Length of the data in bytes.
+ *
+ * \param   isLastBlock     Flag which indicates if the hash is closed after this data.
+ *
+ * \return                  Size of a hash block in words.
  */
-static void DTHE_SHA_setAlgorithm(CSL_EIP57T_SHARegs* ptrSHARegs, uint32_t algorithm)
+static uint8_t DTHE_SHA_setupHashMode(CSL_EIP57T_SHARegs* ptrShaRegs, DTHE_Attrs* attrs, DTHE_SHA_Context* ptrContext,
+                                      uint32_t algoType, uint32_t dataLenBytes, int32_t isLastBlock)
 {
-    uint8_t     value;
-
-    switch (algorithm)
+    uint8_t     useAlgoConstants;
+    uint8_t     closeHash;
+    uint8_t     blockSize;
+
+    /********************************************************************
+     * Is this the first block which is being passed to the SHA Engine?
+     ********************************************************************/
+    if (ptrContext->state == DTHE_SHA_CONTEXT_STATE_NEW)
     {
-        case CSL_EIP57T_SHAAlgo_MD5:
-        {
-            value = 0U;
-            break;
-        }
-        case CSL_EIP57T_SHAAlgo_SHA384:
-        {
-            value = 1U;
-            break;
-        }
-        case CSL_EIP57T_SHAAlgo_SHA1:
-        {
-            value = 2U;
-            break;
-        }
-        case CSL_EIP57T_SHAAlgo_SHA512:
-        {
-            value = 3U;
-            break;
-        }
-        case CSL_EIP57T_SHAAlgo_SHA224:
-        {
-            value = 4U;
-            break;
-        }
-        default:
+        /* Yes: For the first block we will use the algorithm constants */
+        useAlgoConstants = 1U;
+    }
+    else
+    {
+        /* No: For all other blocks we will not use the algorithm constants */
+        useAlgoConstants = 0U;
+
+        /* Was the engine used by another hash since the last block? */
+        if (attrs->shaActiveCtx != (void *)ptrContext)
         {
-            value = 6U;
-            break;
+            DTHE_SHA_restoreContext(ptrShaRegs, ptrContext);
         }
     }
-    CSL_FINSR (ptrSHARegs->HASH_MODE, 2U, 0U, value);
-    return;
+    ptrContext->algoType = algoType;
+    attrs->shaActiveCtx  = (void *)ptrContext;
+
+    /* Is this the last block? */
+    if (isLastBlock == TRUE)
+    {
+        /* Yes: Close the Hash */
+        closeHash = 1U;
+    }
+    else
+    {
+        /* No: Dont close the hash there are more data blocks. */
+        closeHash = 0U;
+    }
+
+    /* Update the Hash Mode: */
+    if (algoType == DTHE_SHA_ALGO_SHA256)
+    {
+        DTHE_SHA_setUseAlgoConstants(ptrShaRegs, useAlgoConstants);
+        DTHE_SHA_setCloseHash(ptrShaRegs, closeHash);
+
+        /* Reset the HMAC Processing: */
+        DTHE_SHA_setHMACKeyProcessing(ptrShaRegs, 0U);
+        DTHE_SHA_setHMACOuterHash(ptrShaRegs, 0U);
+    }
+    else
+    {
+        DTHE_SHA512_setUseAlgoConstants(ptrShaRegs, useAlgoConstants);
+        DTHE_SHA512_setCloseHash(ptrShaRegs, closeHash);
+
+        /* Reset the HMAC Processing: */
+        DTHE_SHA512_setHMACKeyProcessing(ptrShaRegs, 0U);
+        DTHE_SHA512_setHMACOuterHash(ptrShaRegs, 0U);
+    }
+
+    /* Write the length of the data: */
+    if (algoType == DTHE_SHA_ALGO_SHA256)
+    {
+        blockSize = DTHE_SHA256_BLOCK_SIZE;
+        DTHE_SHA_setHashLength(ptrShaRegs, dataLenBytes);
+    }
+    else
+    {
+        blockSize = DTHE_SHA512_BLOCK_SIZE;
+        DTHE_SHA512_setHashLength(ptrShaRegs, dataLenBytes);
+    }
+
+    return (blockSize);
 }
 
 /**
- *  \brief The function is used to get the output ready IRQ status
+ * \brief                   The function is used to wait for the hash result and read back the digest
+ *                          and the digest count. While the hash is open they are kept in the context,
+ *                          so the engine can be handed over to another context after every block.
  *
- *  \param ptrSHARegs Pointer to the EIP57T SHA Registers
+ * \param   ptrShaRegs      Pointer to the EIP57T SHA Registers.
  *
- *  \return 1 - (Partial) result is available
- *          0 - (Partial) result is not available
- */
-static uint8_t DTHE_SHA_isOutputReadyIRQ(const CSL_EIP57T_SHARegs* ptrSHARegs)
-{
-    return CSL_FEXTR (ptrSHARegs->IRQSTATUS, 0U, 0U);
-}
-
-/**
- *  \brief The function is used to get the input ready IRQ status
+ * \param   attrs           Pointer to the DTHE attributes.
  *
- *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
+ * \param   ptrContext      Pointer to the SHA context.
  *
- *  \return 1 - Data FIFO is ready to receive data
- *          0 - Data FIFO is not ready to receive data
+ * \param   ptrShaParams    Pointer to the SHA parameters which receive the digest.
+ *
+ * \param   isLastBlock     Flag which indicates if the hash was closed.
  */
-static uint8_t DTHE_SHA_isInputReadyIRQ(const CSL_EIP57T_SHARegs* ptrSHARegs)
+static void DTHE_SHA_readResult(CSL_EIP57T_SHARegs* ptrShaRegs, DTHE_Attrs* attrs, DTHE_SHA_Context* ptrContext,
+                                DTHE_SHA_Params* ptrShaParams, int32_t isLastBlock)
 {
-    return CSL_FEXTR (ptrSHARegs->IRQSTATUS, 1U, 1U);
+    /* Poll till the intermediate hash results are available: */
+    DTHE_SHA_pollOutputReady (ptrShaRegs);
+
+    /* Get the digest count and value: */
+    if (ptrShaParams->algoType == DTHE_SHA_ALGO_SHA256)
+    {
+        DTHE_SHA_getHashDigest(ptrShaRegs, &ptrShaParams->digest[0]);
+        ptrContext->digestCount = DTHE_SHA_getDigestCount(ptrShaRegs);
+    }
+    else
+    {
+        DTHE_SHA512_getHashDigest(ptrShaRegs, &ptrShaParams->digest[0]);
+        ptrContext->digestCount = DTHE_SHA512_getDigestCount(ptrShaRegs);
+    }
+
+    if( isLastBlock == TRUE )
+    {
+        /* SHA Computation is complete: */
+        DTHE_SHA_Context_init(ptrContext);
+        attrs->shaActiveCtx = NULL;
+    }
+    else
+    {
+        /* SHA Computation is in progress: */
+        (void)memcpy((void *)&ptrContext->digest[0], (const void *)&ptrShaParams->digest[0], sizeof(ptrContext->digest));
+        ptrContext->state = DTHE_SHA_CONTEXT_STATE_IN_PROGRESS;
+    }
+
+    return;
 }
 
 /**
- *  \brief The function is used to get the digest count for the SHA512
+ * \brief                   The function is used to write the data which follows the last full block:
+ *                          the remaining whole words and then the remaining bytes as one partial word.
  *
- *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
+ * \param   ptrShaRegs      Pointer to the EIP57T SHA Registers.
  *
- *  \retval                 Digest Count
- */
-static uint32_t DTHE_SHA512_getDigestCount(const CSL_EIP57T_SHARegs* ptrSHARegs)
-{
-    return ptrSHARegs->HASH512_DIGEST_COUNT;
-}
-
-/**
- *  \brief The function is used to get the digest count
+ * \param   ptrDataBuffer   Pointer to the data buffer.
  *
- *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
+ * \param   numBytes        Number of bytes of the buffer which were already written.
  *
- *  \retval                 Digest Count
+ * \param   dataLenBytes    Length of the data buffer in bytes.
  */
-static uint32_t DTHE_SHA_getDigestCount(const CSL_EIP57T_SHARegs* ptrSHARegs)
+static void DTHE_SHA_writeRemainder(CSL_EIP57T_SHARegs* ptrShaRegs, const uint32_t* ptrDataBuffer, uint32_t numBytes, uint32_t dataLenBytes)
 {
-    return ptrSHARegs->DIGEST_COUNT;
+    const uint8_t           *ptrByteDataBuffer;
+    uint32_t                numPartialWords;
+    uint32_t                partialWord = 0U;
+
+    /* Compute the number of partial words which need to be handled seperately */
+    numPartialWords = (dataLenBytes - numBytes) / 4U;
+
+    /* Process any left over data: */
+    if (numPartialWords != 0U)
+    {
+        /* Ensure that the SHA IP Block is ready to receive data: */
+        DTHE_SHA_pollInputReady(ptrShaRegs);
+
+        /* Write the data block: */
+        DTHE_SHA_writeDataBlock(ptrShaRegs, &ptrDataBuffer[numBytes / 4U], (uint8_t)numPartialWords);
+
+        /* Compute the number of bytes which have been processed: */
+        numBytes = numBytes + (numPartialWords * sizeof(uint32_t));
+    }
+
+    /* Do we need to account for some additional bytes? */
+    if (dataLenBytes != numBytes)
+    {
+        /* Get the pointer to the data buffer in bytes which will be written: */
+        ptrByteDataBuffer = (const uint8_t*)ptrDataBuffer;
+
+        /* Copy into the partial word: */
+        (void)memcpy ((void *)&partialWord, (const void *)&ptrByteDataBuffer[numBytes], (dataLenBytes - numBytes));
+
+        /* Ensure that the SHA IP Block is ready to receive data: */
+        DTHE_SHA_pollInputReady(ptrShaRegs);
+
+        /* Write the data block: */
+        DTHE_SHA_writeDataBlock(ptrShaRegs, &partialWord, 1U);
+    }
+
+    return;
 }
 
 /**
- *  \brief  The function is used to write the lower 256bits (32bytes) of the HMAC Key
- *          to the Outer Digest. Padding is done outside this function.
+ * \brief                   The function is used to write a data buffer to the engine once the hash mode
+ *                          and the length are programmed. The full blocks are moved by the DMA when it
+ *                          is enabled, the rest of the data is written by the CPU.
  *
- *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
- *  \param ptrHMACKey       Pointer to the lower 256bits to be configured
+ * \param   config          Pointer to the DTHE configuration.
+ *
+ * \param   ptrShaRegs      Pointer to the EIP57T SHA Registers.
+ *
+ * \param   ptrDataBuffer   Pointer to the data buffer.
+ *
+ * \param   dataLenBytes    Length of the data buffer in bytes.
  *
+ * \param   blockSize       Size of a hash block in words.
  */
-static void DTHE_SHA_setHMACOuterKey(CSL_EIP57T_SHARegs* ptrSHARegs, const uint32_t* ptrHMACKey)
+static void DTHE_SHA_writeData(const DTHE_Config* config, CSL_EIP57T_SHARegs* ptrShaRegs, const uint32_t* ptrDataBuffer,
+                               uint32_t dataLenBytes, uint8_t blockSize)
 {
-    uint8_t index;
-    for (index = 0U; index < 8U; index = index + 1U)
+    DMA_Handle              dmaHandle = NULL;
+    uint32_t                index;
+    uint16_t                numBlocks;
+    uint32_t                numBytes = 0U;
+
+    /* Compute the number of blocks: */
+    numBlocks = (uint16_t)((dataLenBytes / 4U) / blockSize);
+
+    if ((config->dmaEnable == DMA_ENABLE) && (numBlocks > 0U))
     {
-        ptrSHARegs->ODIGEST[index] = ptrHMACKey[index];
+        dmaHandle = DMA_open(0);
+
+        DMA_Config_TxChannel(dmaHandle, (uint32_t *)ptrDataBuffer, (uint32_t *)&ptrShaRegs->DATA_IN[0], numBlocks, blockSize, DMA_SHA_ENABLE);
+
+        DMA_enableTxTransferRegion(dmaHandle, DMA_SHA_ENABLE);
+
+        DTHE_SHA_setDMA(ptrShaRegs, 1);
+
+        DMA_WaitForTxTransfer(dmaHandle, DMA_SHA_ENABLE);
+
+        DTHE_SHA_setDMA(ptrShaRegs, 0);
+
+        DMA_disableTxCh(dmaHandle, DMA_SHA_ENABLE);
+
+        /* Compute the number of bytes which have been processed: */
+        numBytes = (uint32_t)numBlocks * blockSize * sizeof(uint32_t);
     }
+    else
+    {
+        /* Compute the number of full blocks which need to be processed: */
+        for (index = 0U; index < numBlocks; index = index + 1U)
+        {
+            /* Ensure that the SHA IP Block is ready to receive data: */
+            DTHE_SHA_pollInputReady(ptrShaRegs);
+
+            /* Write the data block: */
+            DTHE_SHA_writeDataBlock(ptrShaRegs, &ptrDataBuffer[index * blockSize], blockSize);
+
+            /* Compute the number of bytes which have been processed: */
+            numBytes = numBytes + (blockSize * sizeof(uint32_t));
+        }
+    }
+
+    /* Process any left over data: */
+    DTHE_SHA_writeRemainder(ptrShaRegs, ptrDataBuffer, numBytes, dataLenBytes);
+
     return;
 }
 
 /**
- *  \brief The function is used to write the upper 256bits (32bytes) of the HMAC Key
- *         to the Inner Digest.
- *
- *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
- *  \param ptrHMACKey       Pointer to the upper 256bits to be configured
+ * \brief                   The function is used to release the DMA channel of the last job once it is done.
+ *                          Neither is done from the completion interrupt itself, the function is called
+ *                          from task context.
  *
+ * \return                  #DTHE_SHA_RETURN_SUCCESS if no job is running.
+ *                          #DTHE_SHA_RETURN_FAILURE if a job still owns the engine.
  */
-static void DTHE_SHA_setHMACInnerKey(CSL_EIP57T_SHARegs* ptrSHARegs, const uint32_t* ptrHMACKey)
+static DTHE_SHA_Return_t DTHE_SHA_reapJob(void)
 {
-    uint8_t index;
-    for (index = 0U; index < 8U; index = index + 1U)
+    DTHE_SHA_Return_t       status = DTHE_SHA_RETURN_SUCCESS;
+    DTHE_SHA_Job            *ptrJob = &gDTHESHAJob;
+
+    if (ptrJob->state == DTHE_SHA_JOB_STATE_DMA_DONE)
     {
-        ptrSHARegs->IDIGEST[index] = ptrHMACKey[index];
+        DTHE_SHA_finishJob(ptrJob);
     }
-    return;
+
+    if (ptrJob->state == DTHE_SHA_JOB_STATE_RUNNING)
+    {
+        status = DTHE_SHA_RETURN_FAILURE;
+    }
+    else if (ptrJob->dmaHandle != NULL)
+    {
+        DMA_disableTxCh(ptrJob->dmaHandle, DMA_SHA_ENABLE);
+        ptrJob->dmaHandle = NULL;
+    }
+    else
+    {
+        /* Nothing to release */
+    }
+
+    return (status);
 }
 
 /**
- *  \brief The function is used to write the lower 512bits (64bytes) of the HMAC Key
- *         to the Outer Digest. Padding is done outside this function.
- *
- *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
- *  \param ptrHMACKey       Pointer to the lower 512bits to be configured
+ * \brief                   DMA completion callback of a job, called from the EDMA interrupt once all full
+ *                          blocks were written to the engine. The engine is not polled here: the job is only
+ *                          marked and the waiter and the callback are told that it can be finished.
  *
+ * \param   args            Pointer to the job.
  */
-static void DTHE_SHA512_setHMACOuterKey(CSL_EIP57T_SHARegs* ptrSHARegs, const uint32_t* ptrHMACKey)
+static void DTHE_SHA_jobDmaComplete(void *args)
 {
-    uint8_t index;
-    for (index = 0U; index < 16U; index = index + 1U)
+    DTHE_SHA_Job            *ptrJob = (DTHE_SHA_Job *)args;
+    DTHE_Config             *config = (DTHE_Config *)ptrJob->handle;
+
+    DTHE_SHA_setDMA((CSL_EIP57T_SHARegs *)config->attrs->shaBaseAddr, 0);
+
+    ptrJob->state = DTHE_SHA_JOB_STATE_DMA_DONE;
+    (void)SemaphoreP_post(&ptrJob->doneSem);
+
+    if (ptrJob->callback != NULL)
     {
-        ptrSHARegs->HASH512_ODIGEST[index] = ptrHMACKey[index];
+        ptrJob->callback(ptrJob->handle, ptrJob->token, DTHE_SHA_RETURN_SUCCESS, ptrJob->args);
     }
+
     return;
 }
 
 /**
- *  \brief The function is used to write the upper 512bits (64bytes) of the HMAC Key
- *         to the Inner Digest.
- *
- *  \param ptrSHARegs       Pointer to the EIP57T SHA Registers
- *  \param ptrHMACKey       Pointer to the upper 512bits to be configured
+ * \brief                   The function is used to write the rest of the data of a job and read back the
+ *                          digest once its DMA is done, from task context.
  *
+ * \param   ptrJob          Pointer to the job.
  */
-static void DTHE_SHA512_setHMACInnerKey(CSL_EIP57T_SHARegs* ptrSHARegs, const uint32_t* ptrHMACKey)
+static void DTHE_SHA_finishJob(DTHE_SHA_Job *ptrJob)
 {
-    uint8_t index;
-    for (index = 0U; index < 16U; index = index + 1U)
-    {
-        ptrSHARegs->HASH512_IDIGEST[index] = ptrHMACKey[index];
-    }
+    DTHE_Config             *config = (DTHE_Config *)ptrJob->handle;
+    CSL_EIP57T_SHARegs      *ptrShaRegs = (CSL_EIP57T_SHARegs *)config->attrs->shaBaseAddr;
+
+    DTHE_SHA_writeRemainder(ptrShaRegs, ptrJob->ptrShaParams->ptrDataBuffer, ptrJob->numBytes, ptrJob->ptrShaParams->dataLenBytes);
+
+    /* Read back the digest once the engine is done: */
+    DTHE_SHA_readResult(ptrShaRegs, config->attrs, DTHE_SHA_getContext(ptrJob->ptrShaParams),
+                        ptrJob->ptrShaParams, ptrJob->isLastBlock);
+
+    ptrJob->status = DTHE_SHA_RETURN_SUCCESS;
+    ptrJob->state  = DTHE_SHA_JOB_STATE_DONE;
+
     return;
 }
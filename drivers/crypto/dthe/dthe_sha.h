@@ -52,6 +52,7 @@
 /*                             Include Files                                  */
 /* ========================================================================== */
 #include <stdint.h>
+#include <string.h>
 #include <security_common/drivers/crypto/dthe/dthe.h>
 #include <kernel/dpl/SystemP.h>
 #include <drivers/hw_include/cslr.h>
@@ -80,6 +81,9 @@ extern "C" {
 
 /** \brief The Maximum Digest Size is 64bytes for the SHA512.*/
 #define DTHE_SHA_MAX_DIGEST_SIZE_BYTES      (64U)
+
+/** \brief The Maximum Block Size is 128bytes for the SHA512.*/
+#define DTHE_SHA_MAX_BLOCK_SIZE_BYTES       (128U)
 /* ========================================================================== */
 /*                         Structure Declarations                             */
 /* ========================================================================== */
@@ -95,8 +99,46 @@ typedef enum DTHE_SHA_Return_e
 {
     DTHE_SHA_RETURN_SUCCESS                  = 0x67A42DD1U, /*!< Success/pass return code */
     DTHE_SHA_RETURN_FAILURE                  = 0x06C2B483U, /*!< General or unspecified failure/error */
+    DTHE_SHA_RETURN_TIMEOUT                  = 0x5B19E3A6U, /*!< Job still running when the wait timed out */
 }DTHE_SHA_Return_t;
 
+/**
+ * \brief SHA Context
+ *  This structure holds the state of one multishot hash. Each hash owns one
+ *  context, so several hashes (for example a SHA-256 and a SHA-512 hash) can be
+ *  open at the same time and time-share the engine. The intermediate digest and
+ *  the byte count are read back from the engine after every block of a hash and
+ *  kept here; when the engine was used by another context in between, they are
+ *  written back to the engine before the hash continues.
+ *
+ *  With #DTHE_SHA_init, #DTHE_SHA_update and #DTHE_SHA_final the context also
+ *  buffers the data which does not fill a block yet.
+ *
+ *  The context is owned by the caller and must be initialized with
+ *  #DTHE_SHA_Context_init before its first use. All fields are internal to
+ *  the driver.
+ */
+typedef struct DTHE_SHA_Context_t
+{
+    /**< State of the context, internal to the driver */
+    uint32_t            state;
+
+    /**< Algorithm of the hash in progress */
+    uint32_t            algoType;
+
+    /**< Intermediate digest of the hash in progress */
+    uint32_t            digest[DTHE_SHA_MAX_DIGEST_SIZE_BYTES/4U];
+
+    /**< Number of bytes hashed so far */
+    uint32_t            digestCount;
+
+    /**< Data of a #DTHE_SHA_update which was not hashed yet */
+    uint32_t            buffer[DTHE_SHA_MAX_BLOCK_SIZE_BYTES/4U];
+
+    /**< Number of valid bytes in the buffer */
+    uint32_t            bufferLenBytes;
+}DTHE_SHA_Context;
+
 /** \brief Parameters required for SHA Driver */
 typedef struct DTHE_SHA_Params_t
 {
@@ -112,8 +154,67 @@ typedef struct DTHE_SHA_Params_t
     uint32_t            keySize;
     /** \brief output buffer for storing sha degest */
     uint32_t            digest[DTHE_SHA_MAX_DIGEST_SIZE_BYTES/4U];
+    /**
+     * \brief Pointer to the SHA context which holds the state of a multishot hash.
+     *        The same context must be passed for all the blocks of one hash. If this
+     *        is NULL the default context of the driver is used, which allows only one
+     *        multishot hash at a time.
+     */
+    DTHE_SHA_Context    *ptrContext;
 }DTHE_SHA_Params;
 
+/**
+ * \brief HMAC Key
+ *  This structure holds an HMAC key in its processed form: the hash states after
+ *  the key XOR ipad and the key XOR opad blocks. It is set up once with
+ *  #DTHE_HMACSHA_setupKey; every #DTHE_HMACSHA_computeWithKey then starts from
+ *  these states instead of processing the key again. The raw key is not kept.
+ *  All fields are internal to the driver.
+ */
+typedef struct DTHE_HMACSHA_Key_t
+{
+    /**< Algorithm the key was set up for */
+    uint32_t            algoType;
+
+    /**< Hash state after the inner padded key block */
+    uint32_t            innerDigest[DTHE_SHA_MAX_DIGEST_SIZE_BYTES/4U];
+
+    /**< Hash state after the outer padded key block */
+    uint32_t            outerDigest[DTHE_SHA_MAX_DIGEST_SIZE_BYTES/4U];
+}DTHE_HMACSHA_Key;
+
+/**
+ * \brief HMAC Context
+ *  This structure holds the state of one HMAC computed with #DTHE_HMACSHA_init,
+ *  #DTHE_HMACSHA_update and #DTHE_HMACSHA_final. The inner hash runs as a SHA
+ *  context, so it shares the engine with the other open hashes; the outer hash
+ *  is done at #DTHE_HMACSHA_final. All fields are internal to the driver.
+ */
+typedef struct DTHE_HMACSHA_Context_t
+{
+    /**< Inner hash */
+    DTHE_SHA_Context    innerContext;
+
+    /**< Hash state after the outer padded key block */
+    uint32_t            outerDigest[DTHE_SHA_MAX_DIGEST_SIZE_BYTES/4U];
+}DTHE_HMACSHA_Context;
+
+/**
+ * \brief               Completion callback of an asynchronous SHA job. It is called from the DMA
+ *                      interrupt once the full blocks are moved; the job is then finished, and its
+ *                      digest read back, by #DTHE_SHA_wait from task context. When the job has less
+ *                      than one block of data it is called from #DTHE_SHA_submit with the result.
+ *
+ * \param  handle       #DTHE_Handle the job was submitted on.
+ *
+ * \param  token        Token returned by #DTHE_SHA_submit.
+ *
+ * \param  status       #DTHE_SHA_RETURN_SUCCESS from the DMA interrupt, the result of the job otherwise.
+ *
+ * \param  args         Argument passed to #DTHE_SHA_submit.
+ */
+typedef void (*DTHE_SHA_JobCallback)(DTHE_Handle handle, DTHE_JobToken token, DTHE_SHA_Return_t status, void *args);
+
 /* ========================================================================== */
 /*                            Global Variables                                */
 /* ========================================================================== */
@@ -139,13 +240,133 @@ DTHE_SHA_Return_t DTHE_SHA_open(DTHE_Handle handle);
  *
  * \param ptrShaParams  Pointer to the parameters to be used to execute the driver.
  *
- * \param isLastBlock   Used for singleshot and multishot sha.
+ * \param isLastBlock   Used for singleshot and multishot sha. The blocks of several multishot
+ *                      hashes can be interleaved if each hash has its own context.
  *
  * \return              #DTHE_SHA_RETURN_SUCCESS if requested operation completed.
  *                      #DTHE_SHA_RETURN_FAILURE if requested operation not completed.
  */
 DTHE_SHA_Return_t DTHE_SHA_compute(DTHE_Handle handle, DTHE_SHA_Params* ptrShaParams, int32_t isLastBlock);
 
+/**
+ * \brief               The function is used to hash a scatter-gather list of buffers as one contiguous
+ *                      message. ptrDataBuffer and dataLenBytes of ptrShaParams are not used.
+ *                      With DMA enabled the list is moved as one linked EDMA transfer and only blocks
+ *                      which straddle two segments are copied by the CPU.
+ *
+ * \param  handle       #DTHE_Handle returned from #DTHE_open().
+ *
+ * \param ptrShaParams  Pointer to the parameters to be used to execute the driver.
+ *
+ * \param ptrSegments   Pointer to the list of data segments.
+ *
+ * \param numSegments   Number of data segments.
+ *
+ * \param isLastBlock   Used for singleshot and multishot sha. Except for the last list,
+ *                      the total length must be a multiple of the SHA block size.
+ *
+ * \return              #DTHE_SHA_RETURN_SUCCESS if requested operation completed.
+ *                      #DTHE_SHA_RETURN_FAILURE if requested operation not completed.
+ */
+DTHE_SHA_Return_t DTHE_SHA_computeSG(DTHE_Handle handle, DTHE_SHA_Params* ptrShaParams,
+                                     const DTHE_Segment* ptrSegments, uint32_t numSegments, int32_t isLastBlock);
+
+/**
+ * \brief               The function is used to start a SHA computation without waiting for the DMA.
+ *                      The full blocks are moved by the DMA while the CPU is free; the rest of the data
+ *                      and the digest are handled by #DTHE_SHA_wait once the DMA is done, so that the
+ *                      engine is never polled from the interrupt. The callback tells when the job can be
+ *                      waited for without blocking; #DTHE_SHA_wait must be called to get its result.
+ *
+ *                      The parameters are used as for #DTHE_SHA_compute. DMA must be enabled for the
+ *                      handle. ptrShaParams and its data buffer must stay valid until the job is done,
+ *                      the digest is written to ptrShaParams. One job runs at a time; the synchronous
+ *                      APIs fail while it runs. A job moves at most #DTHE_JOB_MAX_BLOCKS full blocks,
+ *                      larger data must be split over several jobs.
+ *
+ * \param  handle       #DTHE_Handle returned from #DTHE_open().
+ *
+ * \param ptrShaParams  Pointer to the parameters to be used to execute the driver.
+ *
+ * \param isLastBlock   Used for singleshot and multishot sha.
+ *
+ * \param callback      Completion callback, can be NULL.
+ *
+ * \param args          Argument passed to the callback.
+ *
+ * \param ptrToken      Token of the job, to be passed to #DTHE_SHA_wait.
+ *
+ * \return              #DTHE_SHA_RETURN_SUCCESS if the job is started.
+ *                      #DTHE_SHA_RETURN_FAILURE if the job could not be started.
+ */
+DTHE_SHA_Return_t DTHE_SHA_submit(DTHE_Handle handle, DTHE_SHA_Params* ptrShaParams, int32_t isLastBlock,
+                                  DTHE_SHA_JobCallback callback, void *args, DTHE_JobToken *ptrToken);
+
+/**
+ * \brief               The function is used to wait for an asynchronous SHA job.
+ *
+ * \param  handle       #DTHE_Handle returned from #DTHE_open().
+ *
+ * \param token         Token returned by #DTHE_SHA_submit.
+ *
+ * \param timeout       Time to wait in system ticks, SystemP_NO_WAIT to poll or SystemP_WAIT_FOREVER.
+ *
+ * \return              Result of the job if it is done.
+ *                      #DTHE_SHA_RETURN_TIMEOUT if the job is still running, wait again.
+ *                      #DTHE_SHA_RETURN_FAILURE if the token is not valid.
+ */
+DTHE_SHA_Return_t DTHE_SHA_wait(DTHE_Handle handle, DTHE_JobToken token, uint32_t timeout);
+
+/**
+ * \brief               The function is used to start a hash with #DTHE_SHA_update and #DTHE_SHA_final.
+ *                      Any hash which was open on the context is dropped.
+ *
+ * \param  handle       #DTHE_Handle returned from #DTHE_open().
+ *
+ * \param ptrContext    Pointer to the SHA context of the hash.
+ *
+ * \param algoType      Algorithm of the hash, #DTHE_SHA_ALGO_SHA256, #DTHE_SHA_ALGO_SHA384 or
+ *                      #DTHE_SHA_ALGO_SHA512.
+ *
+ * \return              #DTHE_SHA_RETURN_SUCCESS if requested operation completed.
+ *                      #DTHE_SHA_RETURN_FAILURE if requested operation not completed.
+ */
+DTHE_SHA_Return_t DTHE_SHA_init(DTHE_Handle handle, DTHE_SHA_Context* ptrContext, uint32_t algoType);
+
+/**
+ * \brief               The function is used to add data of any length to a hash started by #DTHE_SHA_init.
+ *                      Full blocks are hashed straight from ptrData when it is word aligned, with the DMA
+ *                      if it is enabled; only the data which does not fill a block is copied to the context.
+ *                      If the function fails the hash must be started again.
+ *
+ * \param  handle       #DTHE_Handle returned from #DTHE_open().
+ *
+ * \param ptrContext    Pointer to the SHA context of the hash.
+ *
+ * \param ptrData       Pointer to the data.
+ *
+ * \param dataLenBytes  Length of the data in bytes.
+ *
+ * \return              #DTHE_SHA_RETURN_SUCCESS if requested operation completed.
+ *                      #DTHE_SHA_RETURN_FAILURE if requested operation not completed.
+ */
+DTHE_SHA_Return_t DTHE_SHA_update(DTHE_Handle handle, DTHE_SHA_Context* ptrContext, const uint8_t* ptrData, uint32_t dataLenBytes);
+
+/**
+ * \brief               The function is used to close a hash started by #DTHE_SHA_init and read its digest.
+ *                      The context can be used for a new hash afterwards.
+ *
+ * \param  handle       #DTHE_Handle returned from #DTHE_open().
+ *
+ * \param ptrContext    Pointer to the SHA context of the hash.
+ *
+ * \param ptrDigest     Buffer for the digest, #DTHE_SHA_MAX_DIGEST_SIZE_BYTES long.
+ *
+ * \return              #DTHE_SHA_RETURN_SUCCESS if requested operation completed.
+ *                      #DTHE_SHA_RETURN_FAILURE if requested operation not completed.
+ */
+DTHE_SHA_Return_t DTHE_SHA_final(DTHE_Handle handle, DTHE_SHA_Context* ptrContext, uint32_t* ptrDigest);
+
 /**
  * \brief               The function is used to execute the HMAC SHA Operations with the specified parameters.
  *
@@ -158,6 +379,91 @@ DTHE_SHA_Return_t DTHE_SHA_compute(DTHE_Handle handle, DTHE_SHA_Params* ptrShaPa
  */
 DTHE_SHA_Return_t DTHE_HMACSHA_compute(DTHE_Handle handle, DTHE_SHA_Params* ptrShaParams);
 
+/**
+ * \brief               The function is used to process an HMAC key once for #DTHE_HMACSHA_computeWithKey.
+ *                      Keys longer than the block size are hashed first.
+ *
+ * \param  handle       #DTHE_Handle returned from #DTHE_open().
+ *
+ * \param ptrHmacKey    Pointer to the HMAC key object which is set up.
+ *
+ * \param algoType      Algorithm of the HMAC.
+ *
+ * \param ptrKey        Pointer to the key.
+ *
+ * \param keySize       Size of the key in bytes.
+ *
+ * \return              #DTHE_SHA_RETURN_SUCCESS if requested operation completed.
+ *                      #DTHE_SHA_RETURN_FAILURE if requested operation not completed.
+ */
+DTHE_SHA_Return_t DTHE_HMACSHA_setupKey(DTHE_Handle handle, DTHE_HMACSHA_Key* ptrHmacKey, uint32_t algoType,
+                                        const uint32_t* ptrKey, uint32_t keySize);
+
+/**
+ * \brief               The function is used to compute an HMAC with a key set up by #DTHE_HMACSHA_setupKey.
+ *                      The engine is loaded with the processed key, so the key blocks are not hashed again.
+ *                      ptrDataBuffer and dataLenBytes of ptrShaParams give the message, the HMAC is written
+ *                      to its digest. algoType, ptrKey and keySize of ptrShaParams are not used.
+ *
+ * \param  handle       #DTHE_Handle returned from #DTHE_open().
+ *
+ * \param ptrHmacKey    Pointer to the HMAC key object.
+ *
+ * \param ptrShaParams  Pointer to the parameters to be used to execute the driver.
+ *
+ * \return              #DTHE_SHA_RETURN_SUCCESS if requested operation completed.
+ *                      #DTHE_SHA_RETURN_FAILURE if requested operation not completed.
+ */
+DTHE_SHA_Return_t DTHE_HMACSHA_computeWithKey(DTHE_Handle handle, const DTHE_HMACSHA_Key* ptrHmacKey,
+                                              DTHE_SHA_Params* ptrShaParams);
+
+/**
+ * \brief               The function is used to start an HMAC with #DTHE_HMACSHA_update and #DTHE_HMACSHA_final.
+ *                      The key object is copied, it does not need to stay valid.
+ *
+ * \param  handle       #DTHE_Handle returned from #DTHE_open().
+ *
+ * \param ptrContext    Pointer to the HMAC context.
+ *
+ * \param ptrHmacKey    Pointer to the HMAC key object set up by #DTHE_HMACSHA_setupKey.
+ *
+ * \return              #DTHE_SHA_RETURN_SUCCESS if requested operation completed.
+ *                      #DTHE_SHA_RETURN_FAILURE if requested operation not completed.
+ */
+DTHE_SHA_Return_t DTHE_HMACSHA_init(DTHE_Handle handle, DTHE_HMACSHA_Context* ptrContext, const DTHE_HMACSHA_Key* ptrHmacKey);
+
+/**
+ * \brief               The function is used to add data of any length to an HMAC started by #DTHE_HMACSHA_init.
+ *                      The data is handled as by #DTHE_SHA_update.
+ *
+ * \param  handle       #DTHE_Handle returned from #DTHE_open().
+ *
+ * \param ptrContext    Pointer to the HMAC context.
+ *
+ * \param ptrData       Pointer to the data.
+ *
+ * \param dataLenBytes  Length of the data in bytes.
+ *
+ * \return              #DTHE_SHA_RETURN_SUCCESS if requested operation completed.
+ *                      #DTHE_SHA_RETURN_FAILURE if requested operation not completed.
+ */
+DTHE_SHA_Return_t DTHE_HMACSHA_update(DTHE_Handle handle, DTHE_HMACSHA_Context* ptrContext, const uint8_t* ptrData, uint32_t dataLenBytes);
+
+/**
+ * \brief               The function is used to close an HMAC started by #DTHE_HMACSHA_init and read it.
+ *                      The context is cleared afterwards.
+ *
+ * \param  handle       #DTHE_Handle returned from #DTHE_open().
+ *
+ * \param ptrContext    Pointer to the HMAC context.
+ *
+ * \param ptrMac        Buffer for the HMAC, #DTHE_SHA_MAX_DIGEST_SIZE_BYTES long.
+ *
+ * \return              #DTHE_SHA_RETURN_SUCCESS if requested operation completed.
+ *                      #DTHE_SHA_RETURN_FAILURE if requested operation not completed.
+ */
+DTHE_SHA_Return_t DTHE_HMACSHA_final(DTHE_Handle handle, DTHE_HMACSHA_Context* ptrContext, uint32_t* ptrMac);
+
 /**
  * \brief               Function to close DTHE SHA Driver.
  *
@@ -168,6 +474,25 @@ DTHE_SHA_Return_t DTHE_HMACSHA_compute(DTHE_Handle handle, DTHE_SHA_Params* ptrS
  */
 DTHE_SHA_Return_t DTHE_SHA_close(DTHE_Handle handle);
 
+/**
+ * \brief               Function to initialize a SHA context before it is used for a hash.
+ *
+ * \param ptrContext    Pointer to the SHA context.
+ */
+static inline void DTHE_SHA_Context_init(DTHE_SHA_Context *ptrContext);
+
+/* ========================================================================== */
+/*                       Static Function Definitions                          */
+/* ========================================================================== */
+
+static inline void DTHE_SHA_Context_init(DTHE_SHA_Context *ptrContext)
+{
+    if(ptrContext != NULL)
+    {
+        (void)memset((void *)ptrContext, 0, sizeof(DTHE_SHA_Context));
+    }
+}
+
 #ifdef __cplusplus
 }
 #endif
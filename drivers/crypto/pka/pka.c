@@ -43,6 +43,8 @@
 #include <string.h>
 #include <stddef.h>
 #include <kernel/dpl/ClockP.h>
+#include <kernel/dpl/HwiP.h>
+#include <kernel/dpl/SemaphoreP.h>
 #include <security_common/drivers/crypto/asym_crypt.h>
 #include <drivers/hw_include/cslr.h>
 #include <drivers/hw_include/cslr_soc.h>
@@ -148,6 +150,15 @@
 #define ASYM_CRYPT_ECDSA_VERIFY_CMD   (((uint32_t) 0x2U) << PKA_FUNCTION_CMD_HI_SHIFT) | \
     (((uint32_t) 0x3U) << PKA_FUNCTION_CMD_LO_SHIFT)
 
+/** No asynchronous operation was started since the instance was opened */
+#define PKA_JOB_STATE_IDLE                         (0x00U)
+
+/** The asynchronous operation owns the engine */
+#define PKA_JOB_STATE_RUNNING                      (0x5AU)
+
+/** The asynchronous operation is complete */
+#define PKA_JOB_STATE_DONE                         (0xC3U)
+
 /** \brief device type HSSE */
 #define DEVTYPE_HSSE         (0x0AU)
 
@@ -175,6 +186,11 @@ static void PKA_setAPtr(CSL_Eip_29t2_ramRegs *pka_regs, uint32_t offset);
 static void PKA_setBPtr(CSL_Eip_29t2_ramRegs *pka_regs, uint32_t offset);
 static void PKA_setCPtr(CSL_Eip_29t2_ramRegs *pka_regs, uint32_t offset);
 static void PKA_setDPtr(CSL_Eip_29t2_ramRegs *pka_regs, uint32_t offset);
+static AsymCrypt_Return_t PKA_jobInit(PKA_Attrs *attrs);
+static void PKA_jobDeInit(PKA_Attrs *attrs);
+static void PKA_jobStart(PKA_Attrs *attrs, uint32_t cmd, uint32_t *result, uint32_t resultOffset, uint32_t resultSize);
+static void PKA_jobProgress(PKA_Attrs *attrs);
+static void PKA_isr(void *args);
 
 #if defined(SOC_AM64X) || defined(SOC_AM243X)
 static CSL_Cp_aceRegs* PKA_getCaBaseAddress(PKA_Attrs *attrs);
@@ -270,6 +286,15 @@ AsymCrypt_Handle AsymCrypt_open(uint32_t index)
         }
     #endif
 
+    if(ASYM_CRYPT_RETURN_SUCCESS == status)
+    {
+        status = PKA_jobInit(attrs);
+        if(ASYM_CRYPT_RETURN_SUCCESS != status)
+        {
+            PKA_disable(attrs);
+        }
+    }
+
     if(ASYM_CRYPT_RETURN_SUCCESS == status)
     {
         attrs->isOpen = TRUE;
@@ -290,11 +315,17 @@ AsymCrypt_Return_t AsymCrypt_close(AsymCrypt_Handle handle)
     {
         attrs = config->attrs;
         DebugP_assert(NULL != attrs);
-        PKA_disable(attrs);
-        attrs->isOpen = FALSE;
-        /* TO disable module*/
-        handle = NULL;
-        status  = ASYM_CRYPT_RETURN_SUCCESS;
+        /* The engine is not disabled under a running operation */
+        PKA_jobProgress(attrs);
+        if(attrs->job.state != PKA_JOB_STATE_RUNNING)
+        {
+            PKA_jobDeInit(attrs);
+            PKA_disable(attrs);
+            attrs->isOpen = FALSE;
+            /* TO disable module*/
+            handle = NULL;
+            status  = ASYM_CRYPT_RETURN_SUCCESS;
+        }
     }
     return (status);
 }
@@ -303,24 +334,43 @@ AsymCrypt_Return_t AsymCrypt_RSAPrivate(AsymCrypt_Handle handle,
                     const uint32_t m[RSA_MAX_LENGTH],
                     const struct AsymCrypt_RSAPrivkey *k,
                     uint32_t result[RSA_MAX_LENGTH])
+{
+    AsymCrypt_Return_t status;
+
+    status = AsymCrypt_RSAPrivateStart(handle, m, k, result);
+    if(ASYM_CRYPT_RETURN_SUCCESS == status)
+    {
+        status = AsymCrypt_wait(handle, SystemP_WAIT_FOREVER);
+    }
+    return (status);
+}
+
+AsymCrypt_Return_t AsymCrypt_RSAPrivateStart(AsymCrypt_Handle handle,
+                    const uint32_t m[RSA_MAX_LENGTH],
+                    const struct AsymCrypt_RSAPrivkey *k,
+                    uint32_t result[RSA_MAX_LENGTH])
 {
     AsymCrypt_Return_t status = ASYM_CRYPT_RETURN_FAILURE;
     uint64_t curTimeInUsecs, totalTimeInUsecs = 0;
-    uint32_t size, offset, reg, wssize, shift, tmp, numCount;
+    uint32_t size, offset, reg, wssize, shift, tmp;
     CSL_Eip_29t2_ramRegs *pka_regs;
     PKA_Config      *config;
-    PKA_Attrs *attrs;
+    PKA_Attrs *attrs = NULL;
     config  = (PKA_Config *) handle;
-    attrs   = config->attrs;
     size = k->p[0];
 
+    if(NULL != config)
+    {
+        attrs = config->attrs;
+    }
+
     /* check sizes, sizes of s and n must match. */
     if ((!((size <= 1U) || (size > ((RSA_MAX_LENGTH - 1U) >> 1)) ||
            (k->q[0] > size) || (k->dp[0] > size) || (k->dq[0] > size) ||
            (k->coefficient[0] > size) || (m[0] > (size * 2U)))))
     {
-        /* Checking handle is opened or not */
-        if((attrs->isOpen) && (NULL != handle))
+        /* Checking handle is opened and the engine is free */
+        if((NULL != attrs) && (attrs->isOpen) && (attrs->job.state != PKA_JOB_STATE_RUNNING))
         {
             status = ASYM_CRYPT_RETURN_SUCCESS;
         }
@@ -423,46 +473,8 @@ AsymCrypt_Return_t AsymCrypt_RSAPrivate(AsymCrypt_Handle handle,
 
                 CSL_REG_WR(&pka_regs->EIP_27B_EIP27_REGISTERS.PKA_SHIFT, shift);
 
-                CSL_REG_WR(&pka_regs->EIP_27B_EIP27_REGISTERS.PKA_FUNCTION, PKA_MODEXP_CRT_CMD |
-                       (((uint32_t) 1U) << PKA_FUNCTION_RUN_SHIFT));
-
-                /* Wait for completion */
-                totalTimeInUsecs = 0;
-                curTimeInUsecs = ClockP_getTimeUsec();
-                /* TODO: MCUSDK-8047: Timeout values need to be calibrated for SoCs an checks need to be added back */
-                while(((PKA_SEQ_CTRL_DONE_MASK & CSL_REG_RD(&pka_regs->EIP_28PX12_GF2_2PRAM_EIP28_REGISTERS.PKA_SEQ_CTRL)) != ((uint32_t) 1U) << PKA_SEQ_CTRL_DONE_SHIFT))
-                {
-                    totalTimeInUsecs = ClockP_getTimeUsec() - curTimeInUsecs;
-                }
-
-                totalTimeInUsecs = 0;
-
-                if(totalTimeInUsecs > PKA_MODEXP_CRT_TIMEOUT)
-                {
-                    status = ASYM_CRYPT_RETURN_FAILURE;
-                }
-
-                if(status == ASYM_CRYPT_RETURN_SUCCESS)
-                {
-                    reg = CSL_REG_RD(&pka_regs->EIP_28PX12_GF2_2PRAM_EIP28_REGISTERS.PKA_SEQ_CTRL);
-                    if ((reg & PKA_SEQ_CTRL_RESULT_MASK) == (PKA_COMMAND_RESULT_SUCCESS << PKA_SEQ_CTRL_RESULT_SHIFT))
-                    {
-                        /* Copy result vector from dptr
-                         */
-                        result[0] = size * 2U;
-
-                        for(numCount = 0; numCount < (size * 2U); numCount++)
-                        {
-                            result[1 + numCount] = pka_regs->EIP_29T2_RAM_PKA_RAM.PKA_RAM[offset + numCount];
-                        }
-
-                        status = ASYM_CRYPT_RETURN_SUCCESS;
-                    }
-                    else
-                    {
-                        status = ASYM_CRYPT_RETURN_FAILURE;
-                    }
-                }
+                /* Result vector is read back from dptr once the engine is done */
+                PKA_jobStart(attrs, PKA_MODEXP_CRT_CMD, result, offset, size * 2U);
             }
             else
             {
@@ -494,7 +506,7 @@ AsymCrypt_Return_t AsymCrypt_RSAPublic(AsymCrypt_Handle handle,
            (m[0] != size) || (k->e[0] > (RSA_MAX_LENGTH - 1U)))))
     {
         /* Checking handle is opened or not */
-        if((attrs->isOpen) && (NULL != handle))
+        if((attrs->isOpen) && (NULL != handle) && (attrs->job.state != PKA_JOB_STATE_RUNNING))
         {
             status = ASYM_CRYPT_RETURN_SUCCESS;
         }
@@ -651,7 +663,7 @@ AsymCrypt_Return_t AsymCrypt_ECDSASign(AsymCrypt_Handle handle,
            (PKA_bigIntBitLen(cp->order) >= PKA_bigIntBitLen(h)))
     {
         /* Checking handle is opened or not */
-        if((attrs->isOpen) && (NULL != handle))
+        if((attrs->isOpen) && (NULL != handle) && (attrs->job.state != PKA_JOB_STATE_RUNNING))
         {
             status = ASYM_CRYPT_RETURN_SUCCESS;
         }
@@ -748,16 +760,35 @@ AsymCrypt_Return_t AsymCrypt_ECDSAVerify(AsymCrypt_Handle handle,
                         const struct AsymCrypt_ECPoint *pub,
                         const struct AsymCrypt_ECDSASig *sig,
                         const uint32_t h[ECDSA_MAX_LENGTH])
+{
+    AsymCrypt_Return_t status;
+
+    status = AsymCrypt_ECDSAVerifyStart(handle, cp, pub, sig, h);
+    if(ASYM_CRYPT_RETURN_SUCCESS == status)
+    {
+        status = AsymCrypt_wait(handle, SystemP_WAIT_FOREVER);
+    }
+    return (status);
+}
+
+AsymCrypt_Return_t AsymCrypt_ECDSAVerifyStart(AsymCrypt_Handle handle,
+                        const struct AsymCrypt_ECPrimeCurveP *cp,
+                        const struct AsymCrypt_ECPoint *pub,
+                        const struct AsymCrypt_ECDSASig *sig,
+                        const uint32_t h[ECDSA_MAX_LENGTH])
 {
     AsymCrypt_Return_t status = ASYM_CRYPT_RETURN_FAILURE;
-    uint64_t curTimeInUsecs, totalTimeInUsecs = 0;
-    uint32_t offset, reg, size;
+    uint32_t offset, size;
     uint32_t bn_one[2] = { 1U, 1U };
     CSL_Eip_29t2_ramRegs *pka_regs;
     PKA_Config      *config;
-    PKA_Attrs *attrs;
+    PKA_Attrs *attrs = NULL;
     config  = (PKA_Config *) handle;
-    attrs   = config->attrs;
+
+    if(NULL != config)
+    {
+        attrs = config->attrs;
+    }
 
     size = cp->prime[0];
 
@@ -771,8 +802,8 @@ AsymCrypt_Return_t AsymCrypt_ECDSAVerify(AsymCrypt_Handle handle,
             (PKA_bigIntBitLen(cp->order) >= PKA_bigIntBitLen(h)) &&
             PKA_isBigIntZero(sig->r) && PKA_isBigIntZero(sig->s))
     {
-        /* Checking handle is opened or not */
-        if((attrs->isOpen) && (NULL != handle))
+        /* Checking handle is opened and the engine is free */
+        if((NULL != attrs) && (attrs->isOpen) && (attrs->job.state != PKA_JOB_STATE_RUNNING))
         {
             status = ASYM_CRYPT_RETURN_SUCCESS;
         }
@@ -829,36 +860,90 @@ AsymCrypt_Return_t AsymCrypt_ECDSAVerify(AsymCrypt_Handle handle,
 
             PKA_cpyz(&pka_regs->EIP_29T2_RAM_PKA_RAM.PKA_RAM[offset], size + 2U, sig->s);
 
-            CSL_REG_WR(&pka_regs->EIP_27B_EIP27_REGISTERS.PKA_FUNCTION, ASYM_CRYPT_ECDSA_VERIFY_CMD | (((uint32_t) 1U) << PKA_FUNCTION_RUN_SHIFT));
+            /* The verification has no result vector, only the firmware result code */
+            PKA_jobStart(attrs, ASYM_CRYPT_ECDSA_VERIFY_CMD, NULL, 0U, 0U);
+        }
+    }
+    return (status);
+}
 
-            /* Wait for completion */
-            curTimeInUsecs = ClockP_getTimeUsec();
-            /* TODO: MCUSDK-8047: Timeout values need to be calibrated for SoCs an checks need to be added back */
-            while(((PKA_SEQ_CTRL_DONE_MASK & CSL_REG_RD(&pka_regs->EIP_28PX12_GF2_2PRAM_EIP28_REGISTERS.PKA_SEQ_CTRL)) != ((uint32_t) 1U) << PKA_SEQ_CTRL_DONE_SHIFT) )
-            {
-                totalTimeInUsecs = ClockP_getTimeUsec() - curTimeInUsecs;
-            }
+AsymCrypt_Return_t AsymCrypt_poll(AsymCrypt_Handle handle)
+{
+    AsymCrypt_Return_t status = ASYM_CRYPT_RETURN_FAILURE;
+    PKA_Config      *config;
+    PKA_Attrs *attrs;
+    config  = (PKA_Config *) handle;
+
+    if((NULL != config) && (config->attrs->isOpen != (uint32_t)FALSE) &&
+       (config->attrs->job.state != PKA_JOB_STATE_IDLE))
+    {
+        attrs = config->attrs;
+        PKA_jobProgress(attrs);
+        if(attrs->job.state == PKA_JOB_STATE_RUNNING)
+        {
+            status = ASYM_CRYPT_RETURN_BUSY;
+        }
+        else
+        {
+            status = (AsymCrypt_Return_t) attrs->job.status;
+        }
+    }
+    return (status);
+}
+
+AsymCrypt_Return_t AsymCrypt_wait(AsymCrypt_Handle handle, uint32_t timeout)
+{
+    AsymCrypt_Return_t status = ASYM_CRYPT_RETURN_FAILURE;
+    uint32_t startTicks = 0U;
+    PKA_Config      *config;
+    PKA_Attrs *attrs = NULL;
+    PKA_Job *ptrJob = NULL;
+    config  = (PKA_Config *) handle;
 
-            totalTimeInUsecs = 0;
+    if((NULL != config) && (config->attrs->isOpen != (uint32_t)FALSE) &&
+       (config->attrs->job.state != PKA_JOB_STATE_IDLE))
+    {
+        attrs   = config->attrs;
+        ptrJob  = &attrs->job;
+        status  = ASYM_CRYPT_RETURN_SUCCESS;
+
+        /* The operation may be done without the interrupt being taken yet */
+        PKA_jobProgress(attrs);
+    }
 
-            if(totalTimeInUsecs > ASYM_CRYPT_ECDSA_VERIFY_TIMEOUT)
+    if((ASYM_CRYPT_RETURN_SUCCESS == status) && (ptrJob->state == PKA_JOB_STATE_RUNNING))
+    {
+        if(TRUE == attrs->isIntrEnabled)
+        {
+            if(SemaphoreP_pend(&ptrJob->doneSem, timeout) != SystemP_SUCCESS)
             {
-                status = ASYM_CRYPT_RETURN_FAILURE;
+                /* Still running */
+                status = ASYM_CRYPT_RETURN_BUSY;
             }
-            else
+        }
+        else
+        {
+            /* Without the interrupt the waiter polls the engine */
+            startTicks = ClockP_getTicks();
+            do
             {
-                reg = CSL_REG_RD(&pka_regs->EIP_28PX12_GF2_2PRAM_EIP28_REGISTERS.PKA_SEQ_CTRL);
-                if((reg & PKA_SEQ_CTRL_RESULT_MASK) == (PKA_COMMAND_RESULT_SUCCESS << PKA_SEQ_CTRL_RESULT_SHIFT))
-                {
-                    status = ASYM_CRYPT_RETURN_SUCCESS;
-                }
-                else
-                {
-                    status = ASYM_CRYPT_RETURN_FAILURE;
-                }
+                PKA_jobProgress(attrs);
+            } while((ptrJob->state == PKA_JOB_STATE_RUNNING) &&
+                    ((timeout == SystemP_WAIT_FOREVER) || ((ClockP_getTicks() - startTicks) < timeout)));
+
+            if(ptrJob->state == PKA_JOB_STATE_RUNNING)
+            {
+                status = ASYM_CRYPT_RETURN_BUSY;
             }
         }
     }
+
+    if(ASYM_CRYPT_RETURN_SUCCESS == status)
+    {
+        /* Drop the completion of the job which is reaped here */
+        (void)SemaphoreP_pend(&ptrJob->doneSem, SystemP_NO_WAIT);
+        status = (AsymCrypt_Return_t) ptrJob->status;
+    }
     return (status);
 }
 
@@ -1187,3 +1272,178 @@ static AsymCrypt_Return_t PKA_isBigIntZero(const uint32_t bn[RSA_MAX_LENGTH])
     }
     return (ret);
 }
+
+/**
+ * \brief Prepare the asynchronous operation of an instance and hook the PKA
+ *        interrupt when it is enabled
+ *
+ * \param attrs PKA attributes of the instance
+ *
+ * \return ASYM_CRYPT_RETURN_SUCCESS if the instance can run asynchronous operations
+ */
+static AsymCrypt_Return_t PKA_jobInit(PKA_Attrs *attrs)
+{
+    AsymCrypt_Return_t status = ASYM_CRYPT_RETURN_SUCCESS;
+    uint32_t reg;
+    HwiP_Params hwiPrms;
+    PKA_Job *ptrJob = &attrs->job;
+    CSL_Eip_29t2_ramRegs *pka_regs = PKA_getBaseAddress(attrs);
+
+    ptrJob->state   = PKA_JOB_STATE_IDLE;
+    ptrJob->status  = ASYM_CRYPT_RETURN_FAILURE;
+    ptrJob->result  = NULL;
+
+    if(SemaphoreP_constructBinary(&ptrJob->doneSem, 0U) != SystemP_SUCCESS)
+    {
+        status = ASYM_CRYPT_RETURN_FAILURE;
+    }
+
+    if((ASYM_CRYPT_RETURN_SUCCESS == status) && (TRUE == attrs->isIntrEnabled))
+    {
+        /* Clear the interrupt of the commands run before the instance was opened */
+        CSL_REG_WR(&pka_regs->EIP_29T2_RAM_HOST_REGISTERS.PKA_IRQSTATUS, CSL_EIP_29T2_RAM_PKA_IRQSTATUS_PKAIRQSTAT_MASK);
+
+        HwiP_Params_init(&hwiPrms);
+        hwiPrms.intNum   = attrs->intrNum;
+        hwiPrms.callback = &PKA_isr;
+        hwiPrms.args     = (void *) attrs;
+        if(HwiP_construct(&ptrJob->hwiObj, &hwiPrms) != SystemP_SUCCESS)
+        {
+            SemaphoreP_destruct(&ptrJob->doneSem);
+            status = ASYM_CRYPT_RETURN_FAILURE;
+        }
+        else
+        {
+            reg = CSL_REG_RD(&pka_regs->EIP_29T2_RAM_HOST_REGISTERS.PKA_IRQENABLE);
+            CSL_FINS(reg, EIP_29T2_RAM_PKA_IRQENABLE_PKAIRQEN, 1U);
+            CSL_REG_WR(&pka_regs->EIP_29T2_RAM_HOST_REGISTERS.PKA_IRQENABLE, reg);
+        }
+    }
+    return (status);
+}
+
+/**
+ * \brief Release the PKA interrupt and the asynchronous operation of an instance
+ *
+ * \param attrs PKA attributes of the instance
+ */
+static void PKA_jobDeInit(PKA_Attrs *attrs)
+{
+    uint32_t reg;
+    PKA_Job *ptrJob = &attrs->job;
+    CSL_Eip_29t2_ramRegs *pka_regs = PKA_getBaseAddress(attrs);
+
+    if(TRUE == attrs->isIntrEnabled)
+    {
+        reg = CSL_REG_RD(&pka_regs->EIP_29T2_RAM_HOST_REGISTERS.PKA_IRQENABLE);
+        CSL_FINS(reg, EIP_29T2_RAM_PKA_IRQENABLE_PKAIRQEN, 0U);
+        CSL_REG_WR(&pka_regs->EIP_29T2_RAM_HOST_REGISTERS.PKA_IRQENABLE, reg);
+
+        HwiP_destruct(&ptrJob->hwiObj);
+    }
+    SemaphoreP_destruct(&ptrJob->doneSem);
+    ptrJob->state = PKA_JOB_STATE_IDLE;
+    return;
+}
+
+/**
+ * \brief Start a firmware command on the operands already loaded in the PKA RAM
+ *        and return without waiting for it
+ *
+ * \param attrs         PKA attributes of the instance
+ * \param cmd           Command to PKA firmware
+ * \param result        Result vector in bigint format, NULL if the command has none
+ * \param resultOffset  Word offset of the result vector in the PKA RAM
+ * \param resultSize    Size of the result vector in words
+ */
+static void PKA_jobStart(PKA_Attrs *attrs, uint32_t cmd, uint32_t *result, uint32_t resultOffset, uint32_t resultSize)
+{
+    PKA_Job *ptrJob = &attrs->job;
+    CSL_Eip_29t2_ramRegs *pka_regs = PKA_getBaseAddress(attrs);
+
+    /* Drop a completion which was never waited for */
+    (void)SemaphoreP_pend(&ptrJob->doneSem, SystemP_NO_WAIT);
+
+    ptrJob->result          = result;
+    ptrJob->resultOffset    = resultOffset;
+    ptrJob->resultSize      = resultSize;
+    ptrJob->status          = ASYM_CRYPT_RETURN_FAILURE;
+
+    /* Clear the interrupt of the earlier commands, e.g. the compare of p and q */
+    CSL_REG_WR(&pka_regs->EIP_29T2_RAM_HOST_REGISTERS.PKA_IRQSTATUS, CSL_EIP_29T2_RAM_PKA_IRQSTATUS_PKAIRQSTAT_MASK);
+
+    ptrJob->state = PKA_JOB_STATE_RUNNING;
+
+    CSL_REG_WR(&pka_regs->EIP_27B_EIP27_REGISTERS.PKA_FUNCTION, cmd |
+           (((uint32_t) 1U) << PKA_FUNCTION_RUN_SHIFT));
+    return;
+}
+
+/**
+ * \brief Complete the running operation once the engine has cleared the run
+ *        bit: check the firmware result code, copy the result vector and wake
+ *        the waiter. Called from the PKA interrupt and from the tasks.
+ *
+ * \param attrs PKA attributes of the instance
+ */
+static void PKA_jobProgress(PKA_Attrs *attrs)
+{
+    uint32_t reg, numCount;
+    uint32_t isDone = FALSE;
+    uintptr_t key;
+    PKA_Job *ptrJob = &attrs->job;
+    CSL_Eip_29t2_ramRegs *pka_regs = PKA_getBaseAddress(attrs);
+
+    key = HwiP_disable();
+
+    if((ptrJob->state == PKA_JOB_STATE_RUNNING) &&
+       ((PKA_FUNCTION_RUN_MASK & CSL_REG_RD(&pka_regs->EIP_27B_EIP27_REGISTERS.PKA_FUNCTION)) == 0U))
+    {
+        reg = CSL_REG_RD(&pka_regs->EIP_28PX12_GF2_2PRAM_EIP28_REGISTERS.PKA_SEQ_CTRL);
+        if((reg & PKA_SEQ_CTRL_RESULT_MASK) == (PKA_COMMAND_RESULT_SUCCESS << PKA_SEQ_CTRL_RESULT_SHIFT))
+        {
+            if(NULL != ptrJob->result)
+            {
+                ptrJob->result[0] = ptrJob->resultSize;
+
+                for(numCount = 0; numCount < ptrJob->resultSize; numCount++)
+                {
+                    ptrJob->result[1 + numCount] = pka_regs->EIP_29T2_RAM_PKA_RAM.PKA_RAM[ptrJob->resultOffset + numCount];
+                }
+            }
+            ptrJob->status = ASYM_CRYPT_RETURN_SUCCESS;
+        }
+        else
+        {
+            ptrJob->status = ASYM_CRYPT_RETURN_FAILURE;
+        }
+
+        ptrJob->state = PKA_JOB_STATE_DONE;
+        isDone = TRUE;
+    }
+
+    HwiP_restore(key);
+
+    /* The waiter is woken outside of the critical section */
+    if(isDone == TRUE)
+    {
+        (void)SemaphoreP_post(&ptrJob->doneSem);
+    }
+    return;
+}
+
+/**
+ * \brief PKA interrupt, raised when the engine clears the run bit of a command
+ *
+ * \param args PKA attributes of the instance
+ */
+static void PKA_isr(void *args)
+{
+    PKA_Attrs *attrs = (PKA_Attrs *) args;
+    CSL_Eip_29t2_ramRegs *pka_regs = PKA_getBaseAddress(attrs);
+
+    CSL_REG_WR(&pka_regs->EIP_29T2_RAM_HOST_REGISTERS.PKA_IRQSTATUS, CSL_EIP_29T2_RAM_PKA_IRQSTATUS_PKAIRQSTAT_MASK);
+
+    PKA_jobProgress(attrs);
+    return;
+}
@@ -56,6 +56,8 @@
 #include <security_common/drivers/crypto/pka/eip29t2_firmware.h>
 #include <security_common/drivers/crypto/pka/hw_include/cslr_cp_ace.h>
 #include <kernel/dpl/SystemP.h>
+#include <kernel/dpl/HwiP.h>
+#include <kernel/dpl/SemaphoreP.h>
 #include <security_common/drivers/crypto/crypto_util.h>
 
 #ifdef __cplusplus
@@ -70,6 +72,30 @@ extern "C" {
 /*                         Structure Declarations                             */
 /* ========================================================================== */
 
+/**
+ * \brief State of an asynchronous PKA operation. The engine runs one operation at a
+ *        time, it is started by #AsymCrypt_RSAPrivateStart or #AsymCrypt_ECDSAVerifyStart
+ *        and completed from the PKA interrupt, #AsymCrypt_poll or #AsymCrypt_wait.
+ *        All fields are internal to the driver.
+ */
+typedef struct
+{
+    volatile uint32_t       state;
+    /**< State of the operation */
+    volatile uint32_t       status;
+    /**< Result of the operation once done */
+    uint32_t               *result;
+    /**< Result vector of the operation in bigint format, NULL if there is none */
+    uint32_t                resultOffset;
+    /**< Word offset of the result vector in the PKA RAM */
+    uint32_t                resultSize;
+    /**< Size of the result vector in words */
+    SemaphoreP_Object       doneSem;
+    /**< Posted when the operation is done */
+    HwiP_Object             hwiObj;
+    /**< PKA interrupt object */
+} PKA_Job;
+
 /** \brief PKA attributes */
 typedef struct
 {
@@ -82,6 +108,13 @@ typedef struct
     /**< PKA Base address */
 	uint32_t                isOpen;
     /**< Flag to indicate whether the instance is opened already */
+    uint32_t                intrNum;
+    /**< PKA interrupt number, used when isIntrEnabled is TRUE */
+    uint32_t                isIntrEnabled;
+    /**< TRUE to complete asynchronous operations from the PKA interrupt,
+     *   FALSE to complete them only from #AsymCrypt_poll and #AsymCrypt_wait */
+    PKA_Job                 job;
+    /**< Asynchronous operation, internal to the driver */
 } PKA_Attrs;
 
 /** \brief PKA driver context */
@@ -457,6 +457,50 @@ AsymCrypt_Return_t AsymCrypt_ECDSAVerify(AsymCrypt_Handle handle,
     return (status);
 }
 
+/* The PKE operations complete in the calling task, the asynchronous API is not supported */
+AsymCrypt_Return_t AsymCrypt_RSAPrivateStart(AsymCrypt_Handle handle,
+                    const uint32_t m[RSA_MAX_LENGTH],
+                    const struct AsymCrypt_RSAPrivkey *k,
+                    uint32_t result[RSA_MAX_LENGTH])
+{
+    (void)handle;
+    (void)m;
+    (void)k;
+    (void)result;
+
+    return (ASYM_CRYPT_RETURN_FAILURE);
+}
+
+AsymCrypt_Return_t AsymCrypt_ECDSAVerifyStart(AsymCrypt_Handle handle,
+                        const struct AsymCrypt_ECPrimeCurveP *cp,
+                        const struct AsymCrypt_ECPoint *pub,
+                        const struct AsymCrypt_ECDSASig *sig,
+                        const uint32_t h[ECDSA_MAX_LENGTH])
+{
+    (void)handle;
+    (void)cp;
+    (void)pub;
+    (void)sig;
+    (void)h;
+
+    return (ASYM_CRYPT_RETURN_FAILURE);
+}
+
+AsymCrypt_Return_t AsymCrypt_poll(AsymCrypt_Handle handle)
+{
+    (void)handle;
+
+    return (ASYM_CRYPT_RETURN_FAILURE);
+}
+
+AsymCrypt_Return_t AsymCrypt_wait(AsymCrypt_Handle handle, uint32_t timeout)
+{
+    (void)handle;
+    (void)timeout;
+
+    return (ASYM_CRYPT_RETURN_FAILURE);
+}
+
 uint32_t PKE_countLeadingZeros(uint32_t x)
 {
     uint32_t bit_count = 0, lz = 0;
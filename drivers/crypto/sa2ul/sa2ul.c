@@ -45,6 +45,9 @@
 #include <drivers/hw_include/cslr.h>
 #include <kernel/dpl/DebugP.h>
 #include <kernel/dpl/CacheP.h>
+#include <kernel/dpl/ClockP.h>
+#include <kernel/dpl/HwiP.h>
+#include <kernel/dpl/SemaphoreP.h>
 #include <security_common/drivers/crypto/sa2ul/sa2ul.h>
 #include <drivers/hw_include/am64x_am243x/cslr_soc_baseaddress.h>
 #include <drivers/sciclient.h>
@@ -58,10 +61,15 @@
 /** \brief Check address aligned */
 #define SA2UL_IS_ALIGNED_PTR(ptr, align)                ((((uint32_t)ptr) & ((align)-1)) == 0)
 
+/** \brief Check value is a non-zero power of 2 */
+#define SA2UL_IS_POWER_OF_2(val)                        (((val) != 0U) && (((val) & ((val) - 1U)) == 0U))
+
 #define SA2UL_IS_HMAC(alg)                              ((alg & 0x10u) == 0)
+/* Check for an operation chaining the encryption and authentication engines */
+#define SA2UL_IS_ENC_AUTH(op)                           (((op) == SA2UL_OP_ENC_THEN_AUTH) || ((op) == SA2UL_OP_AUTH_THEN_ENC))
 
 /** \brief Number of items in MCE data array */
-#define SA2UL_MCE_DATA_NUM                              (6)
+#define SA2UL_MCE_DATA_NUM                              (9)
 
 /** \brief Pack 2 instructions as 3 bytes */
 #define MCE_PACK2(op1, f21, f11, f01, op2, f22, f12, f02) \
@@ -232,6 +240,39 @@
 #define SA2UL_AES_128_KEY_SIZE_IN_BITS                  (128U)
 #define SA2UL_AES_192_KEY_SIZE_IN_BITS                  (192U)
 #define SA2UL_AES_256_KEY_SIZE_IN_BITS                  (256U)
+
+/* Offset of the IV in the encryption engine context */
+#define SA2UL_SECCTX_ENC_AUX2_OFFSET                    (96U)
+/* Length of a command label header */
+#define SA2UL_CMDLBL_HDR_LEN                            (8U)
+
+#define SA2UL_HMAC_SHA_IPAD                             (0x36U)
+#define SA2UL_HMAC_SHA_OPAD                             (0x5CU)
+#define SA2UL_SHA256_BLOCK_SIZE_BYTES                   (64U)
+
+#define SA2UL_AES_BLOCK_SIZE_BYTES                      (16U)
+/* Longest encryption fragment, block aligned so that the chaining state carried
+ * in the context from one fragment to the next starts on a block */
+#define SA2UL_ENC_FRAGMENT_LENGTH                       (SA2UL_MAX_INPUT_LENGTH_ENC & ~(SA2UL_AES_BLOCK_SIZE_BYTES - 1U))
+
+/** \brief Time in micro seconds a synchronous operation waits for the engine to
+ *         return a packet before it gives up */
+#define SA2UL_PKT_TIMEOUT_USEC                          (1000000U)
+
+#define SA2UL_SHA256_ROTR(x, n)                         (((x) >> (n)) | ((x) << (32U - (n))))
+#define SA2UL_SHA256_CH(x, y, z)                        (((x) & (y)) ^ ((~(x)) & (z)))
+#define SA2UL_SHA256_MAJ(x, y, z)                       (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+#define SA2UL_SHA256_BSIG0(x)                           (SA2UL_SHA256_ROTR(x, 2U) ^ SA2UL_SHA256_ROTR(x, 13U) ^ SA2UL_SHA256_ROTR(x, 22U))
+#define SA2UL_SHA256_BSIG1(x)                           (SA2UL_SHA256_ROTR(x, 6U) ^ SA2UL_SHA256_ROTR(x, 11U) ^ SA2UL_SHA256_ROTR(x, 25U))
+#define SA2UL_SHA256_SSIG0(x)                           (SA2UL_SHA256_ROTR(x, 7U) ^ SA2UL_SHA256_ROTR(x, 18U) ^ ((x) >> 3U))
+#define SA2UL_SHA256_SSIG1(x)                           (SA2UL_SHA256_ROTR(x, 17U) ^ SA2UL_SHA256_ROTR(x, 19U) ^ ((x) >> 10U))
+
+/** \brief No job was submitted since the instance was opened */
+#define SA2UL_JOB_STATE_IDLE                            (0x00U)
+/** \brief The job owns the rings and was not reported yet */
+#define SA2UL_JOB_STATE_RUNNING                         (0x5AU)
+/** \brief The job was reported, packets may still return after a timeout */
+#define SA2UL_JOB_STATE_DONE                            (0xC3U)
 /* ========================================================================== */
 /*                         Structure Declarations                             */
 /* ========================================================================== */
@@ -298,6 +339,31 @@ struct SA2UL_HostDescrRx
     struct SA2UL_PSDataRx psData;
 } __attribute__((__packed__));
 
+/**
+ * \brief State of an asynchronous SA2UL job. An instance runs one job at a time,
+ *        the job is started by #SA2UL_submit and refilled as packets return.
+ */
+typedef struct SA2UL_Job_t
+{
+    SA2UL_Config            *config;            /**< Instance the job belongs to */
+    SA2UL_ContextObject     *ctxObj;            /**< Context of the job */
+    const uint8_t           *ptrInput;          /**< Next input byte to queue */
+    uint8_t                 *ptrOutput;         /**< Next output byte to queue */
+    uint32_t                pendingBytes;       /**< Bytes not queued yet */
+    uint32_t                maxLength;          /**< Max packet length of the operation */
+    uint32_t                numPktsInFlight;    /**< Packets queued and not returned yet */
+    SA2UL_JobCallback       callback;           /**< Completion callback, can be NULL */
+    void                    *args;              /**< Argument of the completion callback */
+    SA2UL_JobToken          token;              /**< Token of the job */
+    volatile uint32_t       state;              /**< State of the job */
+    volatile int32_t        status;             /**< Result of the job once done */
+    uint32_t                isDeadlineArmed;    /**< TRUE while the deadline clock runs */
+    SemaphoreP_Object       doneSem;            /**< Posted when the job is done */
+    ClockP_Object           deadlineClk;        /**< Expires the job at its deadline */
+    uint8_t                 *scratch;           /**< Scratch buffer for the CTR keystream and the gather egress */
+    uint32_t                scratchSize;        /**< Size of the scratch buffer, a multiple of the cache line */
+}SA2UL_Job;
+
 /*!
  * \brief Encoded block sizes for encryption algos
  */
@@ -411,6 +477,60 @@ static const uint8_t gSa2ulMceAes128Ecb[] =
         0,      0,      0,      0)
 };
 
+/*!
+ * \brief Encryption mode control engine instructions for AES-192-CBC decryption
+ */
+static const uint8_t gSa2ulMceAes192CbcDecr[] =
+{
+    MCE_PACK2(
+    /* PROC     192,    AES_Key,Reg0 */
+        8,      1,      1,      0,
+    /* OUTSET   Reg3,   Reg1,   Reg2 */
+        10,     3,      1,      2),
+    MCE_PACK2(
+    /* WAIT     Reg2,   Reg1,   Crypto_OUT ^ Src2 */
+        9,      2,      1,      7,
+    /* CP       Reg1,   -,      Reg0 */
+        4,      1,      0,      0),
+    MCE_PACK2(
+    /* OUT      -,      -,      - */
+        12,     0,      0,      0,
+        0,      0,      0,      0)
+};
+
+/*!
+ * \brief Encryption mode control engine instructions for AES-192-CBC encryption
+ */
+static const uint8_t gSa2ulMceAes192CbcEncr[] =
+{
+    MCE_PACK2(
+    /* XOR      Reg0,   Reg1,   Reg0 */
+        1,      0,      1,      0,
+    /* PROC     192,    AES_Key,Reg0 */
+        8,      1,      1,      0),
+    MCE_PACK2(
+    /* OUTSET   Reg2,  Crypto_OUT, Crypto_OUT */
+        10,     2,      4,      4,
+    /* WAIT_OUT Reg1,   ZERO,   Crypto_OUT */
+        11,     1,      7,      6)
+};
+
+/*!
+ * \brief Encryption mode control engine instructions for AES-192-ECB
+ */
+static const uint8_t gSa2ulMceAes192Ecb[] =
+{
+    MCE_PACK2(
+    /* PROC     192,   AES_Key, Reg0 */
+        8,      1,      1,      0,
+    /* OUTSET   Reg0,   Reg0,   Crypto_OUT */
+        10,     0,      0,      4),
+    MCE_PACK2(
+    /* WAIT_OUT Reg1,   ZERO,   Reg1 */
+        11,     1,      7,      1,
+        0,      0,      0,      0)
+};
+
 /*!
  * \brief Encryption mode control engine instructions for different modes
  */
@@ -451,6 +571,24 @@ static const SA2UL_MCEData gSa2ulMceDataArray[SA2UL_MCE_DATA_NUM] =
         0u, 0u, 0u,
         sizeof(gSa2ulMceAes128CbcDecr),
         gSa2ulMceAes128CbcDecr
+    },
+    {
+        /* AES-192-ECB */
+        0u, 0u, 0u,
+        sizeof(gSa2ulMceAes192Ecb),
+        gSa2ulMceAes192Ecb
+    },
+    {
+        /* AES-192-CBC encryption */
+        0u, 0u, 0u,
+        sizeof(gSa2ulMceAes192CbcEncr),
+        gSa2ulMceAes192CbcEncr
+    },
+    {
+        /* AES-192-CBC decryption */
+        0u, 0u, 0u,
+        sizeof(gSa2ulMceAes192CbcDecr),
+        gSa2ulMceAes192CbcDecr
     }
 };
 
@@ -461,7 +599,10 @@ enum
     MCE_DATA_ARRAY_INDEX_AES_256_CBC_DECRYPT,
     MCE_DATA_ARRAY_INDEX_AES_128_ECB ,
     MCE_DATA_ARRAY_INDEX_AES_128_CBC_ENCRYPT,
-    MCE_DATA_ARRAY_INDEX_AES_128_CBC_DECRYPT
+    MCE_DATA_ARRAY_INDEX_AES_128_CBC_DECRYPT,
+    MCE_DATA_ARRAY_INDEX_AES_192_ECB,
+    MCE_DATA_ARRAY_INDEX_AES_192_CBC_ENCRYPT,
+    MCE_DATA_ARRAY_INDEX_AES_192_CBC_DECRYPT
 };
 
 static const uint32_t gSa2ulHashSizeBytes[] =
@@ -555,6 +696,26 @@ const uint32_t gSa2ulAesTe4[] = {
     0xb0b0b0b0U, 0x54545454U, 0xbbbbbbbbU, 0x16161616U
 };
 
+/* SHA-256 initial hash value */
+static const uint32_t gSa2ulSha256Iv[8] =
+{
+    0x6a09e667U, 0xbb67ae85U, 0x3c6ef372U, 0xa54ff53aU,
+    0x510e527fU, 0x9b05688cU, 0x1f83d9abU, 0x5be0cd19U
+};
+
+/* SHA-256 round constants */
+static const uint32_t gSa2ulSha256K[64] =
+{
+    0x428a2f98U, 0x71374491U, 0xb5c0fbcfU, 0xe9b5dba5U, 0x3956c25bU, 0x59f111f1U, 0x923f82a4U, 0xab1c5ed5U,
+    0xd807aa98U, 0x12835b01U, 0x243185beU, 0x550c7dc3U, 0x72be5d74U, 0x80deb1feU, 0x9bdc06a7U, 0xc19bf174U,
+    0xe49b69c1U, 0xefbe4786U, 0x0fc19dc6U, 0x240ca1ccU, 0x2de92c6fU, 0x4a7484aaU, 0x5cb0a9dcU, 0x76f988daU,
+    0x983e5152U, 0xa831c66dU, 0xb00327c8U, 0xbf597fc7U, 0xc6e00bf3U, 0xd5a79147U, 0x06ca6351U, 0x14292967U,
+    0x27b70a85U, 0x2e1b2138U, 0x4d2c6dfcU, 0x53380d13U, 0x650a7354U, 0x766a0abbU, 0x81c2c92eU, 0x92722c85U,
+    0xa2bfe8a1U, 0xa81a664bU, 0xc24b8b70U, 0xc76c51a3U, 0xd192e819U, 0xd6990624U, 0xf40e3585U, 0x106aa070U,
+    0x19a4c116U, 0x1e376c08U, 0x2748774cU, 0x34b0bcb5U, 0x391c0cb3U, 0x4ed8aa4aU, 0x5b9cca4fU, 0x682e6ff3U,
+    0x748f82eeU, 0x78a5636fU, 0x84c87814U, 0x8cc70208U, 0x90befffaU, 0xa4506cebU, 0xbef9a3f7U, 0xc67178f2U
+};
+
 /* for 128-bit blocks, AES never uses more than 10 rcon values */
 static const uint32_t gSa2ulAesRcon[] =
 {
@@ -569,8 +730,11 @@ static void SA2UL_ringAccelWriteDescr(SA2UL_Config *config, uint32_t ringNum, ui
 static uint64_t SA2UL_ringAccelReadDescr(SA2UL_Config *config,uint32_t ringNum);
 static uint32_t SA2UL_storageQinsert (SA2UL_Object *object,uint64_t val);
 static int32_t SA2UL_getMceIndex(SA2UL_ContextObject *ctxObj, uint8_t *aesKeyInvFlag);
+static int32_t SA2UL_contextBuild(SA2UL_Handle handle, SA2UL_ContextObject *ctxObj, uint32_t isKeyCached);
 static void SA2UL_aesInvKey(uint32_t *invKey, uint32_t *cipherKey, int32_t keyBits);
 static int32_t SA2UL_aesKeyExpandEnc(uint32_t *rk, uint32_t *cipherKey, int32_t keyBits);
+static void SA2UL_sha256Compress(uint32_t *state, const uint8_t *block);
+static void SA2UL_hmacSha256KeySched(uint32_t *keySched, const uint8_t *key, uint32_t keySize);
 static void SA2UL_u32LeToU8(uint8_t *dest, const uint32_t *src, uint32_t len);
 static void SA2UL_u8LeToU32(uint32_t *dest, const uint8_t *src, uint32_t len);
 static void SA2UL_64bEndianSwap(uint32_t *dest, const uint32_t *src, uint32_t len);
@@ -578,16 +742,38 @@ static int32_t SA2UL_setupTxChannel(SA2UL_Config  *config);
 static int32_t SA2UL_setupRxChannel(SA2UL_Config  *config);
 static int32_t SA2UL_dmaInit(SA2UL_Config *config);
 static int32_t SA2UL_configInstance(SA2UL_Config *config);
-static int32_t SA2UL_checkOpenParams(const SA2UL_Params *prms);
+static void SA2UL_setDefaultParams(SA2UL_Params *prms, const SA2UL_Attrs *attrs);
+static int32_t SA2UL_checkOpenParams(const SA2UL_Params *prms, const SA2UL_Attrs *attrs);
 static int32_t SA2UL_pushBuffer(SA2UL_ContextObject *pCtxObj,const uint8_t  *input, uint32_t ilen, uint8_t  *output);
+static int32_t SA2UL_queueBuffer(SA2UL_ContextObject *pCtxObj,const uint8_t  *input, uint32_t ilen, uint8_t  *output);
 static int32_t SA2UL_popBuffer(SA2UL_ContextObject *pCtxObj, uint64_t *doneBuf, uint32_t *doneBufSize, uint8_t *dataTransferDone);
+static uint32_t SA2UL_getMaxPktLength(const SA2UL_ContextObject *pCtxObj);
+static uint32_t SA2UL_getHashBlkSizeBytes(const SA2UL_ContextObject *pCtxObj);
+static int32_t SA2UL_checkEncLength(const SA2UL_ContextObject *pCtxObj, uint32_t ilen);
+static int32_t SA2UL_processPackets(SA2UL_ContextObject *pCtxObj,const uint8_t  *input, uint32_t ilen, uint8_t  *output);
+static int32_t SA2UL_processFragments(SA2UL_ContextObject *pCtxObj, const SA2UL_Fragment *fragList, uint32_t numFrags, uint8_t *output);
+static void SA2UL_ctrFill(const SA2UL_ContextObject *pCtxObj, uint8_t *ctrBlock, uint8_t *output, uint32_t len);
+static int32_t SA2UL_ctrProcess(SA2UL_ContextObject *pCtxObj,const uint8_t  *input, uint32_t ilen, uint8_t  *output);
 static int32_t SA2UL_hwInit(SA2UL_Attrs  *attrs);
 static uint32_t SA2UL_hwDeInit(SA2UL_Attrs  *attrs);
+static uint32_t SA2UL_isEngineInUse(uint32_t saBaseAddr);
+static int32_t SA2UL_jobInit(SA2UL_Config *config, uint32_t index);
+static void SA2UL_jobDeInit(SA2UL_Config *config);
+static int32_t SA2UL_jobReap(SA2UL_Job *ptrJob);
+static void SA2UL_jobProgress(SA2UL_Job *ptrJob);
+static uint32_t SA2UL_jobFinish(SA2UL_Job *ptrJob, int32_t status);
+static void SA2UL_jobNotify(SA2UL_Job *ptrJob);
+static void SA2UL_jobRxRingIsr(Udma_EventHandle eventHandle, uint32_t eventType, void *appData);
+static void SA2UL_jobDeadlineExpired(ClockP_Object *obj, void *args);
 /* ========================================================================== */
 /*                            Global Variables                                */
 /* ========================================================================== */
 
-/* None */
+/** \brief Asynchronous job of each instance */
+static SA2UL_Job gSa2ulJob[SA2UL_INSTANCES_MAX];
+
+/** \brief Built-in scratch buffer of each instance, on its own cache lines */
+static uint8_t gSa2ulScratch[SA2UL_INSTANCES_MAX][SA2UL_DEFAULT_SCRATCH_SIZE] __attribute__((aligned(SA2UL_SCRATCH_ALIGN)));
 
 /* ========================================================================== */
 /*                          Function Definitions                              */
@@ -798,8 +984,9 @@ SA2UL_Handle SA2UL_open(uint32_t index, const SA2UL_Params *params)
             SA2UL_Params_init(&object->prms);
         }
 
-        /* Check open parameters */
-        retVal = SA2UL_checkOpenParams(&object->prms);
+        /* Resolve parameters left to the instance defaults and check them */
+        SA2UL_setDefaultParams(&object->prms, config->attrs);
+        retVal = SA2UL_checkOpenParams(&object->prms, config->attrs);
     }
 
     if(SystemP_SUCCESS == retVal)
@@ -811,11 +998,17 @@ SA2UL_Handle SA2UL_open(uint32_t index, const SA2UL_Params *params)
             /* Initialize DMA */
             retVal = SA2UL_dmaInit(config);
         }
+        if(SystemP_SUCCESS == retVal)
+        {
+            /* Asynchronous job state and completion interrupt */
+            retVal = SA2UL_jobInit(config, index);
+        }
     }
 
     if(SystemP_SUCCESS == retVal)
     {
-        object->isOpen = TRUE;
+        object->isOpen      = TRUE;
+        object->numContexts = 0U;
         handle = (SA2UL_Handle) config;
     }
 
@@ -836,25 +1029,183 @@ void SA2UL_close(SA2UL_Handle handle)
     SA2UL_Object *object;
     SA2UL_Config *config;
     const SA2UL_Attrs *attrs;
+    SA2UL_Job *ptrJob;
+    uint32_t isDone = FALSE;
+    uintptr_t key;
     config = (SA2UL_Config *) handle;
     if((NULL != config) && (config->object != NULL) && (config->object->isOpen != (uint32_t)FALSE))
     {
         object = config->object;
         attrs = config->attrs;
+        ptrJob = (SA2UL_Job *)object->jobObj;
+        if(NULL != ptrJob)
+        {
+            /* A running job is completed with a failure before its channels go away */
+            key = HwiP_disable();
+            isDone = SA2UL_jobFinish(ptrJob, SystemP_FAILURE);
+            HwiP_restore(key);
+            if(isDone == TRUE)
+            {
+                SA2UL_jobNotify(ptrJob);
+            }
+        }
+        SA2UL_jobDeInit(config);
         Udma_chClose(object->txChHandle);
         Udma_chClose(object->rxChHandle[0]);
         Udma_chClose(object->rxChHandle[1]);
-        SA2UL_hwDeInit(config->attrs);
         DebugP_assert(NULL != object);
         DebugP_assert(NULL != attrs);
         object->isOpen = FALSE;
-        /* TO module disable */
+        /* TO module disable, the engines are shared by every instance of the
+         * same SA2UL and stay enabled while another one is open */
         handle = NULL;
-        SA2UL_hwDeInit(config->attrs);
+        if(SA2UL_isEngineInUse(attrs->saBaseAddr) == FALSE)
+        {
+            SA2UL_hwDeInit(config->attrs);
+        }
+    }
+    return;
+}
+
+int32_t SA2UL_groupOpen(SA2UL_Group *group, const uint32_t *indexList, const SA2UL_Params *paramsList,
+                        uint32_t numChannels, uint32_t policy)
+{
+    int32_t retVal = SystemP_SUCCESS;
+    uint32_t i, j;
+    const SA2UL_Attrs *attrs;
+    const SA2UL_Attrs *otherAttrs;
+
+    if((NULL == group) || (NULL == indexList) ||
+       (numChannels == 0U) || (numChannels > SA2UL_GROUP_CHANNELS_MAX) ||
+       ((policy != SA2UL_GROUP_POLICY_ROUND_ROBIN) && (policy != SA2UL_GROUP_POLICY_LEAST_LOADED)))
+    {
+        retVal = SystemP_FAILURE;
+    }
+    else
+    {
+        /* Contexts allocated on different channels must not share a security context Id */
+        for(i = 0U; (i < numChannels) && (SystemP_SUCCESS == retVal); i++)
+        {
+            if(indexList[i] >= gSa2ulConfigNum)
+            {
+                retVal = SystemP_FAILURE;
+            }
+            for(j = 0U; (j < i) && (SystemP_SUCCESS == retVal); j++)
+            {
+                attrs      = gSa2ulConfig[indexList[i]].attrs;
+                otherAttrs = gSa2ulConfig[indexList[j]].attrs;
+                if((attrs->contextIdStart < (otherAttrs->contextIdStart + otherAttrs->contextIdMaxNum)) &&
+                   (otherAttrs->contextIdStart < (attrs->contextIdStart + attrs->contextIdMaxNum)))
+                {
+                    retVal = SystemP_FAILURE;
+                }
+            }
+        }
+    }
+
+    if(SystemP_SUCCESS == retVal)
+    {
+        memset(group, 0, sizeof(SA2UL_Group));
+        group->policy = policy;
+        for(i = 0U; (i < numChannels) && (SystemP_SUCCESS == retVal); i++)
+        {
+            group->channel[i] = SA2UL_open(indexList[i], (NULL != paramsList) ? &paramsList[i] : NULL);
+            if(NULL == group->channel[i])
+            {
+                retVal = SystemP_FAILURE;
+            }
+            else
+            {
+                group->numChannels++;
+            }
+        }
+        if(SystemP_SUCCESS != retVal)
+        {
+            /* Close the channels opened so far */
+            SA2UL_groupClose(group);
+        }
+    }
+
+    return (retVal);
+}
+
+void SA2UL_groupClose(SA2UL_Group *group)
+{
+    uint32_t i;
+
+    if(NULL != group)
+    {
+        for(i = 0U; i < group->numChannels; i++)
+        {
+            SA2UL_close(group->channel[i]);
+        }
+        memset(group, 0, sizeof(SA2UL_Group));
     }
     return;
 }
 
+int32_t SA2UL_groupContextAlloc(SA2UL_Group *group, SA2UL_ContextObject *ctxObj, const SA2UL_ContextParams *ctxPrms)
+{
+    int32_t retVal = SystemP_SUCCESS;
+    uint32_t i, index, chosen, minContexts;
+    uintptr_t key;
+    SA2UL_Object *object;
+
+    if((NULL == group) || (group->numChannels == 0U))
+    {
+        retVal = SystemP_FAILURE;
+    }
+    else
+    {
+        /* Channel pick is shared by every task allocating on the group */
+        key = HwiP_disable();
+
+        chosen      = group->nextChannel % group->numChannels;
+        minContexts = ((SA2UL_Config *)group->channel[chosen])->object->numContexts;
+        if(group->policy == SA2UL_GROUP_POLICY_LEAST_LOADED)
+        {
+            /* Fewest contexts wins, ties go to the next channel in turn */
+            for(i = 1U; i < group->numChannels; i++)
+            {
+                index  = (group->nextChannel + i) % group->numChannels;
+                object = ((SA2UL_Config *)group->channel[index])->object;
+                if(object->numContexts < minContexts)
+                {
+                    chosen      = index;
+                    minContexts = object->numContexts;
+                }
+            }
+        }
+        group->nextChannel = (chosen + 1U) % group->numChannels;
+
+        HwiP_restore(key);
+
+        retVal = SA2UL_contextAlloc(group->channel[chosen], ctxObj, ctxPrms);
+    }
+
+    return (retVal);
+}
+
+/**
+ * \brief  Check whether any open instance uses the SA2UL at saBaseAddr
+ */
+static uint32_t SA2UL_isEngineInUse(uint32_t saBaseAddr)
+{
+    uint32_t isInUse = FALSE;
+    uint32_t i;
+
+    for(i = 0U; i < gSa2ulConfigNum; i++)
+    {
+        if((gSa2ulConfig[i].object->isOpen == TRUE) &&
+           (gSa2ulConfig[i].attrs->saBaseAddr == saBaseAddr))
+        {
+            isInUse = TRUE;
+        }
+    }
+
+    return (isInUse);
+}
+
 static int32_t SA2UL_aesKeyExpandEnc(uint32_t *rk, uint32_t *cipherKey, int32_t keyBits)
 {
 	int32_t i = 0;
@@ -1006,16 +1357,9 @@ static void SA2UL_aesInvKey(uint32_t *invKey, uint32_t *cipherKey, int32_t keyBi
 int32_t SA2UL_contextAlloc(SA2UL_Handle handle, SA2UL_ContextObject *ctxObj, const SA2UL_ContextParams *ctxPrms)
 {
     uint32_t retVal = SystemP_SUCCESS;
-    SA2UL_SecCtx sc;
-    int32_t mcDataIndex;
-    uint8_t aesKeyInvFlag;
-    uint64_t authLen;
     SA2UL_Object *saObj;
     SA2UL_Config  *saCfg;
-    SA2UL_Attrs   *saAttrs;
-    saCfg = (SA2UL_Config *) handle;
-    saObj = saCfg->object;
-    saAttrs = saCfg->attrs;
+    uintptr_t key;
 
     if((NULL == handle) || (NULL == ctxObj) || (NULL == ctxPrms))
     {
@@ -1023,6 +1367,8 @@ int32_t SA2UL_contextAlloc(SA2UL_Handle handle, SA2UL_ContextObject *ctxObj, con
     }
     else
     {
+        saCfg = (SA2UL_Config *) handle;
+        saObj = saCfg->object;
         if(!SA2UL_IS_ALIGNED_PTR(ctxObj, SA2UL_CACHELINE_ALIGNMENT))
         {
             retVal =  SystemP_FAILURE;
@@ -1031,224 +1377,921 @@ int32_t SA2UL_contextAlloc(SA2UL_Handle handle, SA2UL_ContextObject *ctxObj, con
         {
             memcpy(&ctxObj->ctxPrms, ctxPrms, sizeof(SA2UL_ContextParams));
 
-            /* Increment global context-ID */
+            /* Increment global context-ID, the instance may be shared by the tasks of a group */
+            key = HwiP_disable();
             ctxObj->secCtxId = saObj->contextId;
             saObj->contextId++;
-            ctxObj->txBytesCnt = 0u;
-            ctxObj->rxBytesCnt = 0u;
-            ctxObj->computationStatus = 0u;
-            ctxObj->sa2ulErrCnt = 0u;
-
-            memset(&sc, 0, sizeof(SA2UL_SecCtx));
-
-            authLen = (ctxObj->ctxPrms.inputLen << 3) ;
+            HwiP_restore(key);
 
-            if(ctxObj->ctxPrms.opType == SA2UL_OP_AUTH)
-            {
-                if(SA2UL_IS_HMAC(ctxObj->ctxPrms.hashAlg))
-                {
-                    /* HMAC context not supported by ROM driver
-                    HMAC for ROM is done with SHA512 context */
-                    retVal = SystemP_FAILURE;
-                }
-                if (SystemP_SUCCESS == retVal)
-                {
-                    sc.u.auth.authCtx1 =
-                        CSL_FMK(SA2UL_AUTHCTX1_MODESEL, 0u) |
-                        CSL_FMK(SA2UL_AUTHCTX1_DEFAULT_NEXT_ENGINE_ID, SA2UL_ENGINE_CODE_DEFAULT_EGRESS_PORT) |
-                        CSL_FMK(SA2UL_AUTHCTX1_SW_CONTROL, 0x40u | ctxObj->ctxPrms.hashAlg);
-
-                    /* Authentication length in bits for basic hash, length in bits */
-                    sc.u.auth.authenticationLengthLo = authLen;
-                    sc.u.auth.authenticationLengthHi = (uint32_t)(authLen >> 32);
-
-                    sc.scctl.scctl1 =
-                        CSL_FMK(SA2UL_SCCTL1_OWNER, 1u) |
-                        CSL_FMK(SA2UL_SCCTL1_EVICT_DONE, 1u) |
-                        CSL_FMK(SA2UL_SCCTL1_FETCH_EVICT_CONTROL, 0x91u);
-                }
-            }
-            else if(ctxObj->ctxPrms.opType == SA2UL_OP_ENC)
-            {
-                if((ctxObj->ctxPrms.encAlg > SA2UL_ENC_ALG_MAX) ||
-                    (ctxObj->ctxPrms.encMode > SA2UL_ENC_MODE_MAX) ||
-                    (ctxObj->ctxPrms.encKeySize > SA2UL_ENC_KEYSIZE_MAX))
-                {
-                    retVal = SystemP_FAILURE;
-                }
-                if (SystemP_SUCCESS == retVal)
-                {
-                    mcDataIndex = SA2UL_getMceIndex(ctxObj , &aesKeyInvFlag);
-                    if (SystemP_FAILURE != mcDataIndex)
-                    {
-                        sc.u.enc.encrCtl =
-                        CSL_FMK(SA2UL_ENCRCTL_MODESEL, 0u) |
-                        CSL_FMK(SA2UL_ENCRCTL_USE_DKEK, 0u) |
-                        CSL_FMK(SA2UL_ENCRCTL_DEFAULT_NEXT_ENGINE_ID, SA2UL_ENGINE_CODE_DEFAULT_EGRESS_PORT) |
-                        CSL_FMK(SA2UL_ENCRCTL_TRAILER_EVERY_CHUNK, 0u) |
-                        CSL_FMK(SA2UL_ENCRCTL_TRAILER_AT_END, 0u) |
-                        CSL_FMK(SA2UL_ENCRCTL_PKT_DATA_SECTION_UPDATE, 1u) |
-                        CSL_FMK(SA2UL_ENCRCTL_ENCRYPT_DECRYPT, ctxObj->ctxPrms.encDirection) |
-                        CSL_FMK(SA2UL_ENCRCTL_BLK_SIZE, SA2UL_EncBlksizeEncoded[ctxObj->ctxPrms.encAlg]) |
-                        CSL_FMK(SA2UL_ENCRCTL_SOP_OFFSET, gSa2ulMceDataArray[mcDataIndex].sopOffset) |
-                        CSL_FMK(SA2UL_ENCRCTL_MIDDLE_OFFSET, gSa2ulMceDataArray[mcDataIndex].middleOffset) |
-                        CSL_FMK(SA2UL_ENCRCTL_EOP_OFFSET, gSa2ulMceDataArray[mcDataIndex].eopOffset);
-
-                        SA2UL_u8LeToU32(sc.u.enc.modeCtrlInstrs,
-                            gSa2ulMceDataArray[mcDataIndex].mcInstrs,
-                            gSa2ulMceDataArray[mcDataIndex].nMCInstrs);
-                        sc.u.enc.hwCtrlWord = 0;
-
-                        /* Copy key */
-                        SA2UL_u8LeToU32(sc.u.enc.encKeyValue, ctxObj->ctxPrms.key, SA2UL_MAX_KEY_SIZE_BYTES);
-
-                        if (aesKeyInvFlag == (uint8_t)TRUE)
-                        {
-                            /* Invert the key in context */
-                            SA2UL_aesInvKey(sc.u.enc.encKeyValue, sc.u.enc.encKeyValue, SA2UL_ENC_KEYSIZE_BITS(ctxObj->ctxPrms.encKeySize));
-                        }
-                        /* Copy IV */
-                        SA2UL_u8LeToU32(sc.u.enc.encAux2, ctxObj->ctxPrms.iv,SA2UL_MAX_IV_SIZE_BYTES);
-
-                        sc.scctl.scctl1 =
-                            CSL_FMK(SA2UL_SCCTL1_OWNER, 1u) |
-                            CSL_FMK(SA2UL_SCCTL1_EVICT_DONE, 1u) |
-                            CSL_FMK(SA2UL_SCCTL1_FETCH_EVICT_CONTROL, 0x8Du);
-                    }
-                }
-            }
-            else
-            {
-                /* Not implemented at present */
-                retVal = SystemP_FAILURE;
-            }
-            if (SystemP_SUCCESS == retVal)
-            {
-                sc.scctl.scctl2 =
-                CSL_FMK(SA2UL_SCCTL2_PRIVID, saAttrs->privId) |
-                CSL_FMK(SA2UL_SCCTL2_PRIV, saAttrs->priv) |
-                CSL_FMK(SA2UL_SCCTL2_SECURE, saAttrs->secure);
-
-                SA2UL_64bEndianSwap((uint32_t*)&ctxObj->secCtx, (uint32_t*)&sc, sizeof(sc));
-
-                /* Perform cache writeback */
-                CacheP_wb(&ctxObj->secCtx, sizeof(sc), CacheP_TYPE_ALLD);
-
-                /* Perform cache writeback */
-                CacheP_inv(&ctxObj->secCtx, sizeof(sc), CacheP_TYPE_ALLD);
-
-                ctxObj->handle = (SA2UL_Config *)handle;
-            }
+            /* Key schedule is computed here once, SA2UL_contextReset reuses it */
+            retVal = SA2UL_contextBuild(handle, ctxObj, FALSE);
+        }
+        if (SystemP_SUCCESS == retVal)
+        {
+            /* Same lock as the channel pick of SA2UL_groupContextAlloc */
+            key = HwiP_disable();
+            saObj->numContexts++;
+            HwiP_restore(key);
         }
     }
     return (retVal);
 }
 
-int32_t SA2UL_contextFree(SA2UL_ContextObject *pCtxObj)
+int32_t SA2UL_contextReset(SA2UL_ContextObject *pCtxObj, const uint8_t *iv, uint32_t inputLen)
 {
     uint32_t retVal = SystemP_SUCCESS;
 
-    if(NULL == pCtxObj)
+    if((NULL == pCtxObj) || (NULL == pCtxObj->handle))
     {
         retVal = SystemP_FAILURE;
     }
     else
     {
-        if(pCtxObj->totalLengthInBytes != pCtxObj->txBytesCnt)
+        /* Every packet of the previous message must have returned */
+        if(pCtxObj->txBytesCnt != pCtxObj->rxBytesCnt)
         {
             retVal = SystemP_FAILURE;
         }
-        else
+        if((SystemP_SUCCESS == retVal) && (pCtxObj->ctxPrms.opType != SA2UL_OP_AUTH))
         {
-            memset(&pCtxObj->secCtx, 0, sizeof(SA2UL_SecCtx));
+            if(NULL == iv)
+            {
+                retVal = SystemP_FAILURE;
+            }
+            else
+            {
+                memcpy(pCtxObj->ctxPrms.iv, iv, SA2UL_MAX_IV_SIZE_BYTES);
+            }
+        }
+        if(SystemP_SUCCESS == retVal)
+        {
+            pCtxObj->ctxPrms.inputLen   = inputLen;
+            pCtxObj->totalLengthInBytes = inputLen;
+            retVal = SA2UL_contextBuild(pCtxObj->handle, pCtxObj, TRUE);
         }
     }
 
     return (retVal);
 }
 
-int32_t SA2UL_contextProcess(SA2UL_ContextObject *pCtxObj,const uint8_t  *input, uint32_t ilen, uint8_t  *output)
+/**
+ * \brief  Build the security context of a context object from its parameters
+ *         and write it back to memory for the engine to fetch.
+ *
+ * \param  handle       #SA2UL_Handle the context belongs to
+ * \param  ctxObj       Pointer to #SA2UL_ContextObject structure
+ * \param  isKeyCached  TRUE to load encKeySched as computed by an earlier build,
+ *                      FALSE to compute it from the key parameter
+ */
+static int32_t SA2UL_contextBuild(SA2UL_Handle handle, SA2UL_ContextObject *ctxObj, uint32_t isKeyCached)
 {
-    uint32_t retVal             = SystemP_SUCCESS;
-    uint64_t doneBufAddr        = 0;
-    uint32_t donedataLen        = 0;
-    uint8_t  doneFlag           = 0;
-    uint32_t processIterations  = 0;
-    uint32_t numChunks          = 0;
-    uint32_t remainingBytes     = 0;
-    uint32_t maxLength          = 0;
-    uint8_t *ptrInput           = (uint8_t *)input;
-    uint8_t *ptrOutput          = output;
+    uint32_t retVal = SystemP_SUCCESS;
+    SA2UL_SecCtx sc;
+    int32_t mcDataIndex;
+    uint8_t aesKeyInvFlag;
+    uint8_t encDirection;
+    uint64_t authLen;
+    SA2UL_Attrs   *saAttrs;
+    saAttrs = ((SA2UL_Config *) handle)->attrs;
 
-    if(NULL == pCtxObj || NULL == input || NULL == output)
-    {
-        retVal = SystemP_FAILURE;
-    }
-    else
+    ctxObj->txBytesCnt = 0u;
+    ctxObj->rxBytesCnt = 0u;
+    ctxObj->computationStatus = 0u;
+    ctxObj->sa2ulErrCnt = 0u;
+
+    memset(&sc, 0, sizeof(SA2UL_SecCtx));
+
+    authLen = (ctxObj->ctxPrms.inputLen << 3) ;
+
+    if(ctxObj->ctxPrms.opType == SA2UL_OP_AUTH)
     {
-        if( pCtxObj->ctxPrms.opType ==  SA2UL_OP_ENC)
+        if(SA2UL_IS_HMAC(ctxObj->ctxPrms.hashAlg))
         {
-            numChunks      = ilen / SA2UL_MAX_INPUT_LENGTH_ENC;
-            remainingBytes = ilen % SA2UL_MAX_INPUT_LENGTH_ENC;
-            maxLength      = SA2UL_MAX_INPUT_LENGTH_ENC;
+            /* HMAC context not supported by ROM driver
+            HMAC for ROM is done with SHA512 context */
+            retVal = SystemP_FAILURE;
         }
-        else if( pCtxObj->ctxPrms.opType ==  SA2UL_OP_AUTH)
+        if (SystemP_SUCCESS == retVal)
         {
-            numChunks      = ilen / SA2UL_MAX_INPUT_LENGTH_AUTH;
-            remainingBytes = ilen % SA2UL_MAX_INPUT_LENGTH_AUTH;
-            maxLength      = SA2UL_MAX_INPUT_LENGTH_AUTH;
+            sc.u.auth.authCtx1 =
+                CSL_FMK(SA2UL_AUTHCTX1_MODESEL, 0u) |
+                CSL_FMK(SA2UL_AUTHCTX1_DEFAULT_NEXT_ENGINE_ID, SA2UL_ENGINE_CODE_DEFAULT_EGRESS_PORT) |
+                CSL_FMK(SA2UL_AUTHCTX1_SW_CONTROL, 0x40u | ctxObj->ctxPrms.hashAlg);
+
+            /* Authentication length in bits for basic hash, length in bits */
+            sc.u.auth.authenticationLengthLo = authLen;
+            sc.u.auth.authenticationLengthHi = (uint32_t)(authLen >> 32);
+
+            sc.scctl.scctl1 =
+                CSL_FMK(SA2UL_SCCTL1_OWNER, 1u) |
+                CSL_FMK(SA2UL_SCCTL1_EVICT_DONE, 1u) |
+                CSL_FMK(SA2UL_SCCTL1_FETCH_EVICT_CONTROL, 0x91u);
         }
-        else
+    }
+    else if(ctxObj->ctxPrms.opType == SA2UL_OP_ENC)
+    {
+        if((ctxObj->ctxPrms.encAlg > SA2UL_ENC_ALG_MAX) ||
+            (ctxObj->ctxPrms.encMode > SA2UL_ENC_MODE_MAX) ||
+            (ctxObj->ctxPrms.encKeySize > SA2UL_ENC_KEYSIZE_MAX))
         {
             retVal = SystemP_FAILURE;
         }
-
-        if(SystemP_SUCCESS == retVal)
+        encDirection = ctxObj->ctxPrms.encDirection;
+        if ((SystemP_SUCCESS == retVal) && (ctxObj->ctxPrms.encMode == SA2UL_ENC_MODE_CTR))
         {
-
-            for(processIterations = 0; processIterations < numChunks;processIterations++)
+            if(((ctxObj->ctxPrms.ctrWidth & 7U) != 0U) ||
+               (ctxObj->ctxPrms.ctrWidth > (SA2UL_AES_BLOCK_SIZE_BYTES << 3)) ||
+               ((ctxObj->ctxPrms.inputLen & (SA2UL_AES_BLOCK_SIZE_BYTES - 1U)) != 0U))
             {
-                retVal      = SA2UL_pushBuffer(pCtxObj,ptrInput, maxLength, ptrOutput);
-                if(SystemP_SUCCESS == retVal)
-                {
-                    /* Consider timeout */
-                    while((doneBufAddr != (uint64_t)ptrInput) && ( donedataLen != maxLength) && (doneFlag != (uint8_t)TRUE))
-                    {
-                        retVal = SA2UL_popBuffer(pCtxObj, &doneBufAddr, &donedataLen, &doneFlag);
-                    }
-                }
-                ptrInput    = ptrInput + ((processIterations + 1) * maxLength);
-                ptrOutput   = ptrOutput + ((processIterations + 1) * maxLength);
+                retVal = SystemP_FAILURE;
             }
-            if(SystemP_SUCCESS == retVal)
+            else
+            {
+                /* The engine produces the keystream, decryption encrypts too */
+                encDirection = SA2UL_ENC_DIR_ENCRYPT;
+                memcpy(ctxObj->ctrBlock, ctxObj->ctxPrms.iv, SA2UL_MAX_IV_SIZE_BYTES);
+            }
+        }
+        if (SystemP_SUCCESS == retVal)
+        {
+            mcDataIndex = SA2UL_getMceIndex(ctxObj , &aesKeyInvFlag);
+            if (SystemP_FAILURE == mcDataIndex)
+            {
+                retVal = SystemP_FAILURE;
+            }
+            else
             {
-                if(remainingBytes != 0)
+                sc.u.enc.encrCtl =
+                CSL_FMK(SA2UL_ENCRCTL_MODESEL, 0u) |
+                CSL_FMK(SA2UL_ENCRCTL_USE_DKEK, 0u) |
+                CSL_FMK(SA2UL_ENCRCTL_DEFAULT_NEXT_ENGINE_ID, SA2UL_ENGINE_CODE_DEFAULT_EGRESS_PORT) |
+                CSL_FMK(SA2UL_ENCRCTL_TRAILER_EVERY_CHUNK, 0u) |
+                CSL_FMK(SA2UL_ENCRCTL_TRAILER_AT_END, 0u) |
+                CSL_FMK(SA2UL_ENCRCTL_PKT_DATA_SECTION_UPDATE, 1u) |
+                CSL_FMK(SA2UL_ENCRCTL_ENCRYPT_DECRYPT, encDirection) |
+                CSL_FMK(SA2UL_ENCRCTL_BLK_SIZE, SA2UL_EncBlksizeEncoded[ctxObj->ctxPrms.encAlg]) |
+                CSL_FMK(SA2UL_ENCRCTL_SOP_OFFSET, gSa2ulMceDataArray[mcDataIndex].sopOffset) |
+                CSL_FMK(SA2UL_ENCRCTL_MIDDLE_OFFSET, gSa2ulMceDataArray[mcDataIndex].middleOffset) |
+                CSL_FMK(SA2UL_ENCRCTL_EOP_OFFSET, gSa2ulMceDataArray[mcDataIndex].eopOffset);
+
+                SA2UL_u8LeToU32(sc.u.enc.modeCtrlInstrs,
+                    gSa2ulMceDataArray[mcDataIndex].mcInstrs,
+                    gSa2ulMceDataArray[mcDataIndex].nMCInstrs);
+                sc.u.enc.hwCtrlWord = 0;
+
+                if (isKeyCached == FALSE)
                 {
-                    retVal = SA2UL_pushBuffer(pCtxObj, ptrInput, remainingBytes, ptrOutput);
-                    if(SystemP_SUCCESS == retVal)
+                    /* Copy key */
+                    SA2UL_u8LeToU32(ctxObj->encKeySched, ctxObj->ctxPrms.key, SA2UL_MAX_KEY_SIZE_BYTES);
+
+                    if (aesKeyInvFlag == (uint8_t)TRUE)
                     {
-                        /* Consider timeout */
-                        while((doneBufAddr != (uint64_t)ptrInput) && ( donedataLen != remainingBytes ) && (doneFlag != (uint8_t)TRUE))
-                        {
-                            retVal = SA2UL_popBuffer(pCtxObj, &doneBufAddr, &donedataLen, &doneFlag);
-                        }
+                        /* Invert the key once per key, resets reuse it */
+                        SA2UL_aesInvKey(ctxObj->encKeySched, ctxObj->encKeySched, SA2UL_ENC_KEYSIZE_BITS(ctxObj->ctxPrms.encKeySize));
                     }
                 }
+                memcpy(sc.u.enc.encKeyValue, ctxObj->encKeySched, sizeof(sc.u.enc.encKeyValue));
+
+                /* Copy IV */
+                SA2UL_u8LeToU32(sc.u.enc.encAux2, ctxObj->ctxPrms.iv,SA2UL_MAX_IV_SIZE_BYTES);
+
+                sc.scctl.scctl1 =
+                    CSL_FMK(SA2UL_SCCTL1_OWNER, 1u) |
+                    CSL_FMK(SA2UL_SCCTL1_EVICT_DONE, 1u) |
+                    CSL_FMK(SA2UL_SCCTL1_FETCH_EVICT_CONTROL, 0x8Du);
             }
         }
     }
-    return (retVal);
-}
+    else if(SA2UL_IS_ENC_AUTH(ctxObj->ctxPrms.opType))
+    {
+        /* AES-CBC with HMAC-SHA256 in one packet, encryption is followed by
+         * authentication of the cipher text and decryption is preceded by it */
+        if((ctxObj->ctxPrms.encAlg != SA2UL_ENC_ALG_AES) ||
+           (ctxObj->ctxPrms.encMode != SA2UL_ENC_MODE_CBC) ||
+           (ctxObj->ctxPrms.encKeySize > SA2UL_ENC_KEYSIZE_MAX) ||
+           (ctxObj->ctxPrms.hashAlg != SA2UL_HASH_ALG_HMAC_SHA2_256) ||
+           (ctxObj->ctxPrms.authKeySize > SA2UL_MAX_HMAC_KEY_SIZE_BYTES) ||
+           (ctxObj->ctxPrms.inputLen > SA2UL_MAX_INPUT_LENGTH_ENC))
+        {
+            retVal = SystemP_FAILURE;
+        }
+        if((ctxObj->ctxPrms.opType == SA2UL_OP_ENC_THEN_AUTH) !=
+           (ctxObj->ctxPrms.encDirection == SA2UL_ENC_DIR_ENCRYPT))
+        {
+            retVal = SystemP_FAILURE;
+        }
+        if (SystemP_SUCCESS == retVal)
+        {
+            mcDataIndex = SA2UL_getMceIndex(ctxObj , &aesKeyInvFlag);
+            if (SystemP_FAILURE == mcDataIndex)
+            {
+                retVal = SystemP_FAILURE;
+            }
+        }
+        if (SystemP_SUCCESS == retVal)
+        {
+            /* The next engine comes from the command label of each packet */
+            sc.u.encAuth.encrCtl =
+            CSL_FMK(SA2UL_ENCRCTL_MODESEL, 0u) |
+            CSL_FMK(SA2UL_ENCRCTL_USE_DKEK, 0u) |
+            CSL_FMK(SA2UL_ENCRCTL_DEFAULT_NEXT_ENGINE_ID, SA2UL_ENGINE_CODE_DEFAULT_EGRESS_PORT) |
+            CSL_FMK(SA2UL_ENCRCTL_TRAILER_EVERY_CHUNK, 0u) |
+            CSL_FMK(SA2UL_ENCRCTL_TRAILER_AT_END, 0u) |
+            CSL_FMK(SA2UL_ENCRCTL_PKT_DATA_SECTION_UPDATE, 1u) |
+            CSL_FMK(SA2UL_ENCRCTL_ENCRYPT_DECRYPT, ctxObj->ctxPrms.encDirection) |
+            CSL_FMK(SA2UL_ENCRCTL_BLK_SIZE, SA2UL_EncBlksizeEncoded[ctxObj->ctxPrms.encAlg]) |
+            CSL_FMK(SA2UL_ENCRCTL_SOP_OFFSET, gSa2ulMceDataArray[mcDataIndex].sopOffset) |
+            CSL_FMK(SA2UL_ENCRCTL_MIDDLE_OFFSET, gSa2ulMceDataArray[mcDataIndex].middleOffset) |
+            CSL_FMK(SA2UL_ENCRCTL_EOP_OFFSET, gSa2ulMceDataArray[mcDataIndex].eopOffset);
+
+            SA2UL_u8LeToU32(sc.u.encAuth.modeCtrlInstrs,
+                gSa2ulMceDataArray[mcDataIndex].mcInstrs,
+                gSa2ulMceDataArray[mcDataIndex].nMCInstrs);
+            sc.u.encAuth.hwCtrlWord = 0;
+
+            if (isKeyCached == FALSE)
+            {
+                SA2UL_u8LeToU32(ctxObj->encKeySched, ctxObj->ctxPrms.key, SA2UL_MAX_KEY_SIZE_BYTES);
+                if (aesKeyInvFlag == (uint8_t)TRUE)
+                {
+                    SA2UL_aesInvKey(ctxObj->encKeySched, ctxObj->encKeySched, SA2UL_ENC_KEYSIZE_BITS(ctxObj->ctxPrms.encKeySize));
+                }
+
+                /* Hash states after the ipad and opad blocks */
+                SA2UL_hmacSha256KeySched(ctxObj->authKeySched, ctxObj->ctxPrms.authKey, ctxObj->ctxPrms.authKeySize);
+            }
+            memcpy(sc.u.encAuth.encKeyValue, ctxObj->encKeySched, sizeof(sc.u.encAuth.encKeyValue));
+
+            sc.u.encAuth.authCtx1 =
+                CSL_FMK(SA2UL_AUTHCTX1_MODESEL, 0u) |
+                CSL_FMK(SA2UL_AUTHCTX1_DEFAULT_NEXT_ENGINE_ID, SA2UL_ENGINE_CODE_DEFAULT_EGRESS_PORT) |
+                CSL_FMK(SA2UL_AUTHCTX1_SW_CONTROL, 0x40u | ctxObj->ctxPrms.hashAlg);
+
+            /* The inner hash starts after the ipad block */
+            authLen += gSa2ulHashBlkSizeBits[ctxObj->ctxPrms.hashAlg & 7u];
+            sc.u.encAuth.authenticationLengthLo = authLen;
+            sc.u.encAuth.authenticationLengthHi = (uint32_t)(authLen >> 32);
+
+            memcpy(sc.u.encAuth.innerDigest, &ctxObj->authKeySched[0], sizeof(sc.u.encAuth.innerDigest));
+            memcpy(sc.u.encAuth.outerDigest, &ctxObj->authKeySched[8], sizeof(sc.u.encAuth.outerDigest));
+
+            sc.scctl.scctl1 =
+                CSL_FMK(SA2UL_SCCTL1_OWNER, 1u) |
+                CSL_FMK(SA2UL_SCCTL1_EVICT_DONE, 1u) |
+                CSL_FMK(SA2UL_SCCTL1_FETCH_EVICT_CONTROL,
+                    (ctxObj->ctxPrms.opType == SA2UL_OP_ENC_THEN_AUTH) ? 0x8Du : 0x65u);
+        }
+    }
+    else
+    {
+        /* Not implemented at present */
+        retVal = SystemP_FAILURE;
+    }
+    if (SystemP_SUCCESS == retVal)
+    {
+        sc.scctl.scctl2 =
+        CSL_FMK(SA2UL_SCCTL2_PRIVID, saAttrs->privId) |
+        CSL_FMK(SA2UL_SCCTL2_PRIV, saAttrs->priv) |
+        CSL_FMK(SA2UL_SCCTL2_SECURE, saAttrs->secure);
+
+        SA2UL_64bEndianSwap((uint32_t*)&ctxObj->secCtx, (uint32_t*)&sc, sizeof(sc));
+
+        /* Perform cache writeback */
+        CacheP_wb(&ctxObj->secCtx, sizeof(sc), CacheP_TYPE_ALLD);
+
+        /* Perform cache writeback */
+        CacheP_inv(&ctxObj->secCtx, sizeof(sc), CacheP_TYPE_ALLD);
+
+        ctxObj->handle = (SA2UL_Config *)handle;
+    }
+    /* The local copy holds the key */
+    memset(&sc, 0, sizeof(SA2UL_SecCtx));
+
+    return (retVal);
+}
+
+int32_t SA2UL_contextFree(SA2UL_ContextObject *pCtxObj)
+{
+    uint32_t retVal = SystemP_SUCCESS;
+    SA2UL_Object *saObj;
+    SA2UL_Job *ptrJob;
+    uintptr_t key;
+
+    if(NULL == pCtxObj)
+    {
+        retVal = SystemP_FAILURE;
+    }
+    else
+    {
+        if(NULL != pCtxObj->handle)
+        {
+            /* Packets a timed out operation left in the rings are drained into this context first */
+            ptrJob = (SA2UL_Job *)((SA2UL_Config *)pCtxObj->handle)->object->jobObj;
+            if((NULL != ptrJob) && (ptrJob->ctxObj == pCtxObj))
+            {
+                (void)SA2UL_jobReap(ptrJob);
+            }
+        }
+
+        /* A completed or an aborted context is released once none of its packets is in flight */
+        if(pCtxObj->txBytesCnt != pCtxObj->rxBytesCnt)
+        {
+            retVal = SystemP_FAILURE;
+        }
+        else
+        {
+            memset(&pCtxObj->secCtx, 0, sizeof(SA2UL_SecCtx));
+            memset(pCtxObj->encKeySched, 0, sizeof(pCtxObj->encKeySched));
+            memset(pCtxObj->authKeySched, 0, sizeof(pCtxObj->authKeySched));
+            memset(pCtxObj->ctrBlock, 0, sizeof(pCtxObj->ctrBlock));
+            if(NULL != pCtxObj->handle)
+            {
+                /* Same lock as the channel pick of SA2UL_groupContextAlloc */
+                saObj = ((SA2UL_Config *)pCtxObj->handle)->object;
+                key = HwiP_disable();
+                if(saObj->numContexts != 0U)
+                {
+                    saObj->numContexts--;
+                }
+                HwiP_restore(key);
+            }
+            pCtxObj->handle = NULL;
+        }
+    }
+
+    return (retVal);
+}
+
+int32_t SA2UL_contextProcess(SA2UL_ContextObject *pCtxObj,const uint8_t  *input, uint32_t ilen, uint8_t  *output)
+{
+    uint32_t retVal             = SystemP_SUCCESS;
+
+    if(NULL == pCtxObj || NULL == input || NULL == output)
+    {
+        retVal = SystemP_FAILURE;
+    }
+    else
+    {
+        /* The rings are not available while an asynchronous job runs */
+        retVal = SA2UL_jobReap((SA2UL_Job *)((SA2UL_Config *)pCtxObj->handle)->object->jobObj);
+
+        if(SystemP_SUCCESS == retVal)
+        {
+            if((pCtxObj->ctxPrms.opType == SA2UL_OP_ENC) && (pCtxObj->ctxPrms.encMode == SA2UL_ENC_MODE_CTR))
+            {
+                retVal = SA2UL_ctrProcess(pCtxObj, input, ilen, output);
+            }
+            else
+            {
+                /* Checked once, before any packet is queued */
+                retVal = SA2UL_checkEncLength(pCtxObj, ilen);
+                if(SystemP_SUCCESS == retVal)
+                {
+                    retVal = SA2UL_processPackets(pCtxObj, input, ilen, output);
+                }
+            }
+        }
+    }
+    return (retVal);
+}
+
+int32_t SA2UL_contextProcessGather(SA2UL_ContextObject *pCtxObj, const SA2UL_Fragment *fragList, uint32_t numFrags)
+{
+    uint32_t retVal             = SystemP_SUCCESS;
+    uint32_t remainingBytes     = 0U;
+    uint32_t blkSize            = 0U;
+    uint32_t i;
+
+    if((NULL == pCtxObj) || (NULL == pCtxObj->handle) || (NULL == fragList) ||
+       (pCtxObj->ctxPrms.opType != SA2UL_OP_AUTH) || (pCtxObj->txBytesCnt > pCtxObj->totalLengthInBytes))
+    {
+        retVal = SystemP_FAILURE;
+    }
+    else
+    {
+        /* The fragments must complete the message, the last packet would not tear down the context otherwise.
+         * The packets before it carry the fragment flag and must end on a hash block. */
+        remainingBytes = pCtxObj->totalLengthInBytes - pCtxObj->txBytesCnt;
+        blkSize        = SA2UL_getHashBlkSizeBytes(pCtxObj);
+        for(i = 0U; i < numFrags; i++)
+        {
+            if(((NULL == fragList[i].addr) && (fragList[i].len != 0U)) || (fragList[i].len > remainingBytes))
+            {
+                retVal = SystemP_FAILURE;
+            }
+            else
+            {
+                remainingBytes = remainingBytes - fragList[i].len;
+                if((remainingBytes != 0U) &&
+                   (((pCtxObj->totalLengthInBytes - remainingBytes) & (blkSize - 1U)) != 0U))
+                {
+                    retVal = SystemP_FAILURE;
+                }
+            }
+        }
+        if(remainingBytes != 0U)
+        {
+            retVal = SystemP_FAILURE;
+        }
+    }
+
+    if(SystemP_SUCCESS == retVal)
+    {
+        /* The rings are not available while an asynchronous job runs */
+        retVal = SA2UL_jobReap((SA2UL_Job *)((SA2UL_Config *)pCtxObj->handle)->object->jobObj);
+    }
+    if(SystemP_SUCCESS == retVal)
+    {
+        /* The fragments are read by DMA, nothing in them is invalidated */
+        for(i = 0U; i < numFrags; i++)
+        {
+            if(fragList[i].len != 0U)
+            {
+                CacheP_wb((void *)fragList[i].addr, fragList[i].len, CacheP_TYPE_ALLD);
+            }
+        }
+
+        /* The data returned by the authentication engine is not needed, it goes into the scratch buffer */
+        retVal = SA2UL_processFragments(pCtxObj, fragList, numFrags, NULL);
+    }
+
+    return (retVal);
+}
+
+/**
+ * \brief  Longest packet of an operation, 0 for an unknown operation. Longer
+ *         inputs are queued as back to back fragments of this length.
+ */
+static uint32_t SA2UL_getMaxPktLength(const SA2UL_ContextObject *pCtxObj)
+{
+    uint32_t maxLength = 0U;
+
+    if( pCtxObj->ctxPrms.opType ==  SA2UL_OP_ENC)
+    {
+        maxLength      = SA2UL_ENC_FRAGMENT_LENGTH;
+    }
+    else if(SA2UL_IS_ENC_AUTH(pCtxObj->ctxPrms.opType))
+    {
+        /* Single packet, the length is checked against the message */
+        maxLength      = SA2UL_MAX_INPUT_LENGTH_ENC;
+    }
+    else if( pCtxObj->ctxPrms.opType ==  SA2UL_OP_AUTH)
+    {
+        maxLength      = SA2UL_MAX_INPUT_LENGTH_AUTH;
+    }
+    else
+    {
+        /* Unknown operation */
+    }
+
+    return (maxLength);
+}
+
+/**
+ * \brief  Hash block of an authentication context in bytes, a power of 2.
+ *         Unknown algorithms return 1, which aligns nothing.
+ */
+static uint32_t SA2UL_getHashBlkSizeBytes(const SA2UL_ContextObject *pCtxObj)
+{
+    uint32_t blkSize = gSa2ulHashBlkSizeBits[pCtxObj->ctxPrms.hashAlg & 7u] >> 3;
+
+    if(blkSize == 0U)
+    {
+        blkSize = 1U;
+    }
+
+    return (blkSize);
+}
+
+/**
+ * \brief  Check an encryption call against the message before anything is
+ *         queued. The packets are cut at #SA2UL_ENC_FRAGMENT_LENGTH, so only a
+ *         call which does not end the message must end on a block for the IV
+ *         chained to the next packet to start on one.
+ */
+static int32_t SA2UL_checkEncLength(const SA2UL_ContextObject *pCtxObj, uint32_t ilen)
+{
+    int32_t retVal = SystemP_SUCCESS;
+
+    if((pCtxObj->ctxPrms.opType == SA2UL_OP_ENC) &&
+       ((pCtxObj->txBytesCnt + ilen) != pCtxObj->totalLengthInBytes) &&
+       (((pCtxObj->txBytesCnt + ilen) & (SA2UL_AES_BLOCK_SIZE_BYTES - 1U)) != 0U))
+    {
+        retVal = SystemP_FAILURE;
+    }
+
+    return (retVal);
+}
+
+/**
+ * \brief  Run a buffer through the engine, keeping up to numDescPairs packets
+ *         in flight, and wait for all of them to return.
+ */
+static int32_t SA2UL_processPackets(SA2UL_ContextObject *pCtxObj,const uint8_t  *input, uint32_t ilen, uint8_t  *output)
+{
+    SA2UL_Fragment frag;
+
+    frag.addr = input;
+    frag.len  = ilen;
+
+    return (SA2UL_processFragments(pCtxObj, &frag, 1U, output));
+}
+
+/**
+ * \brief  Run a list of fragments through the engine as consecutive packets
+ *         of one message, keeping up to numDescPairs packets in flight, and
+ *         wait for all of them to return. The output is contiguous, or it is
+ *         dropped into the instance scratch buffer when output is NULL, so the
+ *         fragments are only read. Once the engine
+ *         flags a packet or a packet cannot be queued nothing more is queued
+ *         and the packets in flight are still reaped. SystemP_TIMEOUT is
+ *         returned when no packet comes back for #SA2UL_PKT_TIMEOUT_USEC; the
+ *         packets still in flight are then handed to the instance job, so
+ *         that #SA2UL_jobReap drains them into this context before the rings
+ *         are used again.
+ */
+static int32_t SA2UL_processFragments(SA2UL_ContextObject *pCtxObj, const SA2UL_Fragment *fragList, uint32_t numFrags, uint8_t *output)
+{
+    uint32_t retVal             = SystemP_SUCCESS;
+    uint64_t doneBufAddr        = 0;
+    uint32_t donedataLen        = 0;
+    uint8_t  doneFlag           = 0;
+    uint32_t maxLength          = 0;
+    uint32_t chunkLength        = 0;
+    uint32_t fragIndex          = 0;
+    uint32_t pendingBytes       = 0;
+    uint32_t numPktsInFlight    = 0;
+    uint32_t maxPktsInFlight    = 0;
+    uint8_t *ptrInput           = NULL;
+    uint8_t *ptrOutput          = output;
+    uint8_t *ptrSink            = NULL;
+    uint32_t timeoutTicks       = ClockP_usecToTicks((uint64_t)SA2UL_PKT_TIMEOUT_USEC);
+    uint32_t startTicks         = ClockP_getTicks();
+    SA2UL_Job *ptrJob           = (SA2UL_Job *)((SA2UL_Config *)pCtxObj->handle)->object->jobObj;
+    uintptr_t key;
+
+    /* Each packet in flight holds a Tx and a Rx descriptor */
+    maxPktsInFlight = ((SA2UL_Config *)pCtxObj->handle)->object->prms.numDescPairs;
+
+    maxLength = SA2UL_getMaxPktLength(pCtxObj);
+    if(maxLength == 0U)
+    {
+        retVal = SystemP_FAILURE;
+    }
+
+    if(output == NULL)
+    {
+        /* Every packet returns its data into the scratch buffer, which bounds the packet
+         * length; a packet with the fragment flag must end on a hash block */
+        ptrSink = ptrJob->scratch;
+        if(maxLength > ptrJob->scratchSize)
+        {
+            maxLength = ptrJob->scratchSize;
+        }
+        maxLength = maxLength & ~(SA2UL_getHashBlkSizeBytes(pCtxObj) - 1U);
+    }
+
+    /* Keep up to maxPktsInFlight packets queued to the engine,
+     * recycling descriptor pairs as soon as they are returned so the
+     * next chunk can be queued while the current one is processed */
+    while((SystemP_SUCCESS == retVal) &&
+          ((pendingBytes != 0U) || (fragIndex < numFrags) || (numPktsInFlight != 0U)))
+    {
+        if(numPktsInFlight != 0U)
+        {
+            /* Reap a completed packet if one is available, the deadline restarts on progress */
+            if(SystemP_SUCCESS == SA2UL_popBuffer(pCtxObj, &doneBufAddr, &donedataLen, &doneFlag))
+            {
+                numPktsInFlight--;
+                startTicks = ClockP_getTicks();
+            }
+            else if((ClockP_getTicks() - startTicks) >= timeoutTicks)
+            {
+                retVal = SystemP_TIMEOUT;
+            }
+            else
+            {
+                /* Still in flight */
+            }
+        }
+
+        if(pCtxObj->sa2ulErrCnt != 0U)
+        {
+            /* The engine flagged a packet: only the packets in flight are reaped */
+            pendingBytes = 0U;
+            fragIndex    = numFrags;
+        }
+
+        if((SystemP_SUCCESS == retVal) && (pendingBytes == 0U) && (fragIndex < numFrags))
+        {
+            /* Move on to the next fragment, empty fragments are skipped */
+            ptrInput     = (uint8_t *)fragList[fragIndex].addr;
+            pendingBytes = fragList[fragIndex].len;
+            fragIndex++;
+        }
+
+        if((SystemP_SUCCESS == retVal) && (pendingBytes != 0U) && (numPktsInFlight < maxPktsInFlight))
+        {
+            chunkLength = (pendingBytes > maxLength) ? maxLength : pendingBytes;
+            retVal = SA2UL_pushBuffer(pCtxObj, ptrInput, chunkLength, (ptrSink != NULL) ? ptrSink : ptrOutput);
+            if(SystemP_SUCCESS == retVal)
+            {
+                ptrInput     = ptrInput + chunkLength;
+                if(ptrSink == NULL)
+                {
+                    ptrOutput = ptrOutput + chunkLength;
+                }
+                pendingBytes = pendingBytes - chunkLength;
+                if(numPktsInFlight == 0U)
+                {
+                    startTicks = ClockP_getTicks();
+                }
+                numPktsInFlight++;
+            }
+        }
+    }
+
+    if((SystemP_SUCCESS != retVal) && ((uint32_t)SystemP_TIMEOUT != retVal))
+    {
+        /* A packet could not be queued, the packets already queued still return */
+        startTicks = ClockP_getTicks();
+        while((numPktsInFlight != 0U) && ((ClockP_getTicks() - startTicks) < timeoutTicks))
+        {
+            if(SystemP_SUCCESS == SA2UL_popBuffer(pCtxObj, &doneBufAddr, &donedataLen, &doneFlag))
+            {
+                numPktsInFlight--;
+                startTicks = ClockP_getTicks();
+            }
+        }
+    }
+
+    if(numPktsInFlight != 0U)
+    {
+        /* Packets left in the rings would be credited to the next context which
+         * reaps them: the instance job drains them into this context instead */
+        key = HwiP_disable();
+        ptrJob->ctxObj          = pCtxObj;
+        ptrJob->numPktsInFlight = numPktsInFlight;
+        HwiP_restore(key);
+    }
+
+    if((SystemP_SUCCESS == retVal) && (pCtxObj->sa2ulErrCnt != 0U))
+    {
+        retVal = SystemP_FAILURE;
+    }
+
+    return (retVal);
+}
+
+/**
+ * \brief  Write len bytes of consecutive counter blocks starting at ctrBlock,
+ *         advancing the counter held in its low ctrWidth bits.
+ */
+static void SA2UL_ctrFill(const SA2UL_ContextObject *pCtxObj, uint8_t *ctrBlock, uint8_t *output, uint32_t len)
+{
+    uint32_t offset, i, ctrBytes, carry;
+
+    ctrBytes = pCtxObj->ctxPrms.ctrWidth >> 3;
+    if(ctrBytes == 0U)
+    {
+        ctrBytes = SA2UL_AES_BLOCK_SIZE_BYTES;
+    }
+
+    for(offset = 0U; offset < len; offset += SA2UL_AES_BLOCK_SIZE_BYTES)
+    {
+        memcpy(&output[offset], ctrBlock, SA2UL_AES_BLOCK_SIZE_BYTES);
+
+        /* Big endian increment, wrapping inside the counter field */
+        carry = 1U;
+        for(i = SA2UL_AES_BLOCK_SIZE_BYTES; (i > (SA2UL_AES_BLOCK_SIZE_BYTES - ctrBytes)) && (carry != 0U); i--)
+        {
+            ctrBlock[i - 1U]++;
+            carry = (ctrBlock[i - 1U] == 0U) ? 1U : 0U;
+        }
+    }
+}
+
+/**
+ * \brief  CTR mode: the engine encrypts the counter blocks in the instance
+ *         scratch buffer and the keystream is combined with the input, one
+ *         scratch buffer at a time. The output is only written by the CPU, so
+ *         input and output may be the same buffer. A partial last block is
+ *         padded to a block in the scratch buffer. The counter of the context
+ *         only advances over the chunks the engine completed.
+ */
+static int32_t SA2UL_ctrProcess(SA2UL_ContextObject *pCtxObj,const uint8_t  *input, uint32_t ilen, uint8_t  *output)
+{
+    uint32_t retVal             = SystemP_SUCCESS;
+    uint32_t blkLen             = ilen & ~(SA2UL_AES_BLOCK_SIZE_BYTES - 1U);
+    uint32_t tailLen            = ilen - blkLen;
+    uint32_t offset             = 0U;
+    uint32_t chunkLen;
+    uint32_t streamLen;
+    uint32_t i;
+    SA2UL_Job *ptrJob           = (SA2UL_Job *)((SA2UL_Config *)pCtxObj->handle)->object->jobObj;
+    uint8_t *ptrKeystream       = ptrJob->scratch;
+    uint8_t nextCtrBlock[SA2UL_MAX_IV_SIZE_BYTES];
+
+    /* A partial block ends the message, the counter would skip otherwise */
+    if((tailLen != 0U) &&
+       ((pCtxObj->txBytesCnt + blkLen + SA2UL_AES_BLOCK_SIZE_BYTES) != pCtxObj->totalLengthInBytes))
+    {
+        retVal = SystemP_FAILURE;
+    }
+
+    /* In place is fine, a partly overlapping output would overwrite input not yet read */
+    if((output != input) &&
+       ((uintptr_t)output < ((uintptr_t)input + ilen)) && ((uintptr_t)input < ((uintptr_t)output + ilen)))
+    {
+        retVal = SystemP_FAILURE;
+    }
+
+    while((SystemP_SUCCESS == retVal) && (offset < ilen))
+    {
+        chunkLen = ilen - offset;
+        if(chunkLen > ptrJob->scratchSize)
+        {
+            chunkLen = ptrJob->scratchSize;
+        }
+        streamLen = (chunkLen + SA2UL_AES_BLOCK_SIZE_BYTES - 1U) & ~(SA2UL_AES_BLOCK_SIZE_BYTES - 1U);
+
+        memcpy(nextCtrBlock, pCtxObj->ctrBlock, SA2UL_MAX_IV_SIZE_BYTES);
+        SA2UL_ctrFill(pCtxObj, nextCtrBlock, ptrKeystream, streamLen);
+        retVal = SA2UL_processPackets(pCtxObj, ptrKeystream, streamLen, ptrKeystream);
+        if(SystemP_SUCCESS == retVal)
+        {
+            /* A failed chunk leaves the counter where it was */
+            memcpy(pCtxObj->ctrBlock, nextCtrBlock, SA2UL_MAX_IV_SIZE_BYTES);
+            CacheP_inv(ptrKeystream, ptrJob->scratchSize, CacheP_TYPE_ALLD);
+            for(i = 0U; i < chunkLen; i++)
+            {
+                output[offset + i] = input[offset + i] ^ ptrKeystream[i];
+            }
+            offset = offset + chunkLen;
+        }
+    }
+    memset(ptrKeystream, 0, ptrJob->scratchSize);
+
+    return (retVal);
+}
+
+int32_t SA2UL_submit(SA2UL_ContextObject *pCtxObj, const uint8_t *input, uint32_t ilen, uint8_t *output,
+                     SA2UL_JobCallback callback, void *args, uint32_t deadline, SA2UL_JobToken *ptrToken)
+{
+    int32_t retVal              = SystemP_SUCCESS;
+    uint32_t maxLength          = 0;
+    uint32_t deadlineTicks      = 0;
+    SA2UL_Config *config        = NULL;
+    SA2UL_Job *ptrJob           = NULL;
+
+    if((NULL == pCtxObj) || (NULL == input) || (NULL == output) || (NULL == ptrToken) || (NULL == pCtxObj->handle))
+    {
+        retVal = SystemP_FAILURE;
+    }
+    else
+    {
+        config = (SA2UL_Config *)pCtxObj->handle;
+        ptrJob = (SA2UL_Job *)config->object->jobObj;
+
+        /* Instance must not be busy with an earlier job */
+        retVal = SA2UL_jobReap(ptrJob);
+    }
+
+    if(SystemP_SUCCESS == retVal)
+    {
+        if((pCtxObj->ctxPrms.opType ==  SA2UL_OP_ENC) && (pCtxObj->ctxPrms.encMode == SA2UL_ENC_MODE_CTR))
+        {
+            /* The keystream is combined with the data by the CPU */
+            retVal = SystemP_FAILURE;
+        }
+        else
+        {
+            maxLength = SA2UL_getMaxPktLength(pCtxObj);
+            if(maxLength == 0U)
+            {
+                retVal = SystemP_FAILURE;
+            }
+            else
+            {
+                retVal = SA2UL_checkEncLength(pCtxObj, ilen);
+            }
+        }
+    }
+
+    if(SystemP_SUCCESS == retVal)
+    {
+        /* Drop a completion which was never waited for */
+        (void)SemaphoreP_pend(&ptrJob->doneSem, SystemP_NO_WAIT);
+
+        ptrJob->ctxObj          = pCtxObj;
+        ptrJob->ptrInput        = input;
+        ptrJob->ptrOutput       = output;
+        ptrJob->pendingBytes    = ilen;
+        ptrJob->maxLength       = maxLength;
+        ptrJob->numPktsInFlight = 0U;
+        ptrJob->callback        = callback;
+        ptrJob->args            = args;
+        ptrJob->status          = SystemP_FAILURE;
+
+        /* Token zero is never handed out */
+        ptrJob->token = ptrJob->token + 1U;
+        if(ptrJob->token == SA2UL_JOB_TOKEN_INVALID)
+        {
+            ptrJob->token = 1U;
+        }
+        *ptrToken = ptrJob->token;
+
+        /* The packets are queued with interrupts disabled, the output buffer
+         * is cleaned and invalidated in the cache once, before any of them */
+        CacheP_wb(output, ilen, CacheP_TYPE_ALLD);
+        CacheP_inv(output, ilen, CacheP_TYPE_ALLD);
+
+        ptrJob->state = SA2UL_JOB_STATE_RUNNING;
+
+        if(deadline != SA2UL_JOB_NO_DEADLINE)
+        {
+            deadlineTicks = ClockP_usecToTicks((uint64_t)deadline);
+            if(deadlineTicks == 0U)
+            {
+                deadlineTicks = 1U;
+            }
+            ptrJob->isDeadlineArmed = TRUE;
+            ClockP_setTimeout(&ptrJob->deadlineClk, deadlineTicks);
+            ClockP_start(&ptrJob->deadlineClk);
+        }
+
+        /* Queue the first packets, the rest are queued as the engine returns them */
+        SA2UL_jobProgress(ptrJob);
+    }
+
+    return (retVal);
+}
+
+int32_t SA2UL_wait(SA2UL_Handle handle, SA2UL_JobToken token, uint32_t timeout)
+{
+    int32_t retVal              = SystemP_FAILURE;
+    uint32_t startTicks         = 0;
+    SA2UL_Config *config        = (SA2UL_Config *)handle;
+    SA2UL_Job *ptrJob           = NULL;
+
+    if((NULL != config) && (NULL != config->object) && (NULL != config->object->jobObj))
+    {
+        ptrJob = (SA2UL_Job *)config->object->jobObj;
+        if((token != SA2UL_JOB_TOKEN_INVALID) && (token == ptrJob->token) &&
+           (ptrJob->state != SA2UL_JOB_STATE_IDLE))
+        {
+            retVal = SystemP_SUCCESS;
+        }
+    }
+
+    if((SystemP_SUCCESS == retVal) && (ptrJob->state == SA2UL_JOB_STATE_RUNNING))
+    {
+        if(config->object->prms.intrEnable == TRUE)
+        {
+            if(SemaphoreP_pend(&ptrJob->doneSem, timeout) != SystemP_SUCCESS)
+            {
+                /* Still running */
+                retVal = SystemP_TIMEOUT;
+            }
+        }
+        else
+        {
+            /* Without the interrupt the waiter moves the job forward */
+            startTicks = ClockP_getTicks();
+            do
+            {
+                SA2UL_jobProgress(ptrJob);
+            } while((ptrJob->state == SA2UL_JOB_STATE_RUNNING) &&
+                    ((timeout == SystemP_WAIT_FOREVER) || ((ClockP_getTicks() - startTicks) < timeout)));
+
+            if(ptrJob->state == SA2UL_JOB_STATE_RUNNING)
+            {
+                retVal = SystemP_TIMEOUT;
+            }
+            else
+            {
+                (void)SemaphoreP_pend(&ptrJob->doneSem, SystemP_NO_WAIT);
+            }
+        }
+    }
+
+    if(SystemP_SUCCESS == retVal)
+    {
+        retVal = ptrJob->status;
+    }
+
+    return (retVal);
+}
 
 static uint32_t SA2UL_storageQremove(SA2UL_Object *object,uint64_t *val)
 {
     uint32_t retVal = SystemP_FAILURE;
 
-    if(object->storageQueueFree != SA2UL_RING_N_ELEMS){
-        *val = object->storageQueue[object->storageQueueTail];
-        retVal = object->storageQueueTail;
-        object->storageQueueTail = (object->storageQueueTail + 1) % SA2UL_RING_N_ELEMS;
-        object->storageQueueFree++;
+    /* Head and tail are free running, the difference is the occupancy */
+    if(object->storageQueueHead != object->storageQueueTail){
+        retVal = object->storageQueueTail & object->storageQueueMask;
+        *val = object->storageQueue[retVal];
+        object->storageQueueTail++;
     }
 
     return (retVal);
@@ -1282,19 +2325,18 @@ static uint64_t SA2UL_ringAccelReadDescr(SA2UL_Config *config,uint32_t ringNum)
 
 static uint32_t SA2UL_getStorageRingOcc(SA2UL_Object *object, uint32_t ringNum)
 {
-    return (SA2UL_RING_N_ELEMS - object->storageQueueFree);
+    return (object->storageQueueHead - object->storageQueueTail);
 }
 
 static uint32_t SA2UL_storageQinsert(SA2UL_Object *object,uint64_t val)
 {
     uint32_t retVal = SystemP_FAILURE;
 
-    if(object->storageQueueFree)
+    if((object->storageQueueHead - object->storageQueueTail) <= object->storageQueueMask)
     {
-        object->storageQueue[object->storageQueueHead] = val;
-        retVal = object->storageQueueHead;
-        object->storageQueueHead = (object->storageQueueHead + 1) % SA2UL_RING_N_ELEMS;
-        object->storageQueueFree--;
+        retVal = object->storageQueueHead & object->storageQueueMask;
+        object->storageQueue[retVal] = val;
+        object->storageQueueHead++;
     }
 
     return (retVal);
@@ -1337,7 +2379,7 @@ static int32_t SA2UL_setupRxChannel(SA2UL_Config *config)
     attrs       = config->attrs;
     object      = config->object;
 
-    if(!SA2UL_IS_ALIGNED_PTR(attrs->rxRingMemAddr, SA2UL_CACHELINE_ALIGNMENT))
+    if(!SA2UL_IS_ALIGNED_PTR(object->prms.rxRingMemAddr, SA2UL_CACHELINE_ALIGNMENT))
     {
         retVal = UDMA_EFAIL;
     }
@@ -1347,8 +2389,8 @@ static int32_t SA2UL_setupRxChannel(SA2UL_Config *config)
         UdmaChPrms_init(&chPrms, UDMA_CH_TYPE_RX_MAPPED);
         chPrms.peerChNum            = attrs->rxPsil0ThreadId;
         chPrms.mappedChGrp          = attrs->udmaSaRxGroupNum;
-        chPrms.fqRingPrms.ringMem   = (uint64_t*)attrs->rxRingMemAddr;
-        chPrms.fqRingPrms.elemCnt   = attrs->ringCnt;
+        chPrms.fqRingPrms.ringMem   = (uint64_t*)object->prms.rxRingMemAddr;
+        chPrms.fqRingPrms.elemCnt   = object->prms.ringDepth;
         chPrms.fqRingPrms.mode      = TISCI_MSG_VALUE_RM_RING_MODE_RING;
         chPrms.fqRingPrms.asel      = UDMA_RINGACC_ASEL_ENDPOINT_PHYSADDR;
 
@@ -1389,10 +2431,10 @@ static int32_t SA2UL_setupRxChannel(SA2UL_Config *config)
         UdmaChPrms_init(&chPrms, UDMA_CH_TYPE_RX_MAPPED);
         chPrms.peerChNum             = attrs->rxPsil1ThreadId;
         chPrms.mappedChGrp           = attrs->udmaSaRxGroupNum;
-        chPrms.fqRingPrms.elemCnt    = attrs->ringCnt;
+        chPrms.fqRingPrms.elemCnt    = object->prms.ringDepth;
         chPrms.fqRingPrms.mode       = TISCI_MSG_VALUE_RM_RING_MODE_RING;
         chPrms.fqRingPrms.asel       = UDMA_RINGACC_ASEL_ENDPOINT_PHYSADDR;
-        chPrms.fqRingPrms.ringMem    = (uint64_t*)attrs->rxRingMemAddr;
+        chPrms.fqRingPrms.ringMem    = (uint64_t*)object->prms.rxRingMemAddr;
         object->rxChHandle[0]        = &object->udmaRxChObj[0];
     }
     retVal = Udma_chOpen(object->drvHandle, object->rxChHandle[0], UDMA_CH_TYPE_RX_MAPPED, &chPrms);
@@ -1453,7 +2495,7 @@ static int32_t SA2UL_setupTxChannel(SA2UL_Config *config)
     attrs = config->attrs;
     object = config->object;
 
-    if(!SA2UL_IS_ALIGNED_PTR(attrs->txRingMemAddr, SA2UL_CACHELINE_ALIGNMENT))
+    if(!SA2UL_IS_ALIGNED_PTR(object->prms.txRingMemAddr, SA2UL_CACHELINE_ALIGNMENT))
     {
         retVal = UDMA_EFAIL;
     }
@@ -1462,8 +2504,8 @@ static int32_t SA2UL_setupTxChannel(SA2UL_Config *config)
         UdmaChPrms_init(&chPrms, UDMA_CH_TYPE_TX_MAPPED);
         chPrms.mappedChGrp           = attrs->udmaSaTxGroupNum;
         chPrms.peerChNum             = attrs->txPsilThreadId | SA2UL_PSIL_DST_THREAD_OFFSET;
-        chPrms.fqRingPrms.ringMem    = (uint64_t*)attrs->txRingMemAddr;
-        chPrms.fqRingPrms.elemCnt    = attrs->ringCnt;
+        chPrms.fqRingPrms.ringMem    = (uint64_t*)object->prms.txRingMemAddr;
+        chPrms.fqRingPrms.elemCnt    = object->prms.ringDepth;
 
         /* this is the dual ring mode */
         chPrms.fqRingPrms.mode       = TISCI_MSG_VALUE_RM_RING_MODE_RING;
@@ -1511,14 +2553,26 @@ static int32_t SA2UL_dmaInit(SA2UL_Config *config)
     uint32_t retVal  = SystemP_SUCCESS;
     SA2UL_Object       *object;
     SA2UL_Attrs        *attrs;
-    uint8_t            cnt;
+    uint32_t           cnt;
     uint64_t           phys;
     DebugP_assert(NULL != config->object);
     object = config->object;
     attrs  = config->attrs;
 
     object->contextId            = attrs->contextIdStart;
-    object->storageQueueFree     = SA2UL_RING_N_ELEMS;
+
+    /* Storage queue holds a Tx and a Rx descriptor per packet in flight */
+    if(NULL != object->prms.storageQueueMem)
+    {
+        object->storageQueue     = object->prms.storageQueueMem;
+    }
+    else
+    {
+        object->storageQueue     = &object->storageQueueObj[0];
+    }
+    object->storageQueueMask     = (2U * object->prms.numDescPairs) - 1U;
+    object->storageQueueHead     = 0U;
+    object->storageQueueTail     = 0U;
 
     /* setup Tx Channel */
     retVal = SA2UL_setupTxChannel(config);
@@ -1538,13 +2592,10 @@ static int32_t SA2UL_dmaInit(SA2UL_Config *config)
 
     if(retVal == SystemP_SUCCESS)
     {
-        phys = attrs->descMemAddr;
-        for (cnt=0; cnt<(attrs->descMemAddr / attrs->descMemSize); cnt++)
+        /* Carve the descriptor pool into cache aligned descriptors */
+        phys = object->prms.descMemAddr;
+        for (cnt=0U; cnt<=object->storageQueueMask; cnt++)
         {
-            if(cnt == (SA2UL_RING_N_ELEMS * 2))
-            {
-                break;
-            }
             SA2UL_ringAccelWriteDescr(config,object->ringaccChnls[attrs->swRingNumInt], phys);
             phys += attrs->descSize;
         }
@@ -1594,63 +2645,144 @@ static void SA2UL_64bEndianSwap(uint32_t *dest, const uint32_t *src, uint32_t le
     }
 }
 
+static void SA2UL_sha256Compress(uint32_t *state, const uint8_t *block)
+{
+    uint32_t w[64];
+    uint32_t a, b, c, d, e, f, g, h, t1, t2;
+    uint32_t i;
+
+    SA2UL_u8LeToU32(w, block, SA2UL_SHA256_BLOCK_SIZE_BYTES);
+    for (i = 16U; i < 64U; i++)
+    {
+        w[i] = SA2UL_SHA256_SSIG1(w[i - 2U]) + w[i - 7U] + SA2UL_SHA256_SSIG0(w[i - 15U]) + w[i - 16U];
+    }
+
+    a = state[0]; b = state[1]; c = state[2]; d = state[3];
+    e = state[4]; f = state[5]; g = state[6]; h = state[7];
+
+    for (i = 0U; i < 64U; i++)
+    {
+        t1 = h + SA2UL_SHA256_BSIG1(e) + SA2UL_SHA256_CH(e, f, g) + gSa2ulSha256K[i] + w[i];
+        t2 = SA2UL_SHA256_BSIG0(a) + SA2UL_SHA256_MAJ(a, b, c);
+        h = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + t2;
+    }
+
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+
+    /* The message schedule is derived from the key */
+    memset(w, 0, sizeof(w));
+}
+
+/**
+ * \brief  Compute the HMAC-SHA256 hash states the authentication engine
+ *         starts from, the state after the (key ^ ipad) block followed by
+ *         the state after the (key ^ opad) block.
+ */
+static void SA2UL_hmacSha256KeySched(uint32_t *keySched, const uint8_t *key, uint32_t keySize)
+{
+    uint8_t block[SA2UL_SHA256_BLOCK_SIZE_BYTES];
+    uint32_t i;
+
+    memset(block, 0, sizeof(block));
+    memcpy(block, key, keySize);
+    for (i = 0U; i < SA2UL_SHA256_BLOCK_SIZE_BYTES; i++)
+    {
+        block[i] ^= SA2UL_HMAC_SHA_IPAD;
+    }
+    memcpy(&keySched[0], gSa2ulSha256Iv, sizeof(gSa2ulSha256Iv));
+    SA2UL_sha256Compress(&keySched[0], block);
+
+    for (i = 0U; i < SA2UL_SHA256_BLOCK_SIZE_BYTES; i++)
+    {
+        block[i] ^= (SA2UL_HMAC_SHA_IPAD ^ SA2UL_HMAC_SHA_OPAD);
+    }
+    memcpy(&keySched[8], gSa2ulSha256Iv, sizeof(gSa2ulSha256Iv));
+    SA2UL_sha256Compress(&keySched[8], block);
+
+    memset(block, 0, sizeof(block));
+}
+
 static int32_t SA2UL_getMceIndex(SA2UL_ContextObject *ctxObj, uint8_t *aesKeyInvFlag)
 {
     uint32_t retVal  = SystemP_FAILURE;
+    uint32_t ecbIndex, cbcEncIndex, cbcDecIndex;
     *aesKeyInvFlag = (uint8_t) FALSE;
-    if((ctxObj->ctxPrms.encAlg == SA2UL_ENC_ALG_AES) && (ctxObj->ctxPrms.encKeySize == SA2UL_ENC_KEYSIZE_256))
+
+    if(ctxObj->ctxPrms.encKeySize == SA2UL_ENC_KEYSIZE_256)
     {
-        if(ctxObj->ctxPrms.encMode == SA2UL_ENC_MODE_ECB)
-        {
-            if(ctxObj->ctxPrms.encDirection == SA2UL_ENC_DIR_DECRYPT)
-                *aesKeyInvFlag = (uint8_t)TRUE;
-            retVal = MCE_DATA_ARRAY_INDEX_AES_256_ECB;
-        }
-        else if(ctxObj->ctxPrms.encMode == SA2UL_ENC_MODE_CBC)
-        {
-            if(ctxObj->ctxPrms.encDirection == SA2UL_ENC_DIR_ENCRYPT)
-            {
-                retVal = MCE_DATA_ARRAY_INDEX_AES_256_CBC_ENCRYPT;
-            }
-            else
-            {
-                *aesKeyInvFlag = (uint8_t)TRUE;
-                retVal = MCE_DATA_ARRAY_INDEX_AES_256_CBC_DECRYPT;
-            }
-        }
+        ecbIndex    = MCE_DATA_ARRAY_INDEX_AES_256_ECB;
+        cbcEncIndex = MCE_DATA_ARRAY_INDEX_AES_256_CBC_ENCRYPT;
+        cbcDecIndex = MCE_DATA_ARRAY_INDEX_AES_256_CBC_DECRYPT;
+    }
+    else if(ctxObj->ctxPrms.encKeySize == SA2UL_ENC_KEYSIZE_192)
+    {
+        ecbIndex    = MCE_DATA_ARRAY_INDEX_AES_192_ECB;
+        cbcEncIndex = MCE_DATA_ARRAY_INDEX_AES_192_CBC_ENCRYPT;
+        cbcDecIndex = MCE_DATA_ARRAY_INDEX_AES_192_CBC_DECRYPT;
+    }
+    else
+    {
+        ecbIndex    = MCE_DATA_ARRAY_INDEX_AES_128_ECB;
+        cbcEncIndex = MCE_DATA_ARRAY_INDEX_AES_128_CBC_ENCRYPT;
+        cbcDecIndex = MCE_DATA_ARRAY_INDEX_AES_128_CBC_DECRYPT;
     }
-    else if((ctxObj->ctxPrms.encAlg == SA2UL_ENC_ALG_AES) && (ctxObj->ctxPrms.encKeySize == SA2UL_ENC_KEYSIZE_128))
+
+    if((ctxObj->ctxPrms.encAlg == SA2UL_ENC_ALG_AES) && (ctxObj->ctxPrms.encKeySize < SA2UL_ENC_KEYSIZE_MAX))
     {
         if(ctxObj->ctxPrms.encMode == SA2UL_ENC_MODE_ECB)
         {
             if(ctxObj->ctxPrms.encDirection == SA2UL_ENC_DIR_DECRYPT)
                 *aesKeyInvFlag = (uint8_t)TRUE;
-            retVal = MCE_DATA_ARRAY_INDEX_AES_128_ECB;
+            retVal = ecbIndex;
         }
         else if(ctxObj->ctxPrms.encMode == SA2UL_ENC_MODE_CBC)
         {
             if(ctxObj->ctxPrms.encDirection == SA2UL_ENC_DIR_ENCRYPT)
             {
-                retVal = MCE_DATA_ARRAY_INDEX_AES_128_CBC_ENCRYPT;
+                retVal = cbcEncIndex;
             }
             else
             {
                 *aesKeyInvFlag = (uint8_t)TRUE;
-                retVal = MCE_DATA_ARRAY_INDEX_AES_128_CBC_DECRYPT;
+                retVal = cbcDecIndex;
             }
         }
+        else if(ctxObj->ctxPrms.encMode == SA2UL_ENC_MODE_CTR)
+        {
+            /* Counter blocks are encrypted in both directions */
+            retVal = ecbIndex;
+        }
     }
 
     return (retVal);
 }
 
 static int32_t SA2UL_pushBuffer(SA2UL_ContextObject *pCtxObj,const uint8_t  *input, uint32_t ilen, uint8_t  *output)
+{
+    /* Output buffer maintenance must be done before the packet is queued,
+     * a later writeback could overwrite data already written by the engine */
+    CacheP_wb(output, ilen, CacheP_TYPE_ALLD);
+    CacheP_inv(output, ilen, CacheP_TYPE_ALLD);
+
+    return (SA2UL_queueBuffer(pCtxObj, input, ilen, output));
+}
+
+/**
+ * \brief  Queue one packet whose output buffer is already clean and invalid
+ *         in the cache. Only the descriptors are maintained here, so the
+ *         function is short enough to run with interrupts disabled.
+ */
+static int32_t SA2UL_queueBuffer(SA2UL_ContextObject *pCtxObj,const uint8_t  *input, uint32_t ilen, uint8_t  *output)
 {
     uint32_t retVal = SystemP_SUCCESS;
     struct SA2UL_HostDescrTx *txDescr;
     struct SA2UL_HostDescrRx *rxDescr;
     uint64_t phys, authLen;
     uint32_t lenTBP;
+    uint32_t cmdLbl[8];
+    uint32_t encLblIdx, authLblIdx;
     SA2UL_Object *object;
     SA2UL_Attrs  *attrs;
     SA2UL_Config *config;
@@ -1672,7 +2804,7 @@ static int32_t SA2UL_pushBuffer(SA2UL_ContextObject *pCtxObj,const uint8_t  *inp
         lenTBP = CSL_FEXT(0xffffffffu, SA2UL_CMDLBLHDR1_LEN_TO_BE_PROCESSESED);
         if(ilen > lenTBP)
         {
-            if(pCtxObj->ctxPrms.opType == SA2UL_OP_ENC)
+            if(pCtxObj->ctxPrms.opType != SA2UL_OP_AUTH)
             {
                 /* Packet length must not be greater than the the field
                 * size in command label for encryption */
@@ -1683,6 +2815,13 @@ static int32_t SA2UL_pushBuffer(SA2UL_ContextObject *pCtxObj,const uint8_t  *inp
         {
             lenTBP = ilen;
         }
+
+        if(SA2UL_IS_ENC_AUTH(pCtxObj->ctxPrms.opType) &&
+           ((pCtxObj->txBytesCnt != 0U) || (ilen != pCtxObj->totalLengthInBytes)))
+        {
+            /* The MAC covers one packet, the message can not be fragmented */
+            retVal = SystemP_FAILURE;
+        }
     }
     /* Check the occupancy of storage queue */
     if(SA2UL_getStorageRingOcc(object, attrs->swRingNumInt) < 2u)
@@ -1772,20 +2911,68 @@ static int32_t SA2UL_pushBuffer(SA2UL_ContextObject *pCtxObj,const uint8_t  *inp
             }
         }
 
+        else if(SA2UL_IS_ENC_AUTH(pCtxObj->ctxPrms.opType))
+        {
+            /* One command label per engine, the first label routes the packet
+             * to the second engine and the encryption label loads the IV */
+            memset(cmdLbl, 0, sizeof(cmdLbl));
+            if(pCtxObj->ctxPrms.opType == SA2UL_OP_ENC_THEN_AUTH)
+            {
+                encLblIdx  = 0U;
+                authLblIdx = (SA2UL_CMDLBL_HDR_LEN + SA2UL_MAX_IV_SIZE_BYTES) >> 2;
+                txDescr->exPktInfo.swWord0 |= (CSL_FMK(SA2UL_SWWORD0_ENGINE_ID, SA2UL_ENGINE_CODE_ENCRYPTION_MODULE_P1));
+            }
+            else
+            {
+                authLblIdx = 0U;
+                encLblIdx  = SA2UL_CMDLBL_HDR_LEN >> 2;
+                txDescr->exPktInfo.swWord0 |= (CSL_FMK(SA2UL_SWWORD0_ENGINE_ID, SA2UL_ENGINE_CODE_AUTHENTICATION_MODULE_P1));
+            }
+
+            cmdLbl[encLblIdx] =
+                CSL_FMK(SA2UL_CMDLBLHDR1_LEN_TO_BE_PROCESSESED, lenTBP) |
+                CSL_FMK(SA2UL_CMDLBLHDR1_CMD_LABEL_LEN, SA2UL_CMDLBL_HDR_LEN + SA2UL_MAX_IV_SIZE_BYTES) |
+                CSL_FMK(SA2UL_CMDLBLHDR1_NEXT_ENGINE_SELECT_CODE,
+                    (encLblIdx == 0U) ? SA2UL_ENGINE_CODE_AUTHENTICATION_MODULE_P1 : SA2UL_ENGINE_CODE_DEFAULT_EGRESS_PORT);
+            cmdLbl[encLblIdx + 1U] =
+                CSL_FMK(SA2UL_CMDLBLHDR2_OPTION1_CTX_OFFSET, SA2UL_SECCTX_ENC_AUX2_OFFSET >> 3) |
+                CSL_FMK(SA2UL_CMDLBLHDR2_OPTION1_LEN, SA2UL_MAX_IV_SIZE_BYTES >> 3);
+            SA2UL_u8LeToU32(&cmdLbl[encLblIdx + 2U], pCtxObj->ctxPrms.iv, SA2UL_MAX_IV_SIZE_BYTES);
+
+            cmdLbl[authLblIdx] =
+                CSL_FMK(SA2UL_CMDLBLHDR1_LEN_TO_BE_PROCESSESED, lenTBP) |
+                CSL_FMK(SA2UL_CMDLBLHDR1_CMD_LABEL_LEN, SA2UL_CMDLBL_HDR_LEN) |
+                CSL_FMK(SA2UL_CMDLBLHDR1_NEXT_ENGINE_SELECT_CODE,
+                    (authLblIdx == 0U) ? SA2UL_ENGINE_CODE_ENCRYPTION_MODULE_P1 : SA2UL_ENGINE_CODE_DEFAULT_EGRESS_PORT);
+
+            /* Command labels follow the PS info word */
+            memcpy(&txDescr->psData.cmdLblHdr1, cmdLbl, sizeof(cmdLbl));
+            CSL_FINS(txDescr->pd.descInfo,
+                UDMAP_CPPI5_PD_DESCINFO_PSWCNT, (4u + sizeof(cmdLbl)) >> 2);
+
+            /* Single packet, evict and teardown security context */
+            txDescr->exPktInfo.swWord0 |= (CSL_FMK(SA2UL_SWWORD0_TEARDOWN, 1u) | CSL_FMK(SA2UL_SWWORD0_EVICT, 1u));
+        }
         else
         {
             txDescr->exPktInfo.swWord0 |= (CSL_FMK(SA2UL_SWWORD0_ENGINE_ID, SA2UL_ENGINE_CODE_ENCRYPTION_MODULE_P1));
-            if((pCtxObj->txBytesCnt + ilen) == pCtxObj->ctxPrms.inputLen)
+            if((pCtxObj->txBytesCnt + ilen) == pCtxObj->totalLengthInBytes)
             {
                 /* Evict and teardown security context after last packet*/
                 txDescr->exPktInfo.swWord0 |= (CSL_FMK(SA2UL_SWWORD0_TEARDOWN, 1u) | CSL_FMK(SA2UL_SWWORD0_EVICT, 1u));
             }
+            else
+            {
+                /* Set the fragment bit, the engine keeps the IV chaining
+                 * state in the context for the next fragment */
+                txDescr->exPktInfo.swWord0 |= CSL_FMK(SA2UL_SWWORD0_FRAGMENT, 1u);
+            }
         }
         /* Load SecContec pointer in extended PktInfo */
         phys = (uint64_t)(&pCtxObj->secCtx);
         txDescr->exPktInfo.scptrL = (uint32_t)phys;
         txDescr->exPktInfo.scptrH = ((uint32_t)(phys >> 32));
-        if(pCtxObj->ctxPrms.opType == SA2UL_OP_AUTH)
+        if((pCtxObj->ctxPrms.opType == SA2UL_OP_AUTH) || SA2UL_IS_ENC_AUTH(pCtxObj->ctxPrms.opType))
         {
             txDescr->exPktInfo.scptrH |= (CSL_FMK(SA2UL_SCPTRH_EGRESS_CPPI_STATUS_LEN, gSa2ulHashSizeBytes[pCtxObj->ctxPrms.hashAlg & 7u]));
         }
@@ -1809,8 +2996,8 @@ static int32_t SA2UL_pushBuffer(SA2UL_ContextObject *pCtxObj,const uint8_t  *inp
         rxDescr->pd.orgBufLen = ilen;
     }
     /* Check ring accelerator accupancy */
-    if((Udma_ringGetForwardRingOcc(object->rxRingHandle) == SA2UL_RING_N_ELEMS) ||
-        (Udma_ringGetForwardRingOcc(object->txRingHandle) == SA2UL_RING_N_ELEMS))
+    if((Udma_ringGetForwardRingOcc(object->rxRingHandle) >= object->prms.ringDepth) ||
+        (Udma_ringGetForwardRingOcc(object->txRingHandle) >= object->prms.ringDepth))
     {
         retVal = SystemP_FAILURE;
     }
@@ -1837,12 +3024,6 @@ static int32_t SA2UL_pushBuffer(SA2UL_ContextObject *pCtxObj,const uint8_t  *inp
         SA2UL_ringAccelWriteDescr(config,object->ringaccChnls[attrs->txRingNumInt], phys);
 
         pCtxObj->txBytesCnt += ilen;
-
-        /* Perform cache writeback */
-        CacheP_wb(output, ilen, CacheP_TYPE_ALLD);
-
-        /* Perform cache writeback */
-        CacheP_inv(output, ilen, CacheP_TYPE_ALLD);
     }
     return (retVal);
 }
@@ -1893,7 +3074,7 @@ static int32_t SA2UL_popBuffer(SA2UL_ContextObject *pCtxObj, uint64_t *doneBuf,
 
         if(pCtxObj->rxBytesCnt == pCtxObj->ctxPrms.inputLen)
         {
-            if(pCtxObj->ctxPrms.opType == SA2UL_OP_AUTH)
+            if((pCtxObj->ctxPrms.opType == SA2UL_OP_AUTH) || SA2UL_IS_ENC_AUTH(pCtxObj->ctxPrms.opType))
             {
                 /* Check for protocol-specific data for SA2UL hash ouput */
                 reg = CSL_FEXT(rxDescr->pd.descInfo,
@@ -1923,6 +3104,263 @@ static int32_t SA2UL_popBuffer(SA2UL_ContextObject *pCtxObj, uint64_t *doneBuf,
     return (retVal);
 }
 
+static int32_t SA2UL_jobInit(SA2UL_Config *config, uint32_t index)
+{
+    int32_t retVal              = SystemP_SUCCESS;
+    SA2UL_Object *object        = config->object;
+    SA2UL_Job *ptrJob           = NULL;
+    ClockP_Params clkPrms;
+    Udma_EventPrms eventPrms;
+
+    object->jobObj      = NULL;
+    object->rxEvtHandle = NULL;
+
+    if(index >= SA2UL_INSTANCES_MAX)
+    {
+        retVal = SystemP_FAILURE;
+    }
+    else
+    {
+        ptrJob                  = &gSa2ulJob[index];
+        ptrJob->config          = config;
+        ptrJob->state           = SA2UL_JOB_STATE_IDLE;
+        ptrJob->numPktsInFlight = 0U;
+        ptrJob->isDeadlineArmed = FALSE;
+        if(NULL != object->prms.scratchMem)
+        {
+            ptrJob->scratch     = object->prms.scratchMem;
+            ptrJob->scratchSize = object->prms.scratchSize;
+        }
+        else
+        {
+            ptrJob->scratch     = gSa2ulScratch[index];
+            ptrJob->scratchSize = SA2UL_DEFAULT_SCRATCH_SIZE;
+        }
+        retVal = SemaphoreP_constructBinary(&ptrJob->doneSem, 0U);
+    }
+
+    if(SystemP_SUCCESS == retVal)
+    {
+        /* One shot clock, the timeout is set for each job */
+        ClockP_Params_init(&clkPrms);
+        clkPrms.start    = FALSE;
+        clkPrms.timeout  = 1U;
+        clkPrms.period   = 0U;
+        clkPrms.callback = &SA2UL_jobDeadlineExpired;
+        clkPrms.args     = ptrJob;
+        retVal = ClockP_construct(&ptrJob->deadlineClk, &clkPrms);
+        if(SystemP_SUCCESS != retVal)
+        {
+            SemaphoreP_destruct(&ptrJob->doneSem);
+        }
+    }
+
+    if((SystemP_SUCCESS == retVal) && (object->prms.intrEnable == TRUE))
+    {
+        /* Completion interrupt of the Rx ring the engine returns packets to */
+        UdmaEventPrms_init(&eventPrms);
+        eventPrms.eventType             = UDMA_EVENT_TYPE_DMA_COMPLETION;
+        eventPrms.eventMode             = UDMA_EVENT_MODE_SHARED;
+        eventPrms.chHandle              = object->rxChHandle[1];
+        eventPrms.controllerEventHandle = Udma_eventGetGlobalHandle(object->drvHandle);
+        eventPrms.eventCb               = &SA2UL_jobRxRingIsr;
+        eventPrms.appData               = ptrJob;
+        object->rxEvtHandle             = &object->udmaEvtObj;
+        if(UDMA_SOK != Udma_eventRegister(object->drvHandle, object->rxEvtHandle, &eventPrms))
+        {
+            DebugP_logError("error in Rx ring Udma_eventRegister()  \n");
+            object->rxEvtHandle = NULL;
+            ClockP_destruct(&ptrJob->deadlineClk);
+            SemaphoreP_destruct(&ptrJob->doneSem);
+            retVal = SystemP_FAILURE;
+        }
+    }
+
+    if(SystemP_SUCCESS == retVal)
+    {
+        object->jobObj = ptrJob;
+    }
+
+    return (retVal);
+}
+
+static void SA2UL_jobDeInit(SA2UL_Config *config)
+{
+    SA2UL_Object *object        = config->object;
+    SA2UL_Job *ptrJob           = (SA2UL_Job *)object->jobObj;
+
+    if(NULL != object->rxEvtHandle)
+    {
+        (void)Udma_eventUnRegister(object->rxEvtHandle);
+        object->rxEvtHandle = NULL;
+    }
+    if(NULL != ptrJob)
+    {
+        if(ptrJob->isDeadlineArmed == TRUE)
+        {
+            ClockP_stop(&ptrJob->deadlineClk);
+            ptrJob->isDeadlineArmed = FALSE;
+        }
+        ClockP_destruct(&ptrJob->deadlineClk);
+        SemaphoreP_destruct(&ptrJob->doneSem);
+        object->jobObj = NULL;
+    }
+}
+
+/**
+ * \brief  Check that no job owns the rings. Packets of a timed out job, or of
+ *         a timed out synchronous operation, are drained here into their
+ *         context once the engine returns them.
+ *
+ * \return #SystemP_SUCCESS if the rings are free, #SystemP_FAILURE otherwise
+ */
+static int32_t SA2UL_jobReap(SA2UL_Job *ptrJob)
+{
+    int32_t retVal = SystemP_SUCCESS;
+
+    if(NULL == ptrJob)
+    {
+        retVal = SystemP_FAILURE;
+    }
+    else if(ptrJob->state == SA2UL_JOB_STATE_RUNNING)
+    {
+        retVal = SystemP_FAILURE;
+    }
+    else
+    {
+        if(ptrJob->numPktsInFlight != 0U)
+        {
+            SA2UL_jobProgress(ptrJob);
+        }
+        if(ptrJob->numPktsInFlight != 0U)
+        {
+            retVal = SystemP_FAILURE;
+        }
+    }
+
+    return (retVal);
+}
+
+/**
+ * \brief  Reap the packets the engine returned, queue the next chunks of the
+ *         job and complete it once every packet is back.
+ */
+static void SA2UL_jobProgress(SA2UL_Job *ptrJob)
+{
+    int32_t  status             = SystemP_SUCCESS;
+    uint64_t doneBufAddr        = 0;
+    uint32_t donedataLen        = 0;
+    uint8_t  doneFlag           = 0;
+    uint32_t chunkLength        = 0;
+    uint32_t isDone             = FALSE;
+    uintptr_t key;
+
+    key = HwiP_disable();
+
+    while((ptrJob->numPktsInFlight != 0U) &&
+          (SystemP_SUCCESS == SA2UL_popBuffer(ptrJob->ctxObj, &doneBufAddr, &donedataLen, &doneFlag)))
+    {
+        ptrJob->numPktsInFlight--;
+    }
+
+    if(ptrJob->state == SA2UL_JOB_STATE_RUNNING)
+    {
+        while((SystemP_SUCCESS == status) && (ptrJob->pendingBytes != 0U) &&
+              (ptrJob->numPktsInFlight < ptrJob->config->object->prms.numDescPairs))
+        {
+            chunkLength = (ptrJob->pendingBytes > ptrJob->maxLength) ? ptrJob->maxLength : ptrJob->pendingBytes;
+            /* The output of the whole job was maintained at submit */
+            status = SA2UL_queueBuffer(ptrJob->ctxObj, ptrJob->ptrInput, chunkLength, ptrJob->ptrOutput);
+            if(SystemP_SUCCESS == status)
+            {
+                ptrJob->ptrInput     = ptrJob->ptrInput + chunkLength;
+                ptrJob->ptrOutput    = ptrJob->ptrOutput + chunkLength;
+                ptrJob->pendingBytes = ptrJob->pendingBytes - chunkLength;
+                ptrJob->numPktsInFlight++;
+            }
+        }
+
+        if((SystemP_SUCCESS == status) && (ptrJob->ctxObj->sa2ulErrCnt != 0U))
+        {
+            status = SystemP_FAILURE;
+        }
+        if((SystemP_SUCCESS != status) ||
+           ((ptrJob->pendingBytes == 0U) && (ptrJob->numPktsInFlight == 0U)))
+        {
+            isDone = SA2UL_jobFinish(ptrJob, status);
+        }
+    }
+
+    HwiP_restore(key);
+
+    if(isDone == TRUE)
+    {
+        SA2UL_jobNotify(ptrJob);
+    }
+}
+
+/**
+ * \brief  Record the result of a running job, called with interrupts disabled.
+ *
+ * \return TRUE if the job was running and must be notified
+ */
+static uint32_t SA2UL_jobFinish(SA2UL_Job *ptrJob, int32_t status)
+{
+    uint32_t isDone = FALSE;
+
+    if(ptrJob->state == SA2UL_JOB_STATE_RUNNING)
+    {
+        if(ptrJob->isDeadlineArmed == TRUE)
+        {
+            ClockP_stop(&ptrJob->deadlineClk);
+            ptrJob->isDeadlineArmed = FALSE;
+        }
+        ptrJob->status = status;
+        ptrJob->state  = SA2UL_JOB_STATE_DONE;
+        isDone = TRUE;
+    }
+
+    return (isDone);
+}
+
+static void SA2UL_jobNotify(SA2UL_Job *ptrJob)
+{
+    (void)SemaphoreP_post(&ptrJob->doneSem);
+
+    if(ptrJob->callback != NULL)
+    {
+        ptrJob->callback((SA2UL_Handle)ptrJob->config, ptrJob->token, ptrJob->status, ptrJob->ctxObj, ptrJob->args);
+    }
+}
+
+static void SA2UL_jobRxRingIsr(Udma_EventHandle eventHandle, uint32_t eventType, void *appData)
+{
+    (void)eventHandle;
+    (void)eventType;
+
+    SA2UL_jobProgress((SA2UL_Job *)appData);
+}
+
+static void SA2UL_jobDeadlineExpired(ClockP_Object *obj, void *args)
+{
+    SA2UL_Job *ptrJob           = (SA2UL_Job *)args;
+    uint32_t isDone             = FALSE;
+    uintptr_t key;
+
+    (void)obj;
+
+    key = HwiP_disable();
+    /* The clock is one shot and has stopped already */
+    ptrJob->isDeadlineArmed = FALSE;
+    isDone = SA2UL_jobFinish(ptrJob, SA2UL_JOB_DEADLINE_EXPIRED);
+    HwiP_restore(key);
+
+    if(isDone == TRUE)
+    {
+        SA2UL_jobNotify(ptrJob);
+    }
+}
+
 static int32_t SA2UL_hwInit(SA2UL_Attrs  *attrs)
 {
     uint32_t retVal           = SystemP_SUCCESS;
@@ -2005,9 +3443,64 @@ static uint32_t SA2UL_hwDeInit(SA2UL_Attrs  *attrs)
     return (retVal);
 }
 
-static int32_t SA2UL_checkOpenParams(const SA2UL_Params *prms)
+static void SA2UL_setDefaultParams(SA2UL_Params *prms, const SA2UL_Attrs *attrs)
+{
+    if(0U == prms->ringDepth)
+    {
+        prms->ringDepth = attrs->ringCnt;
+    }
+    if(0U == prms->txRingMemAddr)
+    {
+        prms->txRingMemAddr = attrs->txRingMemAddr;
+    }
+    if(0U == prms->rxRingMemAddr)
+    {
+        prms->rxRingMemAddr = attrs->rxRingMemAddr;
+    }
+    if(0U == prms->numDescPairs)
+    {
+        prms->numDescPairs = SA2UL_DEFAULT_NUM_DESC_PAIRS;
+    }
+    if(0U == prms->descMemAddr)
+    {
+        prms->descMemAddr = attrs->descMemAddr;
+        prms->descMemSize = attrs->descMemSize;
+    }
+}
+
+static int32_t SA2UL_checkOpenParams(const SA2UL_Params *prms, const SA2UL_Attrs *attrs)
 {
     int32_t     retVal = SystemP_SUCCESS;
 
+    /* Storage queue indexing relies on a power of 2 size */
+    if((!SA2UL_IS_POWER_OF_2(prms->numDescPairs)) ||
+       ((NULL == prms->storageQueueMem) && ((2U * prms->numDescPairs) > SA2UL_RING_N_ELEMS)))
+    {
+        retVal = SystemP_FAILURE;
+    }
+    /* Rings must hold every descriptor in flight, deeper rings than the
+     * instance ringCnt need their own ring memory */
+    if((prms->ringDepth < prms->numDescPairs) ||
+       ((prms->ringDepth > attrs->ringCnt) &&
+        ((prms->txRingMemAddr == attrs->txRingMemAddr) || (prms->rxRingMemAddr == attrs->rxRingMemAddr))))
+    {
+        retVal = SystemP_FAILURE;
+    }
+    /* Descriptors are carved from the pool back to back and must stay aligned */
+    if((!SA2UL_IS_ALIGNED_PTR(prms->descMemAddr, SA2UL_CACHELINE_ALIGNMENT)) ||
+       (!SA2UL_IS_ALIGNED_PTR(attrs->descSize, SA2UL_CACHELINE_ALIGNMENT)) ||
+       (prms->descMemSize < (2U * prms->numDescPairs * attrs->descSize)))
+    {
+        retVal = SystemP_FAILURE;
+    }
+    /* The scratch buffer is invalidated in the cache as a whole */
+    if((NULL != prms->scratchMem) &&
+       ((!SA2UL_IS_ALIGNED_PTR(prms->scratchMem, SA2UL_SCRATCH_ALIGN)) ||
+        (!SA2UL_IS_ALIGNED_PTR(prms->scratchSize, SA2UL_SCRATCH_ALIGN)) ||
+        (prms->scratchSize < SA2UL_DEFAULT_SCRATCH_SIZE)))
+    {
+        retVal = SystemP_FAILURE;
+    }
+
     return (retVal);
 }
@@ -54,6 +54,7 @@
 
 #include <string.h>
 #include <drivers/udma.h>
+#include <kernel/dpl/SystemP.h>
 #include <security_common/drivers/crypto/pka/hw_include/cslr_cp_ace.h>
 
 #ifdef __cplusplus
@@ -83,14 +84,23 @@ extern "C" {
 #define SA2UL_SECCTX_SIZE               (256U)
 /** \brief Max SA2UL instances */
 #define SA2UL_INSTANCES_MAX             (4U)
-/** \brief Max SA2UL ring n elements */
+/** \brief Size of the built-in SA2UL descriptor storage queue */
 #define SA2UL_RING_N_ELEMS              (8U)
+/** \brief Default number of Tx/Rx descriptor pairs in flight */
+#define SA2UL_DEFAULT_NUM_DESC_PAIRS    (SA2UL_RING_N_ELEMS / 2U)
+/** \brief Size of the built-in scratch buffer of an instance */
+#define SA2UL_DEFAULT_SCRATCH_SIZE      (2048U)
+/** \brief Alignment and size granule of a scratch buffer, a cache line */
+#define SA2UL_SCRATCH_ALIGN             (64U)
 /** \brief Max SA2UL sw ring number */
 #define SA2UL_SW_RING_NUM               (304U)
-/** \brief Max Aes input length for encryption and decryption (64KB-1)*/
+/** \brief Max Aes packet length for encryption and decryption (64KB-1), longer
+ *         inputs are processed as block aligned fragments of one context */
 #define SA2UL_MAX_INPUT_LENGTH_ENC      (0xFFFFU)
 /** \brief Max input length for authentication (4MB-1) */
 #define SA2UL_MAX_INPUT_LENGTH_AUTH     (0x3FFFFFU)
+/** \brief Max HMAC key size in bytes, longer keys must be hashed first */
+#define SA2UL_MAX_HMAC_KEY_SIZE_BYTES   (64U)
 /** @} */
 
 /**
@@ -106,6 +116,8 @@ extern "C" {
 #define SA2UL_HASH_ALG_SHA2_256         (0x14U)
 /** \brief Hash Algo SHA-512 */
 #define SA2UL_HASH_ALG_SHA2_512         (0x16U)
+/** \brief HMAC Algo SHA-256, for #SA2UL_OP_ENC_THEN_AUTH and #SA2UL_OP_AUTH_THEN_ENC */
+#define SA2UL_HASH_ALG_HMAC_SHA2_256    (0x04U)
 /** @} */
 
 /**
@@ -117,9 +129,11 @@ extern "C" {
 #define SA2UL_OP_ENC                    (0x01U)
 /** \brief SA2UL operations authentication */
 #define SA2UL_OP_AUTH                   (0x02U)
-/** \brief SA2UL operation encryption then authentication */
+/** \brief SA2UL operation encryption then authentication, AES-CBC encryption
+ *         and HMAC of the cipher text in one pass */
 #define SA2UL_OP_ENC_THEN_AUTH          (0x03U)
-/** \brief SA2UL operations authentication then encryption */
+/** \brief SA2UL operations authentication then encryption, HMAC of the cipher
+ *         text and AES-CBC decryption in one pass */
 #define SA2UL_OP_AUTH_THEN_ENC          (0x04U)
 /** @} */
 
@@ -175,8 +189,21 @@ extern "C" {
 #define SA2UL_ENC_MODE_ECB              (0x0U)
 /** \brief CBC mode */
 #define SA2UL_ENC_MODE_CBC              (0x1U)
+/** \brief CTR mode, the engine encrypts the counter blocks and the driver
+ *         combines them with the data. Known answer from NIST SP 800-38A
+ *         F.5.1 (CTR-AES128.Encrypt, ctrWidth 128), for one call or for calls
+ *         split on block boundaries; F.5.2 decrypts cipher back to plain:
+ *  \code
+ *  key     2b7e151628aed2a6abf7158809cf4f3c
+ *  counter f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff
+ *  plain   6bc1bee22e409f96e93d7e117393172a ae2d8a571e03ac9c9eb76fac45af8e51
+ *          30c81c46a35ce411e5fbc1191a0a52ef f69f2445df4f9b17ad2b417be66c3710
+ *  cipher  874d6191b620e3261bef6864990db6ce 9806f66b7970fdff8617187bb9fffdff
+ *          5ae4df3edbd5d35e5b4f09020db03eab 1e031dda2fbe03d1792170a0f3009cee
+ *  \endcode */
+#define SA2UL_ENC_MODE_CTR              (0x2U)
 /** \brief Maximun Encryption modes */
-#define SA2UL_ENC_MODE_MAX              (0x2U)
+#define SA2UL_ENC_MODE_MAX              (0x3U)
 /** @} */
 
 /**
@@ -195,6 +222,29 @@ extern "C" {
 /** @} */
 
 #define SA2UL_ENC_KEYSIZE_BITS(k)       (128u + (64u * (k)))
+
+/** \brief Job token value which does not identify any job */
+#define SA2UL_JOB_TOKEN_INVALID         (0U)
+
+/** \brief Deadline value for a job which may run for ever */
+#define SA2UL_JOB_NO_DEADLINE           (0U)
+
+/** \brief Status of a job whose deadline expired, distinct from the SystemP status codes */
+#define SA2UL_JOB_DEADLINE_EXPIRED      ((int32_t)-3)
+
+/** \brief Max number of channels in a #SA2UL_Group, one per instance */
+#define SA2UL_GROUP_CHANNELS_MAX        (SA2UL_INSTANCES_MAX)
+
+/**
+ *  \anchor SA2UL_Group_Policy
+ *  \name SA2UL group context distribution policy
+ *  @{
+ */
+/** \brief Contexts go to the channels in turn */
+#define SA2UL_GROUP_POLICY_ROUND_ROBIN  (0U)
+/** \brief Contexts go to the channel with the fewest allocated contexts */
+#define SA2UL_GROUP_POLICY_LEAST_LOADED (1U)
+/** @} */
 /* ========================================================================== */
 /*                         Structure Declarations                             */
 /* ========================================================================== */
@@ -203,6 +253,20 @@ extern "C" {
  *  \brief Handle to the SA2UL driver returned by #SA2UL_open() */
 typedef void *SA2UL_Handle;
 
+/** \brief Token identifying an asynchronous SA2UL job */
+typedef uint32_t SA2UL_JobToken;
+
+/**
+ *  \brief One fragment of a message passed to #SA2UL_contextProcessGather()
+ */
+typedef struct
+{
+    const uint8_t           *addr;
+    /**< Start of the fragment */
+    uint32_t                len;
+    /**< Length of the fragment in bytes */
+} SA2UL_Fragment;
+
 /**
  *  \brief Parameters passed to #SA2UL_contextAlloc()
  */
@@ -226,6 +290,13 @@ typedef struct
     /**< Overall data length, must be sum of all packet lengths */
     uint8_t                 iv[SA2UL_MAX_IV_SIZE_BYTES];
     /**< IV input for encryption, refer \ref SA2UL_InputSizes */
+    uint8_t                 authKey[SA2UL_MAX_HMAC_KEY_SIZE_BYTES];
+    /**< HMAC key for #SA2UL_OP_ENC_THEN_AUTH and #SA2UL_OP_AUTH_THEN_ENC */
+    uint32_t                authKeySize;
+    /**< HMAC key size in bytes, up to #SA2UL_MAX_HMAC_KEY_SIZE_BYTES */
+    uint32_t                ctrWidth;
+    /**< Width in bits of the counter held in the low bits of the IV for
+     *   #SA2UL_ENC_MODE_CTR, a multiple of 8; 0 selects 128 */
 } SA2UL_ContextParams;
 
 /**
@@ -234,8 +305,37 @@ typedef struct
  */
 typedef struct
 {
-    uint32_t                reserved;
-     /**< tbd for future */
+    uint32_t                ringDepth;
+    /**< Number of elements in the UDMA Tx and Rx rings, 0 selects the
+     *   instance ringCnt. Must not be less than numDescPairs */
+    uint32_t                txRingMemAddr;
+    /**< Tx ring memory of ringDepth 8-byte elements, 0 selects the instance
+     *   ring memory which is only valid up to the instance ringCnt */
+    uint32_t                rxRingMemAddr;
+    /**< Rx ring memory of ringDepth 8-byte elements, 0 selects the instance
+     *   ring memory which is only valid up to the instance ringCnt */
+    uint32_t                numDescPairs;
+    /**< Max Tx/Rx descriptor pairs in flight, must be a power of 2.
+     *   0 selects #SA2UL_DEFAULT_NUM_DESC_PAIRS */
+    uint32_t                descMemAddr;
+    /**< Descriptor pool, #SA2UL_CACHELINE_ALIGNMENT aligned, 0 selects the
+     *   instance descriptor memory */
+    uint32_t                descMemSize;
+    /**< Descriptor pool size in bytes, must hold 2 * numDescPairs descriptors */
+    uint64_t               *storageQueueMem;
+    /**< Storage queue memory of 2 * numDescPairs entries, NULL selects the
+     *   built-in queue of #SA2UL_RING_N_ELEMS entries */
+    uint32_t                intrEnable;
+    /**< TRUE to progress #SA2UL_submit jobs from the UDMA Rx ring interrupt,
+     *   FALSE to progress them only while #SA2UL_wait polls */
+    uint8_t                *scratchMem;
+    /**< Scratch buffer for the #SA2UL_ENC_MODE_CTR keystream and the data
+     *   returned by #SA2UL_contextProcessGather, #SA2UL_SCRATCH_ALIGN aligned.
+     *   NULL selects the built-in buffer of #SA2UL_DEFAULT_SCRATCH_SIZE bytes */
+    uint32_t                scratchSize;
+    /**< Scratch buffer size in bytes, a multiple of #SA2UL_SCRATCH_ALIGN of at
+     *   least #SA2UL_DEFAULT_SCRATCH_SIZE. A gather packet and a CTR keystream
+     *   chunk are at most this long, so a larger buffer needs fewer packets */
 } SA2UL_Params;
 
 /**
@@ -298,9 +398,15 @@ typedef struct
      * sa2ul storage Queue params
      */
     uint32_t                storageQueueHead;
+    /**< Free running count of descriptors inserted in the storage queue */
     uint32_t                storageQueueTail;
-    uint32_t                storageQueueFree;
-    uint64_t                storageQueue[SA2UL_RING_N_ELEMS];
+    /**< Free running count of descriptors removed from the storage queue */
+    uint32_t                storageQueueMask;
+    /**< Storage queue size - 1, the size is always a power of 2 */
+    uint64_t               *storageQueue;
+    /**< Storage queue in use, storageQueueMem or storageQueueObj */
+    uint64_t                storageQueueObj[SA2UL_RING_N_ELEMS];
+    /**< Built-in storage queue */
     /*
      * memory for SA2UL security context
      *
@@ -311,6 +417,10 @@ typedef struct
     /**< secure contextId array */
     uint8_t                 contextId;
     /**< secure context Id */
+    void                   *jobObj;
+    /**< Asynchronous job of the instance, owned by the driver */
+    uint32_t                numContexts;
+    /**< Contexts allocated on the instance and not freed yet */
 } SA2UL_Object;
 
 /** \brief SA2UL instance attributes - used during init time */
@@ -374,6 +484,24 @@ typedef struct
     /**< Pointer to driver functions */
 } SA2UL_Config;
 
+/**
+ *  \brief Group of SA2UL instances used as the channels of one crypto
+ *         service. Each channel owns its Tx channel, Rx flow, rings,
+ *         descriptor pool and completion interrupt, contexts are spread over
+ *         the channels so that independent tasks do not share a queue.
+ */
+typedef struct
+{
+    SA2UL_Handle            channel[SA2UL_GROUP_CHANNELS_MAX];
+    /**< Handle of each open channel */
+    uint32_t                numChannels;
+    /**< Number of channels in the group */
+    uint32_t                policy;
+    /**< Context distribution policy, refer \ref SA2UL_Group_Policy */
+    uint32_t                nextChannel;
+    /**< Channel the next round robin search starts from */
+} SA2UL_Group;
+
 /** \brief MEDdata for Encryption engine */
 typedef struct
 {
@@ -421,6 +549,24 @@ typedef struct
     uint8_t                 preCryptoData[15];
 }SA2UL_SecCtxEnc;
 
+/** \brief SA2UL context RAM structure for chained encryption and authentication.
+ *         The IV is loaded by the command label, the HMAC keys are the hash
+ *         states after the ipad and opad blocks. */
+typedef struct
+{
+    uint32_t                encrCtl;
+    uint32_t                modeCtrlInstrs[6];
+    uint32_t                hwCtrlWord;
+    uint32_t                encKeyValue[8];
+    uint32_t                authCtx1;
+    uint32_t                reserved0;
+    uint32_t                authenticationLengthHi;
+    uint32_t                authenticationLengthLo;
+    uint32_t                reserved1[4];
+    uint32_t                innerDigest[8];
+    uint32_t                outerDigest[8];
+}SA2UL_SecCtxEncAuth;
+
 /**
  * \brief SA2UL context RAM structure
  */
@@ -430,8 +576,9 @@ typedef struct
     uint32_t         unused[12];
     union
     {
-        SA2UL_SecCtxAuth  auth;
-        SA2UL_SecCtxEnc   enc;
+        SA2UL_SecCtxAuth    auth;
+        SA2UL_SecCtxEnc     enc;
+        SA2UL_SecCtxEncAuth encAuth;
     } u;
 }SA2UL_SecCtx;
 
@@ -452,8 +599,35 @@ typedef struct
     uint32_t                txBytesCnt;
     uint32_t                rxBytesCnt;
     uint32_t                sa2ulErrCnt;
+    uint32_t                encKeySched[SA2UL_MAX_KEY_SIZE_BYTES / 4U];
+    /**< Encryption key as loaded in the context, inverted for decryption.
+     *   Computed once by #SA2UL_contextAlloc and reused by #SA2UL_contextReset */
+    uint32_t                authKeySched[16];
+    /**< HMAC-SHA256 inner and outer hash states of the HMAC key, computed
+     *   once by #SA2UL_contextAlloc and reused by #SA2UL_contextReset */
+    uint8_t                 ctrBlock[SA2UL_MAX_IV_SIZE_BYTES];
+    /**< Next counter block for #SA2UL_ENC_MODE_CTR */
 } SA2UL_ContextObject;
 
+/**
+ * \brief  Completion callback of an asynchronous job. It is called from the UDMA
+ *         Rx ring interrupt, the deadline timer, or from #SA2UL_wait when the
+ *         instance does not use interrupts.
+ *
+ * \param  handle   #SA2UL_Handle the job was submitted on
+ *
+ * \param  token    Token returned by #SA2UL_submit
+ *
+ * \param  status   #SystemP_SUCCESS, #SA2UL_JOB_DEADLINE_EXPIRED or #SystemP_FAILURE
+ *
+ * \param  ctxObj   Context of the job, computedHash holds the hash of a completed
+ *                  authentication
+ *
+ * \param  args     Argument passed to #SA2UL_submit
+ */
+typedef void (*SA2UL_JobCallback)(SA2UL_Handle handle, SA2UL_JobToken token, int32_t status,
+                                  SA2UL_ContextObject *ctxObj, void *args);
+
 /* ========================================================================== */
 /*                            Global Variables                                */
 /* ========================================================================== */
@@ -513,12 +687,59 @@ int32_t SA2UL_engineDisable(int32_t hwDisableMask);
 SA2UL_Handle SA2UL_open(uint32_t index, const SA2UL_Params *params);
 
 /**
- *  \brief  Function to close a SA2UL module specified by the SA2UL handle
+ *  \brief  Function to close a SA2UL module specified by the SA2UL handle. A
+ *          job still running completes with #SystemP_FAILURE first, its
+ *          callback is called from here.
  *
  *  \param  handle  #SA2UL_Handle returned from #SA2UL_open()
  */
 void SA2UL_close(SA2UL_Handle handle);
 
+/**
+ *  \brief  Function to open several SA2UL instances as the channels of a group
+ *
+ *  \param  group       Pointer to the #SA2UL_Group to fill
+ *
+ *  \param  indexList   Index in the *SA2UL_Config* array of each channel
+ *
+ *  \param  paramsList  Open parameters of each channel, NULL to use the
+ *                      defaults for all of them
+ *
+ *  \param  numChannels Number of channels, up to #SA2UL_GROUP_CHANNELS_MAX
+ *
+ *  \param  policy      Context distribution policy, refer \ref SA2UL_Group_Policy
+ *
+ *  \return A #SystemP_SUCCESS on success or #SystemP_FAILURE on an error, no
+ *          channel is left open on an error. The security context Id ranges
+ *          of the instances, contextIdStart and contextIdMaxNum of their
+ *          attributes, must not overlap.
+ */
+int32_t SA2UL_groupOpen(SA2UL_Group *group, const uint32_t *indexList, const SA2UL_Params *paramsList,
+                        uint32_t numChannels, uint32_t policy);
+
+/**
+ *  \brief  Function to close every channel of a group
+ *
+ *  \param  group   Pointer to a #SA2UL_Group opened with #SA2UL_groupOpen()
+ */
+void SA2UL_groupClose(SA2UL_Group *group);
+
+/**
+ *  \brief  Function to configure a secure context on the channel of the group
+ *          picked by the group policy. The context is bound to that channel,
+ *          #SA2UL_contextProcess, #SA2UL_submit and #SA2UL_contextFree are
+ *          used as for a context of a single instance.
+ *
+ *  \param  group   Pointer to a #SA2UL_Group opened with #SA2UL_groupOpen()
+ *
+ *  \param  ctxObj  Pointer to #SA2UL_ContextObject structure
+ *
+ *  \param  ctxPrms Pointer to secure context parameters
+ *
+ *  \return A #SystemP_SUCCESS on success or #SystemP_FAILURE on an error
+ */
+int32_t SA2UL_groupContextAlloc(SA2UL_Group *group, SA2UL_ContextObject *ctxObj, const SA2UL_ContextParams *ctxPrms);
+
 /**
  *  \brief  Function to configure secure context
  *
@@ -535,7 +756,9 @@ void SA2UL_close(SA2UL_Handle handle);
 int32_t SA2UL_contextAlloc(SA2UL_Handle handle, SA2UL_ContextObject *ctxObj, const SA2UL_ContextParams *ctxPrms);
 
 /**
- *  \brief  Function to free secure context configuration
+ *  \brief  Function to free secure context configuration. A context whose
+ *          message was not completed, for example after a timeout, can be
+ *          freed once the engine returned all of its packets.
  *
  *  \param  pCtxObj  Pointer to *SA2UL_ContextObject* structure
  *
@@ -545,7 +768,33 @@ int32_t SA2UL_contextAlloc(SA2UL_Handle handle, SA2UL_ContextObject *ctxObj, con
 int32_t SA2UL_contextFree(SA2UL_ContextObject *pCtxObj);
 
 /**
- *  \brief  Function to transfer and recieve data buffer
+ *  \brief  Function to re-arm an allocated context for a new message under the
+ *          same key. Only the IV and the length change, the key schedule
+ *          computed by #SA2UL_contextAlloc is reused and the context keeps its
+ *          security context Id.
+ *
+ *  \param  pCtxObj  Pointer to *SA2UL_ContextObject* structure, allocated and
+ *                   with every packet of the previous message returned
+ *
+ *  \param  iv       New IV of #SA2UL_MAX_IV_SIZE_BYTES bytes for encryption,
+ *                   ignored for authentication only contexts
+ *
+ *  \param  inputLen Overall data length of the new message
+ *
+ *  \return A #SystemP_SUCCESS on success or #SystemP_FAILURE on an error
+ */
+int32_t SA2UL_contextReset(SA2UL_ContextObject *pCtxObj, const uint8_t *iv, uint32_t inputLen);
+
+/**
+ *  \brief  Function to transfer and recieve data buffer. For
+ *          #SA2UL_OP_ENC_THEN_AUTH and #SA2UL_OP_AUTH_THEN_ENC the whole
+ *          message goes in one call of at most #SA2UL_MAX_INPUT_LENGTH_ENC
+ *          bytes; output holds the cipher or plain text and computedHash the
+ *          HMAC of the cipher text, which the caller compares on decryption.
+ *          For #SA2UL_ENC_MODE_CTR input and output may be the same buffer
+ *          but must not partly overlap, only the last call may have a length
+ *          which is not a multiple of the AES block, and inputLen and
+ *          totalLengthInBytes count the message rounded up to the AES block.
  *
  *  \param  ctxObj  Pointer to *SA2UL_ContextObject* structure
  *
@@ -555,10 +804,84 @@ int32_t SA2UL_contextFree(SA2UL_ContextObject *pCtxObj);
  *
  *  \param  output  Pointer to output buffer after the process is complete
  *
- *  \return A #SystemP_SUCCESS on success or a NULL on an error or if the instance
+ *  \return A #SystemP_SUCCESS on success, #SystemP_TIMEOUT if the engine stops
+ *            returning packets or #SystemP_FAILURE on an error or if the instance
  *            index has  NOT been opened yet */
 int32_t SA2UL_contextProcess(SA2UL_ContextObject *ctxObj, const uint8_t *input, uint32_t ilen, uint8_t *output);
 
+/**
+ *  \brief  Function to hash a message scattered over several buffers without
+ *          copying it. Each fragment is queued as one or more packets with the
+ *          fragment flag, only the last packet of the message tears down the
+ *          context, and up to numDescPairs packets are kept in flight across
+ *          fragment boundaries. The fragments are only read; the data the
+ *          engine returns is dropped into the scratch buffer of the instance,
+ *          which limits a packet to scratchSize of #SA2UL_Params, 2 KB by
+ *          default; each packet costs a descriptor round trip, so large
+ *          messages hash faster with a larger scratch buffer. The fragment
+ *          lengths must add up to the rest of the message, totalLengthInBytes
+ *          for a new context, and every fragment but the one which ends the
+ *          message must end on a hash block of the algorithm.
+ *
+ *  \param  ctxObj   Pointer to *SA2UL_ContextObject* structure of a
+ *                   #SA2UL_OP_AUTH context
+ *
+ *  \param  fragList List of fragments in message order
+ *
+ *  \param  numFrags Number of entries in fragList
+ *
+ *  \return A #SystemP_SUCCESS on success, #SystemP_TIMEOUT if the engine stops
+ *          returning packets or #SystemP_FAILURE on an error
+ */
+int32_t SA2UL_contextProcessGather(SA2UL_ContextObject *ctxObj, const SA2UL_Fragment *fragList, uint32_t numFrags);
+
+/**
+ *  \brief  Function to queue a data buffer without waiting for the engine.
+ *          One job runs per instance; the completion is reported through the
+ *          callback, through #SA2UL_wait, or both. #SA2UL_ENC_MODE_CTR contexts
+ *          are processed with #SA2UL_contextProcess only.
+ *
+ *  \param  ctxObj   Pointer to *SA2UL_ContextObject* structure
+ *
+ *  \param  input    Pointer to input buffer to be processed
+ *
+ *  \param  ilen     Length of the input buffer
+ *
+ *  \param  output   Pointer to output buffer after the process is complete
+ *
+ *  \param  callback Completion callback, can be NULL
+ *
+ *  \param  args     Argument passed to the callback
+ *
+ *  \param  deadline Time in micro seconds the job may take, the job completes with
+ *                   #SA2UL_JOB_DEADLINE_EXPIRED after it. #SA2UL_JOB_NO_DEADLINE for none.
+ *                   A timed out job leaves ctxObj part way through its data and
+ *                   the context must be allocated again.
+ *
+ *  \param  ptrToken Token of the job, to be passed to #SA2UL_wait
+ *
+ *  \return #SystemP_SUCCESS if the job was queued, #SystemP_FAILURE on an error
+ *          or if the instance is busy with another job
+ */
+int32_t SA2UL_submit(SA2UL_ContextObject *ctxObj, const uint8_t *input, uint32_t ilen, uint8_t *output,
+                     SA2UL_JobCallback callback, void *args, uint32_t deadline, SA2UL_JobToken *ptrToken);
+
+/**
+ *  \brief  Function to wait for an asynchronous job
+ *
+ *  \param  handle   #SA2UL_Handle returned from #SA2UL_open()
+ *
+ *  \param  token    Token returned by #SA2UL_submit
+ *
+ *  \param  timeout  Time to wait in system ticks, #SystemP_NO_WAIT to poll or
+ *                   #SystemP_WAIT_FOREVER
+ *
+ *  \return Status of the job once it is complete, #SA2UL_JOB_DEADLINE_EXPIRED if
+ *          its deadline expired, #SystemP_TIMEOUT if it is still running when the
+ *          wait times out, #SystemP_FAILURE for an unknown token
+ */
+int32_t SA2UL_wait(SA2UL_Handle handle, SA2UL_JobToken token, uint32_t timeout);
+
 /**
  *  \brief  Function to initialize default SA2UL parameters
  *
@@ -576,7 +899,16 @@ static inline void SA2UL_Params_init(SA2UL_Params *prms)
 {
     if(prms != NULL)
     {
-        prms->reserved                        = 0;
+        prms->ringDepth                       = 0U;
+        prms->txRingMemAddr                   = 0U;
+        prms->rxRingMemAddr                   = 0U;
+        prms->numDescPairs                    = 0U;
+        prms->descMemAddr                     = 0U;
+        prms->descMemSize                     = 0U;
+        prms->storageQueueMem                 = NULL;
+        prms->intrEnable                      = FALSE;
+        prms->scratchMem                      = NULL;
+        prms->scratchSize                     = 0U;
     }
 }
 